@@ -0,0 +1,178 @@
+/**
+ * @file bench_mul.c
+ * @brief Crossover benchmark for four- vs three-multiplication complex products
+ *
+ * Times the schoolbook kernel ((ac - bd) + (ad + bc)i, four multiplications)
+ * against Gauss's form (three multiplications, three extra additions) for
+ * dc_complex_int and dc_complex_frac operands of increasing size, and
+ * reports the first limb count from which Gauss stays faster, provided it
+ * wins on at least BENCH_CONFIRM consecutive sizes. Use the reported values
+ * for DC_GAUSS_MUL_THRESHOLD and DC_GAUSS_FRAC_MUL_THRESHOLD; run it a few
+ * times on an idle machine and take the median.
+ *
+ * Build: cmake --build build --target bench_mul && ./build/bench_mul
+ */
+
+#define DI_IMPLEMENTATION
+#define DF_IMPLEMENTATION
+#define DC_IMPLEMENTATION
+#include "dynamic_complex.h"
+
+#include <time.h>
+
+#define BENCH_PAIRS 64
+#define BENCH_FRAC_PAIRS 8
+
+typedef void (*int_kernel)(di_int, di_int, di_int, di_int, di_int*, di_int*);
+typedef void (*frac_kernel)(df_frac, df_frac, df_frac, df_frac, df_frac*, df_frac*);
+
+static double now_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// A random integer of exactly the given number of 32-bit limbs, with random sign
+static di_int random_limbs(size_t limbs) {
+    di_int value = di_random(32 * limbs);
+    di_int top = di_shift_left(di_one(), 32 * limbs - 1);
+    di_int forced = di_or(value, top);
+    di_release(&value);
+    di_release(&top);
+    if (rand() & 1) {
+        di_int negated = di_negate(forced);
+        di_release(&forced);
+        return negated;
+    }
+    return forced;
+}
+
+// Nanoseconds per product: repeat over the operand pairs for at least BENCH_SECONDS, best of BENCH_PASSES passes
+#define BENCH_SECONDS 0.25
+#define BENCH_PASSES 5
+
+// Consecutive winning sizes required before a crossover is reported
+#define BENCH_CONFIRM 3
+
+static double time_int(int_kernel kernel, di_int (*ops)[4]) {
+    double best = INFINITY;
+    for (int pass = 0; pass < BENCH_PASSES; pass++) {
+        size_t iterations = 0;
+        double start = now_seconds(), elapsed;
+        do {
+            di_int* op = ops[iterations++ % BENCH_PAIRS];
+            di_int real, imag;
+            kernel(op[0], op[1], op[2], op[3], &real, &imag);
+            di_release(&real);
+            di_release(&imag);
+        } while ((elapsed = now_seconds() - start) < BENCH_SECONDS);
+        if (elapsed / (double)iterations * 1e9 < best) best = elapsed / (double)iterations * 1e9;
+    }
+    return best;
+}
+
+static double time_frac(frac_kernel kernel, df_frac (*ops)[4]) {
+    double best = INFINITY;
+    for (int pass = 0; pass < BENCH_PASSES; pass++) {
+        size_t iterations = 0;
+        double start = now_seconds(), elapsed;
+        do {
+            df_frac* op = ops[iterations++ % BENCH_FRAC_PAIRS];
+            df_frac real, imag;
+            kernel(op[0], op[1], op[2], op[3], &real, &imag);
+            df_release(&real);
+            df_release(&imag);
+        } while ((elapsed = now_seconds() - start) < BENCH_SECONDS);
+        if (elapsed / (double)iterations * 1e9 < best) best = elapsed / (double)iterations * 1e9;
+    }
+    return best;
+}
+
+// Start of the current run of sizes on which the three-multiplication form wins
+typedef struct {
+    size_t start;
+    size_t wins;
+} crossover;
+
+static void update_crossover(crossover* c, size_t limbs, double four, double three) {
+    if (three >= four) {
+        c->start = 0;
+        c->wins = 0;
+        return;
+    }
+    if (c->wins++ == 0) c->start = limbs;
+}
+
+// First size from which the three-multiplication form keeps winning, or 0 if the run is too short to trust
+static size_t crossover_limbs(const crossover* c) {
+    return c->wins >= BENCH_CONFIRM ? c->start : 0;
+}
+
+int main(void) {
+    // Fractions reduce every intermediate by a gcd, so they are measured over a shorter range
+    static const size_t int_sizes[] = {1, 2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64, 96, 128};
+    static const size_t frac_sizes[] = {1, 2, 3, 4, 6, 8};
+    const size_t int_count = sizeof(int_sizes) / sizeof(int_sizes[0]);
+    const size_t frac_count = sizeof(frac_sizes) / sizeof(frac_sizes[0]);
+    crossover int_run = {0, 0}, frac_run = {0, 0};
+    srand(12345);
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    printf("%6s  %12s %12s %7s\n", "limbs", "int 4-mul", "int 3-mul", "ratio");
+    for (size_t s = 0; s < int_count; s++) {
+        size_t limbs = int_sizes[s];
+        di_int ints[BENCH_PAIRS][4];
+        for (size_t k = 0; k < BENCH_PAIRS; k++) {
+            for (int j = 0; j < 4; j++) ints[k][j] = random_limbs(limbs);
+        }
+
+        double four = time_int(dc_int_mul_schoolbook, ints);
+        double three = time_int(dc_int_mul_gauss, ints);
+        printf("%6zu  %10.0fns %10.0fns %7.2f\n", limbs, four, three, four / three);
+        update_crossover(&int_run, limbs, four, three);
+
+        for (size_t k = 0; k < BENCH_PAIRS; k++) {
+            for (int j = 0; j < 4; j++) di_release(&ints[k][j]);
+        }
+    }
+
+    printf("\n%6s  %12s %12s %7s\n", "limbs", "frac 4-mul", "frac 3-mul", "ratio");
+    for (size_t s = 0; s < frac_count; s++) {
+        size_t limbs = frac_sizes[s];
+        df_frac fracs[BENCH_FRAC_PAIRS][4];
+        for (size_t k = 0; k < BENCH_FRAC_PAIRS; k++) {
+            for (int j = 0; j < 4; j++) {
+                di_int numerator = random_limbs(limbs);
+                di_int magnitude = random_limbs(limbs);
+                di_int denominator = di_abs(magnitude);
+                fracs[k][j] = df_from_di(numerator, denominator);
+                di_release(&numerator);
+                di_release(&magnitude);
+                di_release(&denominator);
+            }
+        }
+
+        double four = time_frac(dc_frac_mul_schoolbook, fracs);
+        double three = time_frac(dc_frac_mul_gauss, fracs);
+        printf("%6zu  %10.0fns %10.0fns %7.2f\n", limbs, four, three, four / three);
+        update_crossover(&frac_run, limbs, four, three);
+
+        for (size_t k = 0; k < BENCH_FRAC_PAIRS; k++) {
+            for (int j = 0; j < 4; j++) df_release(&fracs[k][j]);
+        }
+    }
+
+    size_t int_crossover = crossover_limbs(&int_run);
+    size_t frac_crossover = crossover_limbs(&frac_run);
+    if (int_crossover) {
+        printf("\ndc_complex_int crossover: %zu limbs (DC_GAUSS_MUL_THRESHOLD)\n", int_crossover);
+    } else {
+        printf("\ndc_complex_int crossover: none up to %zu limbs\n", int_sizes[int_count - 1]);
+    }
+    if (frac_crossover) {
+        printf("dc_complex_frac crossover: %zu limbs (DC_GAUSS_FRAC_MUL_THRESHOLD)\n", frac_crossover);
+    } else {
+        printf("dc_complex_frac crossover: none up to %zu limbs\n", frac_sizes[frac_count - 1]);
+    }
+    return 0;
+}
@@ -0,0 +1,895 @@
+/**
+ * @file bench_ops.c
+ * @brief Per-operation benchmark for the public dc_* API
+ *
+ * Measures nanoseconds and allocator calls (malloc and realloc through
+ * DC_MALLOC, DI_MALLOC and DF_MALLOC) per call for the dc_int_*, dc_frac_*,
+ * dc_cfrac_*, dc_double_* (scalar and array), FFT, polynomial and conversion
+ * functions. Arbitrary precision operations sweep component sizes from 1 to
+ * 4096 32-bit limbs; array, FFT and polynomial operations sweep lengths. Once
+ * a call takes longer than BENCH_MAX_OP_MS at some size, larger sizes of that
+ * function are skipped, which keeps the quadratic di_int division and gcd
+ * kernels from stalling the sweep.
+ *
+ * A table goes to stdout. --csv and --json write the same rows, tagged with
+ * --label (for example a commit hash), for comparison across commits.
+ *
+ * Build: cmake --build build --target bench
+ * Run:   ./build/bench [--csv FILE] [--json FILE] [--label TEXT] [--filter TEXT] [--max-size N] [--seconds S]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Count every allocation made by the library and its dependencies
+static size_t bench_allocations = 0;
+
+static void* bench_malloc(size_t size) {
+    bench_allocations++;
+    return malloc(size);
+}
+
+static void* bench_realloc(void* ptr, size_t size) {
+    bench_allocations++;
+    return realloc(ptr, size);
+}
+
+#define DC_MALLOC bench_malloc
+#define DC_REALLOC bench_realloc
+#define DI_MALLOC bench_malloc
+#define DI_REALLOC bench_realloc
+#define DF_MALLOC bench_malloc
+
+#define DI_IMPLEMENTATION
+#define DF_IMPLEMENTATION
+#define DC_IMPLEMENTATION
+#include "dynamic_complex.h"
+
+#include <time.h>
+
+#define BENCH_MAX_OP_MS 10.0
+#define BENCH_MAX_ROWS 4096
+#define BENCH_POW_EXPONENT 8
+
+typedef enum { UNIT_NONE, UNIT_LIMBS, UNIT_ELEMENTS } bench_unit;
+
+static const char* const unit_names[] = {"none", "limbs", "elements"};
+static const size_t limb_sizes[] = {1, 4, 16, 64, 256, 1024, 4096};
+static const size_t element_sizes[] = {16, 256, 4096, 65536};
+
+// Operands for one size; every benchmark reads them and releases whatever it creates
+typedef struct {
+    size_t size;
+    di_int re, im;
+    dc_complex_int ia, ib;
+    di_int exponent;
+    dc_complex_frac fa, fb, lazy;
+    dc_complex_cfrac ca, cb;
+    dc_complex_double da, db;
+    dc_complex_int int_dst;
+    dc_complex_frac frac_dst;
+    dc_complex_double double_dst;
+    dc_double_array xa, xb, x_dst;
+    double* real;
+    double* imag;
+    double* input;
+    double complex* values;
+    dc_fft_plan plan;
+    dc_complex_int* poly_a;
+    dc_complex_int* poly_b;
+    dc_complex_int* poly_out;
+} bench_operands;
+
+typedef struct {
+    const char* name;
+    bench_unit unit;
+    size_t max_size;  // 0: limited only by BENCH_MAX_OP_MS
+    void (*run)(bench_operands* o);
+} bench_case;
+
+typedef struct {
+    const char* name;
+    bench_unit unit;
+    size_t size;
+    double ns_per_op;
+    double allocs_per_op;
+    size_t iterations;
+} bench_row;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// ============================================================================
+// OPERANDS
+// ============================================================================
+
+// A random integer of exactly the given number of 32-bit limbs, with random sign
+static di_int random_limbs(size_t limbs) {
+    di_int value = di_random(32 * limbs);
+    di_int one = di_one();
+    di_int top = di_shift_left(one, 32 * limbs - 1);
+    di_int forced = di_or(value, top);
+    di_release(&value);
+    di_release(&one);
+    di_release(&top);
+    if (rand() & 1) {
+        di_int negated = di_negate(forced);
+        di_release(&forced);
+        return negated;
+    }
+    return forced;
+}
+
+// Positive odd denominator of the given size
+static di_int random_denominator(size_t limbs) {
+    di_int value = random_limbs(limbs);
+    di_int magnitude = di_abs(value);
+    di_int one = di_one();
+    di_int odd = di_or(magnitude, one);
+    di_release(&value);
+    di_release(&magnitude);
+    di_release(&one);
+    return odd;
+}
+
+// k * den + 1 is coprime to den, so fractions of any size are built without a gcd
+static di_int coprime_numerator(di_int den) {
+    di_int k = random_limbs(1);
+    di_int product = di_mul(k, den);
+    di_int num = di_add_i32(product, 1);
+    di_release(&k);
+    di_release(&product);
+    return num;
+}
+
+static df_frac random_fraction(size_t limbs) {
+    di_int den = random_denominator(limbs);
+    di_int num = coprime_numerator(den);
+    df_frac f = dc_df_node(num, den);
+    di_release(&den);
+    di_release(&num);
+    return f;
+}
+
+static dc_complex_frac random_frac(size_t limbs) {
+    df_frac real = random_fraction(limbs), imag = random_fraction(limbs);
+    dc_complex_frac c = dc_frac_from_df(real, imag);
+    df_release(&real);
+    df_release(&imag);
+    return c;
+}
+
+// (real + imag i) / den with real = k den + 1 is already canonical
+static dc_complex_cfrac random_cfrac(size_t limbs) {
+    di_int den = random_denominator(limbs);
+    return dc_cfrac_alloc(coprime_numerator(den), random_limbs(limbs), den);
+}
+
+static void operands_build(bench_operands* o, bench_unit unit, size_t size) {
+    memset(o, 0, sizeof(*o));
+    o->size = size;
+
+    if (unit == UNIT_LIMBS) {
+        di_int parts[4];
+        for (int k = 0; k < 4; k++) parts[k] = random_limbs(size);
+        o->ia = dc_int_from_di(parts[0], parts[1]);
+        o->ib = dc_int_from_di(parts[2], parts[3]);
+        o->re = parts[0];
+        o->im = parts[1];
+        di_release(&parts[2]);
+        di_release(&parts[3]);
+        o->exponent = di_from_uint64(0xfedcba9876543210ULL);
+        o->fa = random_frac(size);
+        o->fb = random_frac(size);
+        o->lazy = dc_frac_lazy(o->fa);
+        o->ca = random_cfrac(size);
+        o->cb = random_cfrac(size);
+    }
+
+    o->da = dc_double_from_doubles(0.75, -1.25);
+    o->db = dc_double_from_doubles(-2.5, 0.5);
+    o->int_dst = dc_int_zero();
+    o->frac_dst = dc_frac_zero();
+    o->double_dst = dc_double_from_doubles(0.0, 0.0);
+
+    if (unit == UNIT_ELEMENTS) {
+        o->xa = dc_double_array_new(size);
+        o->xb = dc_double_array_new(size);
+        o->x_dst = dc_double_array_new(size);
+        o->real = malloc(size * sizeof(double));
+        o->imag = malloc(size * sizeof(double));
+        o->input = malloc(size * sizeof(double));
+        o->values = malloc(size * sizeof(double complex));
+        o->poly_a = malloc(size * sizeof(dc_complex_int));
+        o->poly_b = malloc(size * sizeof(dc_complex_int));
+        o->poly_out = malloc((2 * size - 1) * sizeof(dc_complex_int));
+        for (size_t k = 0; k < size; k++) {
+            double re = (double)rand() / RAND_MAX - 0.5, im = (double)rand() / RAND_MAX - 0.5;
+            dc_double_array_set(o->xa, k, re + im * I);
+            dc_double_array_set(o->xb, k, im + 0.75 + re * I);
+            o->input[k] = re;
+            o->poly_a[k] = dc_int_from_ints(rand() - RAND_MAX / 2, rand() - RAND_MAX / 2);
+            o->poly_b[k] = dc_int_from_ints(rand() - RAND_MAX / 2, rand() - RAND_MAX / 2);
+        }
+        o->plan = dc_fft_plan_new(size);
+    }
+}
+
+static void operands_release(bench_operands* o) {
+    di_release(&o->re);
+    di_release(&o->im);
+    dc_int_release(&o->ia);
+    dc_int_release(&o->ib);
+    di_release(&o->exponent);
+    dc_frac_release(&o->fa);
+    dc_frac_release(&o->fb);
+    dc_frac_release(&o->lazy);
+    dc_cfrac_release(&o->ca);
+    dc_cfrac_release(&o->cb);
+    dc_double_release(&o->da);
+    dc_double_release(&o->db);
+    dc_int_release(&o->int_dst);
+    dc_frac_release(&o->frac_dst);
+    dc_double_release(&o->double_dst);
+    dc_double_array_release(&o->xa);
+    dc_double_array_release(&o->xb);
+    dc_double_array_release(&o->x_dst);
+    dc_fft_plan_release(&o->plan);
+    if (o->poly_a) {
+        for (size_t k = 0; k < o->size; k++) {
+            dc_int_release(&o->poly_a[k]);
+            dc_int_release(&o->poly_b[k]);
+        }
+    }
+    free(o->real);
+    free(o->imag);
+    free(o->input);
+    free(o->values);
+    free(o->poly_a);
+    free(o->poly_b);
+    free(o->poly_out);
+}
+
+// ============================================================================
+// BENCHMARKS
+// ============================================================================
+
+#define BENCH(id) static void bench_##id(__attribute__((unused)) bench_operands* o)
+
+// Result-returning calls of each family, released straight away
+#define INT_CALL(id, call) BENCH(id) { dc_complex_int r = call; dc_int_release(&r); }
+#define FRAC_CALL(id, call) BENCH(id) { dc_complex_frac r = call; dc_frac_release(&r); }
+#define CFRAC_CALL(id, call) BENCH(id) { dc_complex_cfrac r = call; dc_cfrac_release(&r); }
+#define DOUBLE_CALL(id, call) BENCH(id) { dc_complex_double r = call; dc_double_release(&r); }
+#define ARRAY_CALL(id, call) BENCH(id) { dc_double_array r = call; dc_double_array_release(&r); }
+#define DI_CALL(id, call) BENCH(id) { di_int r = call; di_release(&r); }
+#define DF_CALL(id, call) BENCH(id) { df_frac r = call; df_release(&r); }
+#define STRING_CALL(id, call) BENCH(id) { char* r = call; free(r); }
+#define VALUE_CALL(id, call) BENCH(id) { volatile bool sink = (bool)(call); (void)sink; }
+// Size query, encode into a buffer of that size, then decode
+#define SERIAL_ROUND_TRIP(id, family, type, operand)                            \
+    BENCH(id) {                                                                 \
+        size_t size = dc_##family##_serialized_size(operand);                   \
+        uint8_t* buffer = malloc(size);                                         \
+        dc_##family##_serialize(operand, buffer, size);                         \
+        type r = dc_##family##_deserialize(buffer, size, NULL);                 \
+        dc_##family##_release(&r);                                              \
+        free(buffer);                                                           \
+    }
+
+// dc_complex_int
+INT_CALL(int_from_ints, dc_int_from_ints(3, -4))
+INT_CALL(int_from_di, dc_int_from_di(o->re, o->im))
+INT_CALL(int_zero, dc_int_zero())
+INT_CALL(int_one, dc_int_one())
+INT_CALL(int_i, dc_int_i())
+INT_CALL(int_neg_one, dc_int_neg_one())
+INT_CALL(int_neg_i, dc_int_neg_i())
+INT_CALL(int_retain_release, dc_int_retain(o->ia))
+VALUE_CALL(int_is_immortal, dc_int_is_immortal(o->ia))
+INT_CALL(int_copy, dc_int_copy(o->ia))
+INT_CALL(int_add, dc_int_add(o->ia, o->ib))
+INT_CALL(int_sub, dc_int_sub(o->ia, o->ib))
+INT_CALL(int_mul, dc_int_mul(o->ia, o->ib))
+FRAC_CALL(int_div, dc_int_div(o->ia, o->ib))
+INT_CALL(int_negate, dc_int_negate(o->ia))
+INT_CALL(int_conj, dc_int_conj(o->ia))
+DI_CALL(int_norm, dc_int_norm(o->ia))
+INT_CALL(int_pow, dc_int_pow(o->ia, BENCH_POW_EXPONENT))
+BENCH(int_divmod) {
+    dc_complex_int q, r;
+    dc_int_divmod(o->ia, o->ib, &q, &r);
+    dc_int_release(&q);
+    dc_int_release(&r);
+}
+INT_CALL(int_gcd, dc_int_gcd(o->ia, o->ib))
+BENCH(int_xgcd) {
+    dc_complex_int x, y;
+    dc_complex_int g = dc_int_xgcd(o->ia, o->ib, &x, &y);
+    dc_int_release(&g);
+    dc_int_release(&x);
+    dc_int_release(&y);
+}
+INT_CALL(int_powmod, dc_int_powmod(o->ia, o->exponent, o->ib))
+VALUE_CALL(int_is_prime, dc_int_is_prime(o->ia))
+BENCH(int_factor) {
+    dc_int_factorization f = dc_int_factor(o->ia);
+    dc_int_factorization_release(&f);
+}
+DI_CALL(int_real, dc_int_real(o->ia))
+DI_CALL(int_imag, dc_int_imag(o->ia))
+VALUE_CALL(int_eq, dc_int_eq(o->ia, o->ib))
+VALUE_CALL(int_compare_abs, dc_int_compare_abs(o->ia, o->ib))
+VALUE_CALL(int_is_zero, dc_int_is_zero(o->ia))
+VALUE_CALL(int_is_real, dc_int_is_real(o->ia))
+VALUE_CALL(int_is_imag, dc_int_is_imag(o->ia))
+STRING_CALL(int_to_string, dc_int_to_string(o->ia))
+SERIAL_ROUND_TRIP(int_serial_round_trip, int, dc_complex_int, o->ia)
+BENCH(int_add_into) { dc_int_add_into(&o->int_dst, o->ia, o->ib); }
+BENCH(int_sub_into) { dc_int_sub_into(&o->int_dst, o->ia, o->ib); }
+BENCH(int_mul_into) { dc_int_mul_into(&o->int_dst, o->ia, o->ib); }
+BENCH(int_div_into) { dc_int_div_into(&o->frac_dst, o->ia, o->ib); }
+BENCH(int_negate_into) { dc_int_negate_into(&o->int_dst, o->ia); }
+BENCH(int_conj_into) { dc_int_conj_into(&o->int_dst, o->ia); }
+// Steal variants consume a uniquely owned first operand, so each call includes one dc_int_copy
+INT_CALL(int_add_steal, dc_int_add_steal(dc_int_copy(o->ia), o->ib))
+INT_CALL(int_sub_steal, dc_int_sub_steal(dc_int_copy(o->ia), o->ib))
+INT_CALL(int_mul_steal, dc_int_mul_steal(dc_int_copy(o->ia), o->ib))
+INT_CALL(int_negate_steal, dc_int_negate_steal(dc_int_copy(o->ia)))
+INT_CALL(int_conj_steal, dc_int_conj_steal(dc_int_copy(o->ia)))
+
+// dc_complex_frac
+FRAC_CALL(frac_from_ints, dc_frac_from_ints(1, 2, -3, 4))
+FRAC_CALL(frac_from_df, dc_frac_from_df(o->fa->real, o->fb->imag))
+FRAC_CALL(frac_zero, dc_frac_zero())
+FRAC_CALL(frac_one, dc_frac_one())
+FRAC_CALL(frac_i, dc_frac_i())
+FRAC_CALL(frac_neg_one, dc_frac_neg_one())
+FRAC_CALL(frac_neg_i, dc_frac_neg_i())
+FRAC_CALL(frac_retain_release, dc_frac_retain(o->fa))
+VALUE_CALL(frac_is_immortal, dc_frac_is_immortal(o->fa))
+FRAC_CALL(frac_copy, dc_frac_copy(o->fa))
+FRAC_CALL(frac_add, dc_frac_add(o->fa, o->fb))
+FRAC_CALL(frac_sub, dc_frac_sub(o->fa, o->fb))
+FRAC_CALL(frac_mul, dc_frac_mul(o->fa, o->fb))
+FRAC_CALL(frac_div, dc_frac_div(o->fa, o->fb))
+FRAC_CALL(frac_negate, dc_frac_negate(o->fa))
+FRAC_CALL(frac_conj, dc_frac_conj(o->fa))
+DF_CALL(frac_norm, dc_frac_norm(o->fa))
+FRAC_CALL(frac_pow, dc_frac_pow(o->fa, BENCH_POW_EXPONENT))
+FRAC_CALL(frac_reciprocal, dc_frac_reciprocal(o->fa))
+FRAC_CALL(frac_lazy, dc_frac_lazy(o->fa))
+FRAC_CALL(frac_lazy_add, dc_frac_add(o->lazy, o->fb))
+FRAC_CALL(frac_normalize, dc_frac_normalize(o->lazy))
+VALUE_CALL(frac_is_lazy, dc_frac_is_lazy(o->lazy))
+DF_CALL(frac_real, dc_frac_real(o->fa))
+DF_CALL(frac_imag, dc_frac_imag(o->fa))
+VALUE_CALL(frac_eq, dc_frac_eq(o->fa, o->fb))
+VALUE_CALL(frac_compare_abs, dc_frac_compare_abs(o->fa, o->fb))
+VALUE_CALL(frac_is_zero, dc_frac_is_zero(o->fa))
+VALUE_CALL(frac_is_real, dc_frac_is_real(o->fa))
+VALUE_CALL(frac_is_imag, dc_frac_is_imag(o->fa))
+VALUE_CALL(frac_is_gaussian_int, dc_frac_is_gaussian_int(o->fa))
+STRING_CALL(frac_to_string, dc_frac_to_string(o->fa))
+SERIAL_ROUND_TRIP(frac_serial_round_trip, frac, dc_complex_frac, o->fa)
+BENCH(frac_add_into) { dc_frac_add_into(&o->frac_dst, o->fa, o->fb); }
+BENCH(frac_sub_into) { dc_frac_sub_into(&o->frac_dst, o->fa, o->fb); }
+BENCH(frac_mul_into) { dc_frac_mul_into(&o->frac_dst, o->fa, o->fb); }
+BENCH(frac_div_into) { dc_frac_div_into(&o->frac_dst, o->fa, o->fb); }
+BENCH(frac_negate_into) { dc_frac_negate_into(&o->frac_dst, o->fa); }
+BENCH(frac_conj_into) { dc_frac_conj_into(&o->frac_dst, o->fa); }
+BENCH(frac_reciprocal_into) { dc_frac_reciprocal_into(&o->frac_dst, o->fa); }
+FRAC_CALL(frac_add_steal, dc_frac_add_steal(dc_frac_copy(o->fa), o->fb))
+FRAC_CALL(frac_sub_steal, dc_frac_sub_steal(dc_frac_copy(o->fa), o->fb))
+FRAC_CALL(frac_mul_steal, dc_frac_mul_steal(dc_frac_copy(o->fa), o->fb))
+FRAC_CALL(frac_div_steal, dc_frac_div_steal(dc_frac_copy(o->fa), o->fb))
+FRAC_CALL(frac_negate_steal, dc_frac_negate_steal(dc_frac_copy(o->fa)))
+FRAC_CALL(frac_conj_steal, dc_frac_conj_steal(dc_frac_copy(o->fa)))
+FRAC_CALL(frac_reciprocal_steal, dc_frac_reciprocal_steal(dc_frac_copy(o->fa)))
+
+// dc_complex_cfrac
+CFRAC_CALL(cfrac_from_di, dc_cfrac_from_di(o->ca->real, o->ca->imag, o->cb->den))
+CFRAC_CALL(cfrac_from_ints, dc_cfrac_from_ints(6, -4, 10))
+CFRAC_CALL(cfrac_retain_release, dc_cfrac_retain(o->ca))
+VALUE_CALL(cfrac_is_immortal, dc_cfrac_is_immortal(o->ca))
+CFRAC_CALL(cfrac_add, dc_cfrac_add(o->ca, o->cb))
+CFRAC_CALL(cfrac_sub, dc_cfrac_sub(o->ca, o->cb))
+CFRAC_CALL(cfrac_mul, dc_cfrac_mul(o->ca, o->cb))
+CFRAC_CALL(cfrac_div, dc_cfrac_div(o->ca, o->cb))
+CFRAC_CALL(cfrac_negate, dc_cfrac_negate(o->ca))
+CFRAC_CALL(cfrac_conj, dc_cfrac_conj(o->ca))
+DF_CALL(cfrac_norm, dc_cfrac_norm(o->ca))
+INT_CALL(cfrac_numerator, dc_cfrac_numerator(o->ca))
+DI_CALL(cfrac_denominator, dc_cfrac_denominator(o->ca))
+VALUE_CALL(cfrac_eq, dc_cfrac_eq(o->ca, o->cb))
+VALUE_CALL(cfrac_is_zero, dc_cfrac_is_zero(o->ca))
+STRING_CALL(cfrac_to_string, dc_cfrac_to_string(o->ca))
+SERIAL_ROUND_TRIP(cfrac_serial_round_trip, cfrac, dc_complex_cfrac, o->ca)
+
+// dc_complex_double
+DOUBLE_CALL(double_from_doubles, dc_double_from_doubles(1.5, -2.5))
+DOUBLE_CALL(double_from_polar, dc_double_from_polar(2.0, 0.75))
+DOUBLE_CALL(double_from_value, dc_double_from_value(1.5 - 2.5 * I))
+DOUBLE_CALL(double_zero, dc_double_zero())
+DOUBLE_CALL(double_one, dc_double_one())
+DOUBLE_CALL(double_i, dc_double_i())
+DOUBLE_CALL(double_neg_one, dc_double_neg_one())
+DOUBLE_CALL(double_neg_i, dc_double_neg_i())
+DOUBLE_CALL(double_retain_release, dc_double_retain(o->da))
+VALUE_CALL(double_is_immortal, dc_double_is_immortal(o->da))
+DOUBLE_CALL(double_copy, dc_double_copy(o->da))
+DOUBLE_CALL(double_add, dc_double_add(o->da, o->db))
+DOUBLE_CALL(double_sub, dc_double_sub(o->da, o->db))
+DOUBLE_CALL(double_mul, dc_double_mul(o->da, o->db))
+DOUBLE_CALL(double_div, dc_double_div(o->da, o->db))
+DOUBLE_CALL(double_negate, dc_double_negate(o->da))
+DOUBLE_CALL(double_conj, dc_double_conj(o->da))
+DOUBLE_CALL(double_exp, dc_double_exp(o->da))
+DOUBLE_CALL(double_log, dc_double_log(o->da))
+DOUBLE_CALL(double_pow, dc_double_pow(o->da, o->db))
+DOUBLE_CALL(double_sqrt, dc_double_sqrt(o->da))
+DOUBLE_CALL(double_sin, dc_double_sin(o->da))
+DOUBLE_CALL(double_cos, dc_double_cos(o->da))
+DOUBLE_CALL(double_tan, dc_double_tan(o->da))
+DOUBLE_CALL(double_sinh, dc_double_sinh(o->da))
+DOUBLE_CALL(double_cosh, dc_double_cosh(o->da))
+DOUBLE_CALL(double_tanh, dc_double_tanh(o->da))
+VALUE_CALL(double_real, dc_double_real(o->da) != 0.0)
+VALUE_CALL(double_imag, dc_double_imag(o->da) != 0.0)
+VALUE_CALL(double_value, creal(dc_double_value(o->da)) != 0.0)
+VALUE_CALL(double_abs, dc_double_abs(o->da) != 0.0)
+VALUE_CALL(double_arg, dc_double_arg(o->da) != 0.0)
+VALUE_CALL(double_eq, dc_double_eq(o->da, o->db))
+VALUE_CALL(double_is_zero, dc_double_is_zero(o->da))
+VALUE_CALL(double_is_real, dc_double_is_real(o->da))
+VALUE_CALL(double_is_imag, dc_double_is_imag(o->da))
+VALUE_CALL(double_is_nan, dc_double_is_nan(o->da))
+VALUE_CALL(double_is_inf, dc_double_is_inf(o->da))
+STRING_CALL(double_to_string, dc_double_to_string(o->da))
+SERIAL_ROUND_TRIP(double_serial_round_trip, double, dc_complex_double, o->da)
+BENCH(double_add_into) { dc_double_add_into(&o->double_dst, o->da, o->db); }
+BENCH(double_sub_into) { dc_double_sub_into(&o->double_dst, o->da, o->db); }
+BENCH(double_mul_into) { dc_double_mul_into(&o->double_dst, o->da, o->db); }
+BENCH(double_div_into) { dc_double_div_into(&o->double_dst, o->da, o->db); }
+BENCH(double_negate_into) { dc_double_negate_into(&o->double_dst, o->da); }
+BENCH(double_conj_into) { dc_double_conj_into(&o->double_dst, o->da); }
+DOUBLE_CALL(double_add_steal, dc_double_add_steal(dc_double_copy(o->da), o->db))
+DOUBLE_CALL(double_sub_steal, dc_double_sub_steal(dc_double_copy(o->da), o->db))
+DOUBLE_CALL(double_mul_steal, dc_double_mul_steal(dc_double_copy(o->da), o->db))
+DOUBLE_CALL(double_div_steal, dc_double_div_steal(dc_double_copy(o->da), o->db))
+DOUBLE_CALL(double_negate_steal, dc_double_negate_steal(dc_double_copy(o->da)))
+DOUBLE_CALL(double_conj_steal, dc_double_conj_steal(dc_double_copy(o->da)))
+
+// Conversions
+FRAC_CALL(int_to_frac, dc_int_to_frac(o->ia))
+DOUBLE_CALL(int_to_double, dc_int_to_double(o->ia))
+DOUBLE_CALL(frac_to_double, dc_frac_to_double(o->fa))
+INT_CALL(frac_to_int, dc_frac_to_int(o->fa))
+CFRAC_CALL(frac_to_cfrac, dc_frac_to_cfrac(o->fa))
+FRAC_CALL(cfrac_to_frac, dc_cfrac_to_frac(o->ca))
+INT_CALL(double_to_int, dc_double_to_int(o->da))
+FRAC_CALL(double_to_frac, dc_double_to_frac(o->da, 1000000))
+
+// dc_double_array, FFT and polynomials
+ARRAY_CALL(array_new, dc_double_array_new(o->size))
+ARRAY_CALL(array_from_values, dc_double_array_from_values(o->values, o->size))
+ARRAY_CALL(array_from_parts, dc_double_array_from_parts(o->real, o->imag, o->size))
+ARRAY_CALL(array_copy, dc_double_array_copy(o->xa))
+BENCH(array_get) { volatile double sink = creal(dc_double_array_get(o->xa, o->size / 2)); (void)sink; }
+BENCH(array_set) { dc_double_array_set(o->x_dst, o->size / 2, 1.0 + 2.0 * I); }
+BENCH(array_to_values) { dc_double_array_to_values(o->xa, o->values); }
+ARRAY_CALL(array_add, dc_double_array_add(o->xa, o->xb))
+ARRAY_CALL(array_sub, dc_double_array_sub(o->xa, o->xb))
+ARRAY_CALL(array_mul, dc_double_array_mul(o->xa, o->xb))
+ARRAY_CALL(array_div, dc_double_array_div(o->xa, o->xb))
+ARRAY_CALL(array_conj, dc_double_array_conj(o->xa))
+BENCH(array_add_into) { dc_double_array_add_into(o->x_dst, o->xa, o->xb); }
+BENCH(array_sub_into) { dc_double_array_sub_into(o->x_dst, o->xa, o->xb); }
+BENCH(array_mul_into) { dc_double_array_mul_into(o->x_dst, o->xa, o->xb); }
+BENCH(array_div_into) { dc_double_array_div_into(o->x_dst, o->xa, o->xb); }
+BENCH(array_conj_into) { dc_double_array_conj_into(o->x_dst, o->xa); }
+BENCH(array_abs) { dc_double_array_abs(o->xa, o->real); }
+BENCH(array_arg) { dc_double_array_arg(o->xa, o->real); }
+ARRAY_CALL(array_exp, dc_double_array_exp(o->xa))
+ARRAY_CALL(array_log, dc_double_array_log(o->xa))
+ARRAY_CALL(array_sin, dc_double_array_sin(o->xa))
+ARRAY_CALL(array_cos, dc_double_array_cos(o->xa))
+ARRAY_CALL(array_sqrt, dc_double_array_sqrt(o->xa))
+BENCH(array_exp_into) { dc_double_array_exp_into(o->x_dst, o->xa); }
+BENCH(array_log_into) { dc_double_array_log_into(o->x_dst, o->xa); }
+BENCH(array_sin_into) { dc_double_array_sin_into(o->x_dst, o->xa); }
+BENCH(array_cos_into) { dc_double_array_cos_into(o->x_dst, o->xa); }
+BENCH(array_sqrt_into) { dc_double_array_sqrt_into(o->x_dst, o->xa); }
+BENCH(fft_plan_new) {
+    dc_fft_plan plan = dc_fft_plan_new(o->size);
+    dc_fft_plan_release(&plan);
+}
+// In-place transforms restart from the same input each call (one memcpy per call) so values stay finite
+BENCH(fft_forward) {
+    memcpy(o->real, dc_double_array_real(o->xa), o->size * sizeof(double));
+    memcpy(o->imag, dc_double_array_imag(o->xa), o->size * sizeof(double));
+    dc_fft_forward(o->plan, o->real, o->imag);
+}
+BENCH(fft_inverse) {
+    memcpy(o->real, dc_double_array_real(o->xa), o->size * sizeof(double));
+    memcpy(o->imag, dc_double_array_imag(o->xa), o->size * sizeof(double));
+    dc_fft_inverse(o->plan, o->real, o->imag);
+}
+BENCH(fft_forward_values) {
+    dc_double_array_to_values(o->xa, o->values);
+    dc_fft_forward_values(o->plan, o->values);
+}
+BENCH(fft_inverse_values) {
+    dc_double_array_to_values(o->xa, o->values);
+    dc_fft_inverse_values(o->plan, o->values);
+}
+BENCH(fft_real_forward) { dc_fft_real_forward(o->plan, o->input, o->real, o->imag); }
+BENCH(fft_real_inverse) {
+    dc_fft_real_forward(o->plan, o->input, o->real, o->imag);
+    dc_fft_real_inverse(o->plan, o->real, o->imag, o->input);
+}
+ARRAY_CALL(array_fft, dc_double_array_fft(o->xa))
+ARRAY_CALL(array_ifft, dc_double_array_ifft(o->xa))
+BENCH(array_fft_into) { dc_double_array_fft_into(o->x_dst, o->xa); }
+BENCH(array_ifft_into) { dc_double_array_ifft_into(o->x_dst, o->xa); }
+BENCH(int_poly_mul) {
+    dc_int_poly_mul(o->poly_out, o->poly_a, o->size, o->poly_b, o->size);
+    for (size_t k = 0; k < 2 * o->size - 1; k++) dc_int_release(&o->poly_out[k]);
+}
+
+#define CASE(id, unit) {"dc_" #id, unit, 0, bench_##id}
+#define CASE_MAX(id, unit, max) {"dc_" #id, unit, max, bench_##id}
+
+static const bench_case cases[] = {
+    CASE(int_from_ints, UNIT_NONE),
+    CASE(int_from_di, UNIT_LIMBS),
+    CASE(int_zero, UNIT_NONE),
+    CASE(int_one, UNIT_NONE),
+    CASE(int_i, UNIT_NONE),
+    CASE(int_neg_one, UNIT_NONE),
+    CASE(int_neg_i, UNIT_NONE),
+    CASE(int_retain_release, UNIT_LIMBS),
+    CASE(int_is_immortal, UNIT_LIMBS),
+    CASE(int_copy, UNIT_LIMBS),
+    CASE(int_add, UNIT_LIMBS),
+    CASE(int_sub, UNIT_LIMBS),
+    CASE(int_mul, UNIT_LIMBS),
+    CASE(int_div, UNIT_LIMBS),
+    CASE(int_negate, UNIT_LIMBS),
+    CASE(int_conj, UNIT_LIMBS),
+    CASE(int_norm, UNIT_LIMBS),
+    CASE(int_pow, UNIT_LIMBS),
+    CASE(int_divmod, UNIT_LIMBS),
+    CASE(int_gcd, UNIT_LIMBS),
+    CASE(int_xgcd, UNIT_LIMBS),
+    CASE(int_powmod, UNIT_LIMBS),
+    CASE(int_is_prime, UNIT_LIMBS),
+    // Factoring cost depends on the factors found, not only on size
+    CASE_MAX(int_factor, UNIT_LIMBS, 1),
+    CASE(int_real, UNIT_LIMBS),
+    CASE(int_imag, UNIT_LIMBS),
+    CASE(int_eq, UNIT_LIMBS),
+    CASE(int_compare_abs, UNIT_LIMBS),
+    CASE(int_is_zero, UNIT_LIMBS),
+    CASE(int_is_real, UNIT_LIMBS),
+    CASE(int_is_imag, UNIT_LIMBS),
+    CASE(int_to_string, UNIT_LIMBS),
+    CASE(int_serial_round_trip, UNIT_LIMBS),
+    CASE(int_add_into, UNIT_LIMBS),
+    CASE(int_sub_into, UNIT_LIMBS),
+    CASE(int_mul_into, UNIT_LIMBS),
+    CASE(int_div_into, UNIT_LIMBS),
+    CASE(int_negate_into, UNIT_LIMBS),
+    CASE(int_conj_into, UNIT_LIMBS),
+    CASE(int_add_steal, UNIT_LIMBS),
+    CASE(int_sub_steal, UNIT_LIMBS),
+    CASE(int_mul_steal, UNIT_LIMBS),
+    CASE(int_negate_steal, UNIT_LIMBS),
+    CASE(int_conj_steal, UNIT_LIMBS),
+
+    CASE(frac_from_ints, UNIT_NONE),
+    CASE(frac_from_df, UNIT_LIMBS),
+    CASE(frac_zero, UNIT_NONE),
+    CASE(frac_one, UNIT_NONE),
+    CASE(frac_i, UNIT_NONE),
+    CASE(frac_neg_one, UNIT_NONE),
+    CASE(frac_neg_i, UNIT_NONE),
+    CASE(frac_retain_release, UNIT_LIMBS),
+    CASE(frac_is_immortal, UNIT_LIMBS),
+    CASE(frac_copy, UNIT_LIMBS),
+    CASE(frac_add, UNIT_LIMBS),
+    CASE(frac_sub, UNIT_LIMBS),
+    CASE(frac_mul, UNIT_LIMBS),
+    CASE(frac_div, UNIT_LIMBS),
+    CASE(frac_negate, UNIT_LIMBS),
+    CASE(frac_conj, UNIT_LIMBS),
+    CASE(frac_norm, UNIT_LIMBS),
+    CASE(frac_pow, UNIT_LIMBS),
+    CASE(frac_reciprocal, UNIT_LIMBS),
+    CASE(frac_lazy, UNIT_LIMBS),
+    CASE(frac_lazy_add, UNIT_LIMBS),
+    CASE(frac_normalize, UNIT_LIMBS),
+    CASE(frac_is_lazy, UNIT_LIMBS),
+    CASE(frac_real, UNIT_LIMBS),
+    CASE(frac_imag, UNIT_LIMBS),
+    CASE(frac_eq, UNIT_LIMBS),
+    CASE(frac_compare_abs, UNIT_LIMBS),
+    CASE(frac_is_zero, UNIT_LIMBS),
+    CASE(frac_is_real, UNIT_LIMBS),
+    CASE(frac_is_imag, UNIT_LIMBS),
+    CASE(frac_is_gaussian_int, UNIT_LIMBS),
+    CASE(frac_to_string, UNIT_LIMBS),
+    CASE(frac_serial_round_trip, UNIT_LIMBS),
+    CASE(frac_add_into, UNIT_LIMBS),
+    CASE(frac_sub_into, UNIT_LIMBS),
+    CASE(frac_mul_into, UNIT_LIMBS),
+    CASE(frac_div_into, UNIT_LIMBS),
+    CASE(frac_negate_into, UNIT_LIMBS),
+    CASE(frac_conj_into, UNIT_LIMBS),
+    CASE(frac_reciprocal_into, UNIT_LIMBS),
+    CASE(frac_add_steal, UNIT_LIMBS),
+    CASE(frac_sub_steal, UNIT_LIMBS),
+    CASE(frac_mul_steal, UNIT_LIMBS),
+    CASE(frac_div_steal, UNIT_LIMBS),
+    CASE(frac_negate_steal, UNIT_LIMBS),
+    CASE(frac_conj_steal, UNIT_LIMBS),
+    CASE(frac_reciprocal_steal, UNIT_LIMBS),
+
+    CASE(cfrac_from_di, UNIT_LIMBS),
+    CASE(cfrac_from_ints, UNIT_NONE),
+    CASE(cfrac_retain_release, UNIT_LIMBS),
+    CASE(cfrac_is_immortal, UNIT_LIMBS),
+    CASE(cfrac_add, UNIT_LIMBS),
+    CASE(cfrac_sub, UNIT_LIMBS),
+    CASE(cfrac_mul, UNIT_LIMBS),
+    CASE(cfrac_div, UNIT_LIMBS),
+    CASE(cfrac_negate, UNIT_LIMBS),
+    CASE(cfrac_conj, UNIT_LIMBS),
+    CASE(cfrac_norm, UNIT_LIMBS),
+    CASE(cfrac_numerator, UNIT_LIMBS),
+    CASE(cfrac_denominator, UNIT_LIMBS),
+    CASE(cfrac_eq, UNIT_LIMBS),
+    CASE(cfrac_is_zero, UNIT_LIMBS),
+    CASE(cfrac_to_string, UNIT_LIMBS),
+    CASE(cfrac_serial_round_trip, UNIT_LIMBS),
+
+    CASE(double_from_doubles, UNIT_NONE),
+    CASE(double_from_polar, UNIT_NONE),
+    CASE(double_from_value, UNIT_NONE),
+    CASE(double_zero, UNIT_NONE),
+    CASE(double_one, UNIT_NONE),
+    CASE(double_i, UNIT_NONE),
+    CASE(double_neg_one, UNIT_NONE),
+    CASE(double_neg_i, UNIT_NONE),
+    CASE(double_retain_release, UNIT_NONE),
+    CASE(double_is_immortal, UNIT_NONE),
+    CASE(double_copy, UNIT_NONE),
+    CASE(double_add, UNIT_NONE),
+    CASE(double_sub, UNIT_NONE),
+    CASE(double_mul, UNIT_NONE),
+    CASE(double_div, UNIT_NONE),
+    CASE(double_negate, UNIT_NONE),
+    CASE(double_conj, UNIT_NONE),
+    CASE(double_exp, UNIT_NONE),
+    CASE(double_log, UNIT_NONE),
+    CASE(double_pow, UNIT_NONE),
+    CASE(double_sqrt, UNIT_NONE),
+    CASE(double_sin, UNIT_NONE),
+    CASE(double_cos, UNIT_NONE),
+    CASE(double_tan, UNIT_NONE),
+    CASE(double_sinh, UNIT_NONE),
+    CASE(double_cosh, UNIT_NONE),
+    CASE(double_tanh, UNIT_NONE),
+    CASE(double_real, UNIT_NONE),
+    CASE(double_imag, UNIT_NONE),
+    CASE(double_value, UNIT_NONE),
+    CASE(double_abs, UNIT_NONE),
+    CASE(double_arg, UNIT_NONE),
+    CASE(double_eq, UNIT_NONE),
+    CASE(double_is_zero, UNIT_NONE),
+    CASE(double_is_real, UNIT_NONE),
+    CASE(double_is_imag, UNIT_NONE),
+    CASE(double_is_nan, UNIT_NONE),
+    CASE(double_is_inf, UNIT_NONE),
+    CASE(double_to_string, UNIT_NONE),
+    CASE(double_serial_round_trip, UNIT_NONE),
+    CASE(double_add_into, UNIT_NONE),
+    CASE(double_sub_into, UNIT_NONE),
+    CASE(double_mul_into, UNIT_NONE),
+    CASE(double_div_into, UNIT_NONE),
+    CASE(double_negate_into, UNIT_NONE),
+    CASE(double_conj_into, UNIT_NONE),
+    CASE(double_add_steal, UNIT_NONE),
+    CASE(double_sub_steal, UNIT_NONE),
+    CASE(double_mul_steal, UNIT_NONE),
+    CASE(double_div_steal, UNIT_NONE),
+    CASE(double_negate_steal, UNIT_NONE),
+    CASE(double_conj_steal, UNIT_NONE),
+
+    CASE(int_to_frac, UNIT_LIMBS),
+    CASE(int_to_double, UNIT_LIMBS),
+    CASE(frac_to_double, UNIT_LIMBS),
+    CASE(frac_to_int, UNIT_LIMBS),
+    CASE(frac_to_cfrac, UNIT_LIMBS),
+    CASE(cfrac_to_frac, UNIT_LIMBS),
+    CASE(double_to_int, UNIT_NONE),
+    CASE(double_to_frac, UNIT_NONE),
+
+    CASE(array_new, UNIT_ELEMENTS),
+    CASE(array_from_values, UNIT_ELEMENTS),
+    CASE(array_from_parts, UNIT_ELEMENTS),
+    CASE(array_copy, UNIT_ELEMENTS),
+    CASE(array_get, UNIT_ELEMENTS),
+    CASE(array_set, UNIT_ELEMENTS),
+    CASE(array_to_values, UNIT_ELEMENTS),
+    CASE(array_add, UNIT_ELEMENTS),
+    CASE(array_sub, UNIT_ELEMENTS),
+    CASE(array_mul, UNIT_ELEMENTS),
+    CASE(array_div, UNIT_ELEMENTS),
+    CASE(array_conj, UNIT_ELEMENTS),
+    CASE(array_add_into, UNIT_ELEMENTS),
+    CASE(array_sub_into, UNIT_ELEMENTS),
+    CASE(array_mul_into, UNIT_ELEMENTS),
+    CASE(array_div_into, UNIT_ELEMENTS),
+    CASE(array_conj_into, UNIT_ELEMENTS),
+    CASE(array_abs, UNIT_ELEMENTS),
+    CASE(array_arg, UNIT_ELEMENTS),
+    CASE(array_exp, UNIT_ELEMENTS),
+    CASE(array_log, UNIT_ELEMENTS),
+    CASE(array_sin, UNIT_ELEMENTS),
+    CASE(array_cos, UNIT_ELEMENTS),
+    CASE(array_sqrt, UNIT_ELEMENTS),
+    CASE(array_exp_into, UNIT_ELEMENTS),
+    CASE(array_log_into, UNIT_ELEMENTS),
+    CASE(array_sin_into, UNIT_ELEMENTS),
+    CASE(array_cos_into, UNIT_ELEMENTS),
+    CASE(array_sqrt_into, UNIT_ELEMENTS),
+    CASE(fft_plan_new, UNIT_ELEMENTS),
+    CASE(fft_forward, UNIT_ELEMENTS),
+    CASE(fft_inverse, UNIT_ELEMENTS),
+    CASE(fft_forward_values, UNIT_ELEMENTS),
+    CASE(fft_inverse_values, UNIT_ELEMENTS),
+    CASE(fft_real_forward, UNIT_ELEMENTS),
+    CASE(fft_real_inverse, UNIT_ELEMENTS),
+    CASE(array_fft, UNIT_ELEMENTS),
+    CASE(array_ifft, UNIT_ELEMENTS),
+    CASE(array_fft_into, UNIT_ELEMENTS),
+    CASE(array_ifft_into, UNIT_ELEMENTS),
+    CASE(int_poly_mul, UNIT_ELEMENTS),
+};
+
+#define CASE_COUNT (sizeof(cases) / sizeof(cases[0]))
+
+// ============================================================================
+// DRIVER
+// ============================================================================
+
+static bench_row rows[BENCH_MAX_ROWS];
+static size_t row_count = 0;
+
+// Repeat for at least the given time (and at least once); allocations are counted over the same calls
+static bench_row measure(const bench_case* c, bench_operands* o, double seconds) {
+    c->run(o);  // warm caches, plan caches and destination nodes
+
+    size_t iterations = 0;
+    size_t allocations = bench_allocations;
+    double start = now_seconds(), elapsed;
+    do {
+        c->run(o);
+        iterations++;
+    } while ((elapsed = now_seconds() - start) < seconds);
+
+    bench_row row = {c->name, c->unit, c->unit == UNIT_NONE ? 0 : o->size,
+                     elapsed / (double)iterations * 1e9,
+                     (double)(bench_allocations - allocations) / (double)iterations, iterations};
+    return row;
+}
+
+static void write_csv(const char* path, const char* label) {
+    FILE* out = fopen(path, "w");
+    if (!out) {
+        fprintf(stderr, "bench: cannot write %s\n", path);
+        exit(1);
+    }
+    fprintf(out, "label,function,unit,size,ns_per_op,allocs_per_op,iterations\n");
+    for (size_t r = 0; r < row_count; r++) {
+        fprintf(out, "%s,%s,%s,%zu,%.2f,%.3f,%zu\n", label, rows[r].name, unit_names[rows[r].unit], rows[r].size,
+                rows[r].ns_per_op, rows[r].allocs_per_op, rows[r].iterations);
+    }
+    fclose(out);
+}
+
+static void write_json(const char* path, const char* label) {
+    FILE* out = fopen(path, "w");
+    if (!out) {
+        fprintf(stderr, "bench: cannot write %s\n", path);
+        exit(1);
+    }
+    fprintf(out, "{\n  \"label\": \"%s\",\n  \"simd\": \"%s\",\n  \"results\": [\n", label,
+            dc_double_array_simd_level());
+    for (size_t r = 0; r < row_count; r++) {
+        fprintf(out,
+                "    {\"function\": \"%s\", \"unit\": \"%s\", \"size\": %zu, \"ns_per_op\": %.2f, "
+                "\"allocs_per_op\": %.3f, \"iterations\": %zu}%s\n",
+                rows[r].name, unit_names[rows[r].unit], rows[r].size, rows[r].ns_per_op, rows[r].allocs_per_op,
+                rows[r].iterations, r + 1 < row_count ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+    fclose(out);
+}
+
+static void usage(void) {
+    fprintf(stderr,
+            "usage: bench [--csv FILE] [--json FILE] [--label TEXT] [--filter TEXT] [--max-size N] [--seconds S]\n");
+    exit(2);
+}
+
+int main(int argc, char** argv) {
+    const char* csv_path = NULL;
+    const char* json_path = NULL;
+    const char* label = "";
+    const char* filter = NULL;
+    size_t max_size = SIZE_MAX;
+    double seconds = 0.02;
+
+    for (int a = 1; a < argc; a++) {
+        if (a + 1 >= argc) usage();
+        if (strcmp(argv[a], "--csv") == 0) {
+            csv_path = argv[++a];
+        } else if (strcmp(argv[a], "--json") == 0) {
+            json_path = argv[++a];
+        } else if (strcmp(argv[a], "--label") == 0) {
+            label = argv[++a];
+        } else if (strcmp(argv[a], "--filter") == 0) {
+            filter = argv[++a];
+        } else if (strcmp(argv[a], "--max-size") == 0) {
+            max_size = (size_t)strtoull(argv[++a], NULL, 10);
+        } else if (strcmp(argv[a], "--seconds") == 0) {
+            seconds = strtod(argv[++a], NULL);
+        } else {
+            usage();
+        }
+    }
+    srand(12345);
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    bool skipped[CASE_COUNT] = {false};
+    printf("%-28s %9s %8s %14s %10s\n", "function", "unit", "size", "ns/op", "allocs/op");
+
+    // Size-major order, so each operand set is built once
+    for (bench_unit unit = UNIT_NONE; unit <= UNIT_ELEMENTS; unit++) {
+        const size_t* sizes = unit == UNIT_ELEMENTS ? element_sizes : limb_sizes;
+        size_t size_count = unit == UNIT_NONE ? 1
+                            : unit == UNIT_LIMBS ? sizeof(limb_sizes) / sizeof(limb_sizes[0])
+                                                 : sizeof(element_sizes) / sizeof(element_sizes[0]);
+
+        for (size_t s = 0; s < size_count; s++) {
+            size_t size = sizes[s];
+            if (unit != UNIT_NONE && size > max_size) break;
+
+            bench_operands operands;
+            operands_build(&operands, unit, size);
+            for (size_t k = 0; k < CASE_COUNT; k++) {
+                const bench_case* c = &cases[k];
+                if (c->unit != unit || skipped[k]) continue;
+                if (filter && !strstr(c->name, filter)) continue;
+                if (c->max_size && size > c->max_size) continue;
+
+                bench_row row = measure(c, &operands, seconds);
+                if (row.ns_per_op > BENCH_MAX_OP_MS * 1e6) skipped[k] = true;
+                if (row_count < BENCH_MAX_ROWS) rows[row_count++] = row;
+                printf("%-28s %9s %8zu %14.1f %10.2f\n", row.name, unit_names[unit], row.size, row.ns_per_op,
+                       row.allocs_per_op);
+            }
+            operands_release(&operands);
+        }
+    }
+
+    if (csv_path) write_csv(csv_path, label);
+    if (json_path) write_json(json_path, label);
+    return 0;
+}
@@ -0,0 +1,241 @@
+/**
+ * @file bench_refcount.c
+ * @brief Contention benchmark for atomic reference counting
+ *
+ * Runs retain/release pairs and additions at 1..N threads on operands that
+ * every thread shares, on operands each thread creates for itself, and on a
+ * shared operand made immortal, for dc_complex_int, dc_complex_frac and
+ * dc_complex_double. Reports aggregate millions of operations per second and
+ * the scaling efficiency against one thread (1.00 means N threads do N times
+ * the work of one).
+ *
+ * The reference counting mode is fixed at compile time, so the benchmark is
+ * built twice: bench_refcount with DC_ATOMIC_REFCOUNT, and
+ * bench_refcount_biased with DC_BIASED_REFCOUNT on top.
+ *
+ * Build: cmake --build build --target bench_refcount bench_refcount_biased
+ * Run:   ./build/bench_refcount [max threads]
+ */
+
+#define DI_IMPLEMENTATION
+#define DF_IMPLEMENTATION
+#define DC_IMPLEMENTATION
+#include "dynamic_complex.h"
+
+#if !DC_ATOMIC_REFCOUNT
+    #error "bench_refcount shares values across threads and needs DC_ATOMIC_REFCOUNT"
+#endif
+
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BENCH_MAX_THREADS 256
+#define BENCH_RETAIN_ITERATIONS 2000000
+#define BENCH_ADD_ITERATIONS 200000
+
+#if DC_BIASED_REFCOUNT
+#define BENCH_MODE "DC_BIASED_REFCOUNT"
+#else
+#define BENCH_MODE "DC_ATOMIC_REFCOUNT"
+#endif
+
+// One family of values behind a type-erased interface, so every workload runs on all three
+typedef struct {
+    const char* name;
+    void* (*create)(int64_t seed);
+    void (*make_immortal)(void* value);
+    void (*release)(void* value);
+    void (*retain_release)(void* value);
+    void (*add)(void* a, void* b);
+} value_ops;
+
+static void* int_create(int64_t seed) {
+    return dc_int_from_ints(seed, seed + 1);
+}
+
+static void int_make_immortal(void* value) {
+    dc_int_make_immortal(value);
+}
+
+static void int_release(void* value) {
+    dc_complex_int c = value;
+    dc_int_release(&c);
+}
+
+static void int_retain_release(void* value) {
+    dc_complex_int c = dc_int_retain(value);
+    dc_int_release(&c);
+}
+
+static void int_add(void* a, void* b) {
+    dc_complex_int sum = dc_int_add(a, b);
+    dc_int_release(&sum);
+}
+
+static void* frac_create(int64_t seed) {
+    return dc_frac_from_ints(seed, 3, seed + 1, 7);
+}
+
+static void frac_make_immortal(void* value) {
+    dc_frac_make_immortal(value);
+}
+
+static void frac_release(void* value) {
+    dc_complex_frac c = value;
+    dc_frac_release(&c);
+}
+
+static void frac_retain_release(void* value) {
+    dc_complex_frac c = dc_frac_retain(value);
+    dc_frac_release(&c);
+}
+
+static void frac_add(void* a, void* b) {
+    dc_complex_frac sum = dc_frac_add(a, b);
+    dc_frac_release(&sum);
+}
+
+static void* double_create(int64_t seed) {
+    return dc_double_from_doubles((double)seed, (double)seed + 0.5);
+}
+
+static void double_make_immortal(void* value) {
+    dc_double_make_immortal(value);
+}
+
+static void double_release(void* value) {
+    dc_complex_double c = value;
+    dc_double_release(&c);
+}
+
+static void double_retain_release(void* value) {
+    dc_complex_double c = dc_double_retain(value);
+    dc_double_release(&c);
+}
+
+static void double_add(void* a, void* b) {
+    dc_complex_double sum = dc_double_add(a, b);
+    dc_double_release(&sum);
+}
+
+static const value_ops families[] = {
+    {"dc_complex_int", int_create, int_make_immortal, int_release, int_retain_release, int_add},
+    {"dc_complex_frac", frac_create, frac_make_immortal, frac_release, frac_retain_release, frac_add},
+    {"dc_complex_double", double_create, double_make_immortal, double_release, double_retain_release, double_add},
+};
+
+typedef enum { OPERAND_SHARED, OPERAND_PRIVATE, OPERAND_IMMORTAL, OPERAND_MODES } operand_mode;
+
+static const char* const operand_names[OPERAND_MODES] = {"shared", "private", "immortal"};
+
+typedef struct {
+    const value_ops* ops;
+    bool arithmetic;
+    void* shared;  // NULL: the worker creates its own operand
+    size_t iterations;
+    int64_t seed;
+} worker_task;
+
+static atomic_int ready_count;
+static atomic_bool start_flag;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void* worker_main(void* arg) {
+    worker_task* task = arg;
+    // Private operands are created on the worker so that, in biased mode, the worker owns them
+    void* operand = task->shared ? task->shared : task->ops->create(task->seed);
+
+    atomic_fetch_add(&ready_count, 1);
+    while (!atomic_load_explicit(&start_flag, memory_order_acquire)) {
+    }
+
+    if (task->arithmetic) {
+        for (size_t k = 0; k < task->iterations; k++) task->ops->add(operand, operand);
+    } else {
+        for (size_t k = 0; k < task->iterations; k++) task->ops->retain_release(operand);
+    }
+
+    if (!task->shared) task->ops->release(operand);
+    dc_refcount_flush();
+    return NULL;
+}
+
+// Millions of operations per second over all threads, from the start signal to the last join
+static double run_threads(const value_ops* ops, bool arithmetic, operand_mode mode, size_t threads) {
+    static pthread_t handles[BENCH_MAX_THREADS];
+    static worker_task tasks[BENCH_MAX_THREADS];
+    size_t iterations = arithmetic ? BENCH_ADD_ITERATIONS : BENCH_RETAIN_ITERATIONS;
+
+    void* shared = NULL;
+    if (mode != OPERAND_PRIVATE) {
+        shared = ops->create(7);
+        if (mode == OPERAND_IMMORTAL) ops->make_immortal(shared);
+    }
+
+    atomic_store(&ready_count, 0);
+    atomic_store(&start_flag, false);
+    for (size_t t = 0; t < threads; t++) {
+        tasks[t] = (worker_task){ops, arithmetic, shared, iterations, (int64_t)t + 11};
+        if (pthread_create(&handles[t], NULL, worker_main, &tasks[t]) != 0) {
+            fprintf(stderr, "bench_refcount: cannot start thread %zu\n", t);
+            exit(1);
+        }
+    }
+    while (atomic_load(&ready_count) < (int)threads) {
+    }
+
+    double start = now_seconds();
+    atomic_store_explicit(&start_flag, true, memory_order_release);
+    for (size_t t = 0; t < threads; t++) pthread_join(handles[t], NULL);
+    double elapsed = now_seconds() - start;
+
+    // Immortal operands are never freed
+    if (mode == OPERAND_SHARED) ops->release(shared);
+    return (double)(iterations * threads) / elapsed * 1e-6;
+}
+
+static void run_workload(const value_ops* ops, bool arithmetic, const size_t* thread_counts, size_t count) {
+    double single[OPERAND_MODES];
+
+    printf("\n%s %s (%s)\n", ops->name, arithmetic ? "add" : "retain/release", BENCH_MODE);
+    printf("%7s", "threads");
+    for (int m = 0; m < OPERAND_MODES; m++) printf("  %9s Mops/s   eff", operand_names[m]);
+    printf("\n");
+
+    for (size_t c = 0; c < count; c++) {
+        size_t threads = thread_counts[c];
+        printf("%7zu", threads);
+        for (int m = 0; m < OPERAND_MODES; m++) {
+            double rate = run_threads(ops, arithmetic, (operand_mode)m, threads);
+            if (threads == 1) single[m] = rate;
+            printf("  %16.2f %5.2f", rate, rate / (single[m] * (double)threads));
+        }
+        printf("\n");
+    }
+}
+
+int main(int argc, char** argv) {
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t max_threads = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : (online > 0 ? (size_t)online : 1);
+    if (max_threads < 1) max_threads = 1;
+    if (max_threads > BENCH_MAX_THREADS) max_threads = BENCH_MAX_THREADS;
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    // Powers of two up to the limit, then the limit itself
+    size_t thread_counts[16], count = 0;
+    for (size_t t = 1; t < max_threads && count < 15; t *= 2) thread_counts[count++] = t;
+    thread_counts[count++] = max_threads;
+
+    printf("Reference counting contention, %s, up to %zu threads\n", BENCH_MODE, max_threads);
+    for (size_t f = 0; f < sizeof(families) / sizeof(families[0]); f++) {
+        run_workload(&families[f], false, thread_counts, count);
+        run_workload(&families[f], true, thread_counts, count);
+    }
+    return 0;
+}
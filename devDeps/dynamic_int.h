@@ -939,12 +939,12 @@ DI_DEF di_int di_random_range(di_int min, di_int max);
  * @param a First operand
  * @param b Second operand
  * @param result Pointer to store result
- * @return true if addition overflowed, false if safe
+ * @return true if the addition fit (result stored), false if it overflowed (result untouched)
  * @since 1.0.0
  * 
  * @code
  * int32_t result;
- * if (di_add_overflow_int32(INT32_MAX, 1, &result)) {
+ * if (!di_add_overflow_int32(INT32_MAX, 1, &result)) {
  *     // Overflow occurred, use big integer arithmetic
  *     di_int a = di_from_int32(INT32_MAX);
  *     di_int b = di_from_int32(1);
@@ -960,7 +960,7 @@ DI_DEF bool di_add_overflow_int32(int32_t a, int32_t b, int32_t* result);
  * @param a Minuend
  * @param b Subtrahend
  * @param result Pointer to store result
- * @return true if subtraction overflowed, false if safe
+ * @return true if the subtraction fit (result stored), false if it overflowed (result untouched)
  * @since 1.0.0
  */
 DI_DEF bool di_subtract_overflow_int32(int32_t a, int32_t b, int32_t* result);
@@ -970,7 +970,7 @@ DI_DEF bool di_subtract_overflow_int32(int32_t a, int32_t b, int32_t* result);
  * @param a First operand
  * @param b Second operand
  * @param result Pointer to store result
- * @return true if multiplication overflowed, false if safe
+ * @return true if the multiplication fit (result stored), false if it overflowed (result untouched)
  * @since 1.0.0
  */
 DI_DEF bool di_multiply_overflow_int32(int32_t a, int32_t b, int32_t* result);
@@ -980,7 +980,7 @@ DI_DEF bool di_multiply_overflow_int32(int32_t a, int32_t b, int32_t* result);
  * @param a First operand
  * @param b Second operand
  * @param result Pointer to store result
- * @return true if addition overflowed, false if safe
+ * @return true if the addition fit (result stored), false if it overflowed (result untouched)
  * @since 1.0.0
  */
 DI_DEF bool di_add_overflow_int64(int64_t a, int64_t b, int64_t* result);
@@ -990,7 +990,7 @@ DI_DEF bool di_add_overflow_int64(int64_t a, int64_t b, int64_t* result);
  * @param a Minuend
  * @param b Subtrahend
  * @param result Pointer to store result
- * @return true if subtraction overflowed, false if safe
+ * @return true if the subtraction fit (result stored), false if it overflowed (result untouched)
  * @since 1.0.0
  */
 DI_DEF bool di_subtract_overflow_int64(int64_t a, int64_t b, int64_t* result);
@@ -1000,7 +1000,7 @@ DI_DEF bool di_subtract_overflow_int64(int64_t a, int64_t b, int64_t* result);
  * @param a First operand
  * @param b Second operand
  * @param result Pointer to store result
- * @return true if multiplication overflowed, false if safe
+ * @return true if the multiplication fit (result stored), false if it overflowed (result untouched)
  * @since 1.0.0
  */
 DI_DEF bool di_multiply_overflow_int64(int64_t a, int64_t b, int64_t* result);
@@ -19,6 +19,21 @@
  * #define DC_FREE free             // custom deallocator
  * #define DC_ASSERT assert         // custom assert macro
  * #define DC_ATOMIC_REFCOUNT 1     // enable atomic reference counting (requires C11)
+ * #define DC_BIASED_REFCOUNT 1     // non-atomic counts for the creating thread (requires DC_ATOMIC_REFCOUNT)
+ * #define DC_POOL_DOUBLE 1         // pool dc_complex_double nodes in thread-local freelists (requires C11)
+ * #define DC_POOL_SLAB_NODES 256   // nodes carved from each pool slab
+ * #define DC_ARENA 1               // enable dc_arena_begin()/dc_arena_end() scopes (requires C11)
+ * #define DC_ARENA_CHUNK_SIZE 65536 // bytes per arena chunk
+ * #define DC_STATS 1               // count allocations, live values and di_mul/di_gcd calls (requires C11)
+ * #define DC_TRACK_ALLOCS 1        // attribute live values to their call sites for dc_track_dump() (requires C11)
+ * #define DC_TRACK_SITES 4096      // distinct call sites recorded by DC_TRACK_ALLOCS
+ * #define DC_SIMD 0                // force scalar dc_double_array kernels
+ * #define DC_MMAP 0                // read files in dc_double_array_map() instead of mapping them
+ * #define DC_POLY_NTT_THRESHOLD 8  // shortest operand multiplied with NTTs in dc_int_poly_mul
+ * #define DC_GAUSS_MUL_THRESHOLD 24 // limbs from which dc_int_mul uses three multiplications
+ * #define DC_FRAC_LAZY_MAX_BITS 1024 // component size that forces a reduction in lazy dc_frac arithmetic
+ * #define DC_LEHMER_GCD_THRESHOLD 1 // limbs from which dc_int_gcd/xgcd use Lehmer rounds
+ * #define DC_PRIME_SIEVE_LIMIT 65536 // primes below this come from the dc_int_is_prime/factor sieve table
  *
  * #define DC_IMPLEMENTATION
  * #include "dynamic_complex.h"
@@ -59,8 +74,10 @@
 #define DYNAMIC_COMPLEX_H
 
 #include <stdint.h>
+#include <inttypes.h>
 #include <stddef.h>
 #include <stdbool.h>
+#include <limits.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -72,6 +89,10 @@
 #define DC_MALLOC malloc
 #endif
 
+#ifndef DC_REALLOC
+#define DC_REALLOC realloc
+#endif
+
 #ifndef DC_FREE
 #define DC_FREE free
 #endif
@@ -97,12 +118,161 @@
     #define DC_ATOMIC_FETCH_SUB(ptr, val) atomic_fetch_sub(ptr, val)
     #define DC_ATOMIC_LOAD(ptr) atomic_load(ptr)
     #define DC_ATOMIC_STORE(ptr, val) atomic_store(ptr, val)
+    #define DC_ATOMIC_LOAD_RELAXED(ptr) atomic_load_explicit(ptr, memory_order_relaxed)
+    #define DC_ATOMIC_PTR(type) _Atomic(type)
+    #define DC_ATOMIC_LOAD_ACQUIRE(ptr) atomic_load_explicit(ptr, memory_order_acquire)
+    #define DC_ATOMIC_CAS_PTR(ptr, expected, desired) atomic_compare_exchange_strong(ptr, expected, desired)
 #else
     #define DC_ATOMIC_SIZE_T size_t
     #define DC_ATOMIC_FETCH_ADD(ptr, val) (*(ptr) += (val), *(ptr) - (val))
     #define DC_ATOMIC_FETCH_SUB(ptr, val) (*(ptr) -= (val), *(ptr) + (val))
     #define DC_ATOMIC_LOAD(ptr) (*(ptr))
     #define DC_ATOMIC_STORE(ptr, val) (*(ptr) = (val))
+    #define DC_ATOMIC_LOAD_RELAXED(ptr) (*(ptr))
+    #define DC_ATOMIC_PTR(type) type
+    #define DC_ATOMIC_LOAD_ACQUIRE(ptr) (*(ptr))
+    #define DC_ATOMIC_CAS_PTR(ptr, expected, desired) \
+        (*(ptr) == *(expected) ? (*(ptr) = (desired), true) : (*(expected) = *(ptr), false))
+#endif
+
+/*
+ * Reference counts at or above DC_REFCOUNT_IMMORTAL mark immortal objects
+ * (the constants returned by dc_int_zero() and friends, and values passed to
+ * dc_*_make_immortal()). Retain and release check the count with a plain load
+ * and never write it, so shared constants cost no atomic read-modify-write
+ * and are never freed.
+ */
+#define DC_REFCOUNT_IMMORTAL (SIZE_MAX / 2 + 1)
+
+/* Biased reference counting configuration */
+#ifndef DC_BIASED_REFCOUNT
+#define DC_BIASED_REFCOUNT 0
+#endif
+
+#if DC_BIASED_REFCOUNT && !DC_ATOMIC_REFCOUNT
+    #error "DC_BIASED_REFCOUNT requires DC_ATOMIC_REFCOUNT"
+#endif
+
+/* Threads hand their biased counts over when they exit, through a thread-specific key on POSIX systems */
+#if DC_BIASED_REFCOUNT && (defined(__unix__) || defined(__APPLE__))
+    #include <pthread.h>
+#endif
+
+/* Pooled allocation configuration */
+#ifndef DC_POOL_DOUBLE
+#define DC_POOL_DOUBLE 0
+#endif
+
+#ifndef DC_POOL_SLAB_NODES
+#define DC_POOL_SLAB_NODES 256
+#endif
+
+#if DC_POOL_DOUBLE && __STDC_VERSION__ < 201112L
+    #error "DC_POOL_DOUBLE requires C11 or later for thread-local storage (compile with -std=c11 or later)"
+#endif
+
+#if DC_POOL_DOUBLE
+    #include <stdatomic.h>
+#endif
+
+/* Arena allocation configuration */
+#ifndef DC_ARENA
+#define DC_ARENA 0
+#endif
+
+#ifndef DC_ARENA_CHUNK_SIZE
+#define DC_ARENA_CHUNK_SIZE 65536
+#endif
+
+#if DC_ARENA && __STDC_VERSION__ < 201112L
+    #error "DC_ARENA requires C11 or later for thread-local storage (compile with -std=c11 or later)"
+#endif
+
+/* Allocation and operation counters */
+#ifndef DC_STATS
+#define DC_STATS 0
+#endif
+
+#if DC_STATS && __STDC_VERSION__ < 201112L
+    #error "DC_STATS requires C11 or later for thread-local counters (compile with -std=c11 or later)"
+#endif
+
+#if DC_STATS
+    #include <stdatomic.h>
+#endif
+
+/* Leak tracking by allocation site */
+#ifndef DC_TRACK_ALLOCS
+#define DC_TRACK_ALLOCS 0
+#endif
+
+#ifndef DC_TRACK_SITES
+#define DC_TRACK_SITES 4096
+#endif
+
+#if DC_TRACK_ALLOCS && __STDC_VERSION__ < 201112L
+    #error "DC_TRACK_ALLOCS requires C11 or later for atomic site counters (compile with -std=c11 or later)"
+#endif
+
+#if DC_TRACK_ALLOCS
+    #include <stdatomic.h>
+#endif
+
+/* Vectorized array kernels (runtime dispatched on x86 with GCC/clang) */
+#ifndef DC_SIMD
+#define DC_SIMD 1
+#endif
+
+/* dc_double_array_map() views files with mmap on POSIX systems and reads them into memory elsewhere */
+#ifndef DC_MMAP
+    #if defined(__unix__) || defined(__APPLE__)
+        #define DC_MMAP 1
+    #else
+        #define DC_MMAP 0
+    #endif
+#endif
+
+/* Complex multiplication switches to Gauss's three-multiplication form at these operand sizes (in limbs).
+ * Measured with bench/bench_mul.c; fractions never win (each extra addition costs a gcd), so it is off by default. */
+#ifndef DC_GAUSS_MUL_THRESHOLD
+#define DC_GAUSS_MUL_THRESHOLD 24
+#endif
+
+#ifndef DC_GAUSS_FRAC_MUL_THRESHOLD
+#define DC_GAUSS_FRAC_MUL_THRESHOLD SIZE_MAX
+#endif
+
+/* Gaussian integer gcds switch to Lehmer rounds on leading bits from this operand size (in limbs) */
+#ifndef DC_LEHMER_GCD_THRESHOLD
+#define DC_LEHMER_GCD_THRESHOLD 1
+#endif
+
+/* dc_int_is_prime/dc_int_factor look rational primes below this up in a sieve table built on first use
+ * (one bit per odd number) and trial-divide norms by them */
+#ifndef DC_PRIME_SIEVE_LIMIT
+#define DC_PRIME_SIEVE_LIMIT 65536
+#endif
+
+#if DC_PRIME_SIEVE_LIMIT < 64 || DC_PRIME_SIEVE_LIMIT > 0x7fffffff
+    #error "DC_PRIME_SIEVE_LIMIT must be between 64 and 2^31 - 1"
+#endif
+
+/* Lazy dc_complex_frac components are reduced once a numerator or denominator exceeds this many bits */
+#ifndef DC_FRAC_LAZY_MAX_BITS
+#define DC_FRAC_LAZY_MAX_BITS 1024
+#endif
+
+/* Polynomial products switch from schoolbook to NTT at this operand length */
+#ifndef DC_POLY_NTT_THRESHOLD
+#define DC_POLY_NTT_THRESHOLD 8
+#endif
+
+#ifndef DC_THREAD_LOCAL
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #define DC_THREAD_LOCAL __declspec(thread)
+    #else
+        #define DC_THREAD_LOCAL _Thread_local
+    #endif
 #endif
 
 /* API macros */
@@ -114,8 +284,72 @@
 #define DC_DEF /* nothing - default linkage */
 #endif
 
+/* Route dependency allocations through the arena */
+#if DC_ARENA
+    #if defined(DYNAMIC_INT_H) || defined(DYNAMIC_FRACTION_H)
+        #error "DC_ARENA: include dynamic_complex.h before dynamic_int.h and dynamic_fraction.h"
+    #endif
+
+    DC_DEC void* dc_arena_malloc(size_t size);
+    DC_DEC void* dc_arena_realloc(void* ptr, size_t size);
+    DC_DEC void dc_arena_free(void* ptr);
+
+    #ifndef DI_MALLOC
+    #define DI_MALLOC dc_arena_malloc
+    #endif
+    #ifndef DI_REALLOC
+    #define DI_REALLOC dc_arena_realloc
+    #endif
+    #ifndef DI_FREE
+    #define DI_FREE dc_arena_free
+    #endif
+    #ifndef DF_MALLOC
+    #define DF_MALLOC dc_arena_malloc
+    #endif
+    #ifndef DF_FREE
+    #define DF_FREE dc_arena_free
+    #endif
+#endif
+
+/* Count dependency allocations (the arena, when enabled, counts its own heap chunks instead) */
+#if DC_STATS
+    DC_DEC void* dc_stats_malloc(size_t size);
+    DC_DEC void* dc_stats_realloc(void* ptr, size_t size);
+    DC_DEC void dc_stats_free(void* ptr);
+
+    #ifndef DI_MALLOC
+    #define DI_MALLOC dc_stats_malloc
+    #endif
+    #ifndef DI_REALLOC
+    #define DI_REALLOC dc_stats_realloc
+    #endif
+    #ifndef DI_FREE
+    #define DI_FREE dc_stats_free
+    #endif
+    #ifndef DF_MALLOC
+    #define DF_MALLOC dc_stats_malloc
+    #endif
+    #ifndef DF_FREE
+    #define DF_FREE dc_stats_free
+    #endif
+#endif
+
 /* Include dependencies - user must ensure these are available */
 #include "dynamic_int.h"
+
+/* Count the di_mul/di_gcd calls made by dynamic_fraction and by this library (dynamic_int's internal calls
+ * are compiled above and not counted). The wrappers only exist in the implementation translation unit and
+ * are removed at the end of it, so user code calling di_mul/di_gcd is never rewritten. */
+#if DC_STATS
+    DC_DEC void dc_stats_count_di_mul(void);
+    DC_DEC void dc_stats_count_di_gcd(void);
+
+    #ifdef DC_IMPLEMENTATION
+    #define di_mul(a, b) (dc_stats_count_di_mul(), di_mul(a, b))
+    #define di_gcd(a, b) (dc_stats_count_di_gcd(), di_gcd(a, b))
+    #endif
+#endif
+
 #include "dynamic_fraction.h"
 
 // ============================================================================
@@ -134,30 +368,102 @@ typedef struct dc_complex_int_internal* dc_complex_int;
  */
 typedef struct dc_complex_frac_internal* dc_complex_frac;
 
+/**
+ * @typedef dc_complex_cfrac
+ * @brief Opaque pointer to a rational complex number over a single shared denominator
+ */
+typedef struct dc_complex_cfrac_internal* dc_complex_cfrac;
+
 /**
  * @typedef dc_complex_double
  * @brief Opaque pointer to a floating-point complex number
  */
 typedef struct dc_complex_double_internal* dc_complex_double;
 
+#if DC_BIASED_REFCOUNT
+/**
+ * @struct dc_refcount
+ * @brief Biased reference count of a dc_complex_* value
+ *
+ * The thread that created the value counts its references in local without
+ * atomics; other threads use the atomic shared count. When the owner's count
+ * drops to zero it is merged into shared, which then decides alone. Other
+ * threads that release references the owner counted queue the value on the
+ * owner, which merges it on its next allocation or dc_refcount_flush().
+ */
+typedef struct dc_refcount {
+    _Atomic intptr_t shared;          /* 4 * count | queued (2) | merged (1) */
+    size_t local;                     /* owner references; 0 once merged */
+    struct dc_refcount_owner* owner;  /* creating thread; never changes */
+    uintptr_t next;                   /* link in the owner's merge queue */
+} dc_refcount;
+#else
+/**
+ * @typedef dc_refcount
+ * @brief Reference count of a dc_complex_* value
+ */
+typedef DC_ATOMIC_SIZE_T dc_refcount;
+#endif
+
 /**
  * @struct dc_complex_int_internal
  * @brief Internal structure for a Gaussian integer
+ *
+ * Values whose components both fit in int64_t are stored inline (is_small),
+ * so small Gaussian integers cost a single allocation. Components switch to
+ * di_int only when a result overflows int64_t, and results that fit again
+ * are stored inline, so the representation of a value is always canonical.
  */
 struct dc_complex_int_internal {
-    DC_ATOMIC_SIZE_T ref_count;
-    di_int real;
-    di_int imag;
+    dc_refcount ref_count;
+    bool is_small;
+    union {
+        struct {
+            int64_t real;
+            int64_t imag;
+        } small;
+        struct {
+            di_int real;
+            di_int imag;
+        } big;
+    };
+#if DC_TRACK_ALLOCS
+    struct dc_track_site* site;  /**< Call site that created the value (DC_TRACK_ALLOCS) */
+#endif
 };
 
 /**
  * @struct dc_complex_frac_internal
  * @brief Internal structure for a rational complex number
+ *
+ * Components are in lowest terms unless the value is lazy (see dc_frac_lazy()),
+ * in which case add/sub/mul skip the gcd and only keep denominators positive.
  */
 struct dc_complex_frac_internal {
-    DC_ATOMIC_SIZE_T ref_count;
+    dc_refcount ref_count;
+    bool lazy;
     df_frac real;
     df_frac imag;
+#if DC_TRACK_ALLOCS
+    struct dc_track_site* site;  /**< Call site that created the value (DC_TRACK_ALLOCS) */
+#endif
+};
+
+/**
+ * @struct dc_complex_cfrac_internal
+ * @brief Internal structure for a common-denominator rational complex number
+ *
+ * Represents (real + imag i) / den with den > 0 and gcd(real, imag, den) = 1,
+ * so every value has exactly one representation.
+ */
+struct dc_complex_cfrac_internal {
+    dc_refcount ref_count;
+    di_int real;
+    di_int imag;
+    di_int den;
+#if DC_TRACK_ALLOCS
+    struct dc_track_site* site;  /**< Call site that created the value (DC_TRACK_ALLOCS) */
+#endif
 };
 
 /**
@@ -165,10 +471,116 @@ struct dc_complex_frac_internal {
  * @brief Internal structure for a floating-point complex number
  */
 struct dc_complex_double_internal {
-    DC_ATOMIC_SIZE_T ref_count;
+    dc_refcount ref_count;
     double complex value;
+#if DC_TRACK_ALLOCS
+    struct dc_track_site* site;  /**< Call site that created the value (DC_TRACK_ALLOCS) */
+#endif
+};
+
+/**
+ * @typedef dc_double_array
+ * @brief Opaque pointer to a structure-of-arrays buffer of floating-point complex numbers
+ */
+typedef struct dc_double_array_internal* dc_double_array;
+
+/**
+ * @struct dc_double_array_internal
+ * @brief Internal structure for a floating-point complex array
+ *
+ * Real and imaginary parts are stored in separate DC_DOUBLE_ARRAY_ALIGN-byte
+ * aligned buffers carved from a single allocation, or from a file mapping.
+ */
+struct dc_double_array_internal {
+    DC_ATOMIC_SIZE_T ref_count;
+    size_t length;
+    double* real;
+    double* imag;
+    void* block;
+    size_t mapped;  /**< Bytes mapped at block by dc_double_array_map(), 0 for heap blocks */
+};
+
+/**
+ * @typedef dc_double_array_writer
+ * @brief Opaque pointer to a streaming writer of columnar array files
+ */
+typedef struct dc_double_array_writer_internal* dc_double_array_writer;
+
+/**
+ * @typedef dc_fft_plan
+ * @brief Opaque pointer to a precomputed discrete Fourier transform plan
+ */
+typedef struct dc_fft_plan_internal* dc_fft_plan;
+
+/**
+ * @struct dc_fft_plan_internal
+ * @brief Internal structure for a transform plan
+ *
+ * Holds the radix schedule, the twiddle factors of every stage and the
+ * scratch space a transform needs, so executing a plan never allocates.
+ * Even sizes also carry a half-size plan and post-processing twiddles for
+ * real-input transforms.
+ */
+struct dc_fft_plan_internal {
+    DC_ATOMIC_SIZE_T ref_count;
+    size_t size;
+    size_t stage_count;
+    uint8_t radices[64];
+    double* twiddle_re;
+    double* twiddle_im;
+    double* real_re;
+    double* real_im;
+    double* work;
+    struct dc_fft_plan_internal* half;
+    struct dc_fft_plan_internal* next;
+    void* block;
 };
 
+/**
+ * @struct dc_int_factorization
+ * @brief Gaussian prime factorization returned by dc_int_factor()
+ */
+typedef struct dc_int_factorization {
+    dc_complex_int unit;     /**< One of 1, i, -1, -i */
+    dc_complex_int* primes;  /**< Distinct Gaussian primes, normalized to real > 0, imag >= 0 */
+    size_t* exponents;       /**< Multiplicity of each prime */
+    size_t count;            /**< Number of distinct primes */
+} dc_int_factorization;
+
+#if DC_POOL_DOUBLE
+/**
+ * @struct dc_pool_stats
+ * @brief Allocation statistics for the calling thread's dc_complex_double pool
+ */
+typedef struct dc_pool_stats {
+    size_t slabs;     /**< Slabs allocated by this thread */
+    size_t hits;      /**< Allocations served from the freelist */
+    size_t misses;    /**< Allocations that required a slab refill */
+    size_t releases;  /**< Nodes returned to this thread's freelist */
+    double hit_rate;  /**< hits / (hits + misses), or 0.0 before the first allocation */
+} dc_pool_stats;
+#endif
+
+#if DC_STATS
+/**
+ * @struct dc_stats
+ * @brief Process-wide allocation and operation counters returned by dc_stats_snapshot()
+ */
+typedef struct dc_stats {
+    size_t allocations;         /**< Heap malloc and realloc calls, including dynamic_int/dynamic_fraction nodes */
+    size_t frees;               /**< Heap free calls */
+    size_t bytes_allocated;     /**< Bytes requested by those allocations */
+    size_t live_ints;           /**< dc_complex_int nodes currently allocated (constants excluded) */
+    size_t live_fracs;          /**< dc_complex_frac nodes currently allocated */
+    size_t live_cfracs;         /**< dc_complex_cfrac nodes currently allocated */
+    size_t live_doubles;        /**< dc_complex_double nodes currently allocated (constants excluded) */
+    size_t live_double_arrays;  /**< dc_double_array objects currently allocated */
+    size_t live_fft_plans;      /**< FFT plans currently allocated, including cached and half-size plans */
+    size_t di_mul_calls;        /**< di_mul calls made by this library and dynamic_fraction */
+    size_t di_gcd_calls;        /**< di_gcd calls made by this library and dynamic_fraction */
+} dc_stats;
+#endif
+
 // ============================================================================
 // INTEGER COMPLEX INTERFACE
 // ============================================================================
@@ -196,42 +608,42 @@ DC_DEC dc_complex_int dc_int_from_ints(int64_t real, int64_t imag);
  * @param imag The imaginary part (must not be NULL)
  * @return New Gaussian integer complex number (must be released)
  * @note Result has reference count of 1
- * @note Input integers are retained
+ * @note Input integers are retained, or copied inline when both fit in int64_t
  */
 DC_DEC dc_complex_int dc_int_from_di(di_int real, di_int imag);
 
 /**
  * @brief Get the Gaussian integer zero (0 + 0i)
  * @return Singleton zero complex number
- * @note This is a singleton with high reference count
+ * @note Immortal constant: retain and release never modify or free it, so it is safe to share across threads
  */
 DC_DEC dc_complex_int dc_int_zero(void);
 
 /**
  * @brief Get the Gaussian integer one (1 + 0i)
  * @return Singleton one complex number
- * @note This is a singleton with high reference count
+ * @note Immortal constant: retain and release never modify or free it, so it is safe to share across threads
  */
 DC_DEC dc_complex_int dc_int_one(void);
 
 /**
  * @brief Get the Gaussian integer i (0 + 1i)
  * @return Singleton imaginary unit
- * @note This is a singleton with high reference count
+ * @note Immortal constant: retain and release never modify or free it, so it is safe to share across threads
  */
 DC_DEC dc_complex_int dc_int_i(void);
 
 /**
  * @brief Get the Gaussian integer -1 (-1 + 0i)
  * @return Singleton negative one complex number
- * @note This is a singleton with high reference count
+ * @note Immortal constant: retain and release never modify or free it, so it is safe to share across threads
  */
 DC_DEC dc_complex_int dc_int_neg_one(void);
 
 /**
  * @brief Get the Gaussian integer -i (0 - 1i)
  * @return Singleton negative imaginary unit
- * @note This is a singleton with high reference count
+ * @note Immortal constant: retain and release never modify or free it, so it is safe to share across threads
  */
 DC_DEC dc_complex_int dc_int_neg_i(void);
 
@@ -250,10 +662,27 @@ DC_DEC dc_complex_int dc_int_retain(dc_complex_int c);
  * @param c Pointer to complex number pointer (gracefully handles NULL)
  * @note Sets *c to NULL after release
  * @note Only frees memory when reference count reaches 0
- * @note Singletons are never freed
+ * @note Immortal values (constants, dc_*_make_immortal()) are never freed
  */
 DC_DEC void dc_int_release(dc_complex_int* c);
 
+/**
+ * @brief Make a Gaussian integer immortal
+ * @param c The complex number (must not be NULL or arena allocated)
+ * @return The same complex number (for convenience)
+ * @note Retain and release become no-ops after a flag check, so threads sharing the value never
+ *       write its reference count; the value is never freed
+ * @note Call before the value is shared with other threads
+ */
+DC_DEC dc_complex_int dc_int_make_immortal(dc_complex_int c);
+
+/**
+ * @brief Test if a complex number is immortal
+ * @param c The complex number (must not be NULL)
+ * @return true for constants and values passed to dc_int_make_immortal()
+ */
+DC_DEC bool dc_int_is_immortal(dc_complex_int c);
+
 /**
  * @brief Create a new copy with reference count 1
  * @param c The complex number to copy (must not be NULL)
@@ -320,6 +749,106 @@ DC_DEC dc_complex_int dc_int_negate(dc_complex_int c);
  */
 DC_DEC dc_complex_int dc_int_conj(dc_complex_int c);
 
+/**
+ * @brief Norm (squared magnitude) of a Gaussian integer
+ * @param c The operand (must not be NULL)
+ * @return New dynamic integer a² + b² for c = a+bi (must be released)
+ * @note Squares the components directly instead of forming c * conj(c)
+ */
+DC_DEC di_int dc_int_norm(dc_complex_int c);
+
+/**
+ * @brief Raise a Gaussian integer to a non-negative integer power
+ * @param c The base (must not be NULL)
+ * @param exp The exponent (c^0 = 1, including 0^0)
+ * @return New complex number c^exp
+ * @note Result has reference count of 1
+ * @note Square-and-multiply with a two-multiplication squaring, (a+b)(a-b) + 2ab i,
+ *       reusing one accumulator node throughout
+ */
+DC_DEC dc_complex_int dc_int_pow(dc_complex_int c, uint64_t exp);
+
+/* Euclidean division and GCD */
+
+/**
+ * @brief Gaussian integer division with remainder
+ * @param a Dividend (must not be NULL)
+ * @param b Divisor (must not be NULL and not zero)
+ * @param quotient Receives a / b rounded to the nearest Gaussian integer (must not be NULL)
+ * @param remainder Receives a - quotient * b (must not be NULL)
+ * @note Both results have reference count of 1 and must be released
+ * @note Each quotient component is rounded to nearest (ties upward), so norm(remainder) <= norm(b) / 2
+ */
+DC_DEC void dc_int_divmod(dc_complex_int a, dc_complex_int b, dc_complex_int* quotient, dc_complex_int* remainder);
+
+/**
+ * @brief Greatest common divisor of two Gaussian integers
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ * @return New Gaussian integer g, normalized to real > 0 and imag >= 0 (0 when a = b = 0)
+ * @note Result has reference count of 1
+ * @note Operands of DC_LEHMER_GCD_THRESHOLD limbs or more are reduced with Lehmer rounds
+ *       that run the Euclidean algorithm on their leading bits
+ */
+DC_DEC dc_complex_int dc_int_gcd(dc_complex_int a, dc_complex_int b);
+
+/**
+ * @brief Extended greatest common divisor of two Gaussian integers
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ * @param x Receives a Bezout coefficient for a (must not be NULL)
+ * @param y Receives a Bezout coefficient for b (must not be NULL)
+ * @return New Gaussian integer g = a*x + b*y, normalized as in dc_int_gcd()
+ * @note The result and both coefficients have reference count of 1 and must be released
+ */
+DC_DEC dc_complex_int dc_int_xgcd(dc_complex_int a, dc_complex_int b, dc_complex_int* x, dc_complex_int* y);
+
+/**
+ * @brief Modular exponentiation of a Gaussian integer
+ * @param base The base (must not be NULL)
+ * @param exp The exponent (must not be NULL and not negative)
+ * @param modulus Gaussian modulus m (must not be NULL and not zero)
+ * @return New complex number: the remainder of base^exp modulo m as dc_int_divmod() returns it,
+ *         so norm(result) <= norm(m) / 2
+ * @note Result has reference count of 1
+ * @note Intermediate reductions use a Barrett-style quotient estimate (multiplications and
+ *       shifts only); a single exact division normalizes the result
+ */
+DC_DEC dc_complex_int dc_int_powmod(dc_complex_int base, di_int exp, dc_complex_int modulus);
+
+/* Primality and factorization */
+
+/**
+ * @brief Test if a Gaussian integer is a Gaussian prime
+ * @param c The complex number (must not be NULL)
+ * @return true if c is prime in Z[i], false otherwise (units and zero are not prime)
+ * @note a + bi with a, b != 0 is prime iff a^2 + b^2 is a rational prime; a pure real or
+ *       imaginary value is prime iff its magnitude is a rational prime congruent to 3 mod 4
+ * @note Rational primality below DC_PRIME_SIEVE_LIMIT comes from a sieve table; larger norms use
+ *       Miller-Rabin with the first thirteen prime bases, which is exact below 3.3e24 and only
+ *       probabilistic above it (no composite is known to pass, but none is ruled out)
+ */
+DC_DEC bool dc_int_is_prime(dc_complex_int c);
+
+/**
+ * @brief Factor a Gaussian integer into Gaussian primes
+ * @param c The complex number (must not be NULL and not zero)
+ * @return Factorization with c = unit * product(primes[k]^exponents[k])
+ * @note Release the result with dc_int_factorization_release()
+ * @note Primes are normalized to real > 0, imag >= 0 and ordered by norm; the two primes over
+ *       a rational p = 1 mod 4 are listed with the larger real part first
+ * @note The norm is factored with trial division by the sieve table, then Pollard-Brent rho;
+ *       each p = 1 mod 4 is split with Cornacchia's algorithm (Hermite-Serret above 64 bits)
+ */
+DC_DEC dc_int_factorization dc_int_factor(dc_complex_int c);
+
+/**
+ * @brief Release the primes and arrays of a factorization
+ * @param f Factorization returned by dc_int_factor() (must not be NULL)
+ * @note f is reset to an empty factorization
+ */
+DC_DEC void dc_int_factorization_release(dc_int_factorization* f);
+
 /* Accessors */
 
 /**
@@ -348,6 +877,15 @@ DC_DEC di_int dc_int_imag(dc_complex_int c);
  */
 DC_DEC bool dc_int_eq(dc_complex_int a, dc_complex_int b);
 
+/**
+ * @brief Compare the magnitudes of two Gaussian integers
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ * @return Negative, zero or positive as |a| is less than, equal to or greater than |b|
+ * @note Norms are only computed when the component bit lengths do not already decide the order
+ */
+DC_DEC int dc_int_compare_abs(dc_complex_int a, dc_complex_int b);
+
 /**
  * @brief Test if a Gaussian integer is zero
  * @param c The complex number (must not be NULL)
@@ -421,35 +959,35 @@ DC_DEC dc_complex_frac dc_frac_from_df(df_frac real, df_frac imag);
 /**
  * @brief Get the rational complex zero (0/1 + 0/1 i)
  * @return Singleton zero complex number
- * @note This is a singleton with high reference count
+ * @note Immortal constant: retain and release never modify or free it, so it is safe to share across threads
  */
 DC_DEC dc_complex_frac dc_frac_zero(void);
 
 /**
  * @brief Get the rational complex one (1/1 + 0/1 i)
  * @return Singleton one complex number
- * @note This is a singleton with high reference count
+ * @note Immortal constant: retain and release never modify or free it, so it is safe to share across threads
  */
 DC_DEC dc_complex_frac dc_frac_one(void);
 
 /**
  * @brief Get the rational complex i (0/1 + 1/1 i)
  * @return Singleton imaginary unit
- * @note This is a singleton with high reference count
+ * @note Immortal constant: retain and release never modify or free it, so it is safe to share across threads
  */
 DC_DEC dc_complex_frac dc_frac_i(void);
 
 /**
  * @brief Get the rational complex -1 (-1/1 + 0/1 i)
  * @return Singleton negative one complex number
- * @note This is a singleton with high reference count
+ * @note Immortal constant: retain and release never modify or free it, so it is safe to share across threads
  */
 DC_DEC dc_complex_frac dc_frac_neg_one(void);
 
 /**
  * @brief Get the rational complex -i (0/1 + -1/1 i)
  * @return Singleton negative imaginary unit
- * @note This is a singleton with high reference count
+ * @note Immortal constant: retain and release never modify or free it, so it is safe to share across threads
  */
 DC_DEC dc_complex_frac dc_frac_neg_i(void);
 
@@ -468,10 +1006,27 @@ DC_DEC dc_complex_frac dc_frac_retain(dc_complex_frac c);
  * @param c Pointer to complex number pointer (gracefully handles NULL)
  * @note Sets *c to NULL after release
  * @note Only frees memory when reference count reaches 0
- * @note Singletons are never freed
+ * @note Immortal values (constants, dc_*_make_immortal()) are never freed
  */
 DC_DEC void dc_frac_release(dc_complex_frac* c);
 
+/**
+ * @brief Make a rational complex number immortal
+ * @param c The complex number (must not be NULL or arena allocated)
+ * @return The same complex number (for convenience)
+ * @note Retain and release become no-ops after a flag check, so threads sharing the value never
+ *       write its reference count; the value is never freed
+ * @note Call before the value is shared with other threads
+ */
+DC_DEC dc_complex_frac dc_frac_make_immortal(dc_complex_frac c);
+
+/**
+ * @brief Test if a complex number is immortal
+ * @param c The complex number (must not be NULL)
+ * @return true for constants and values passed to dc_frac_make_immortal()
+ */
+DC_DEC bool dc_frac_is_immortal(dc_complex_frac c);
+
 /**
  * @brief Create a new copy with reference count 1
  * @param c The complex number to copy (must not be NULL)
@@ -541,15 +1096,63 @@ DC_DEC dc_complex_frac dc_frac_negate(dc_complex_frac c);
  */
 DC_DEC dc_complex_frac dc_frac_conj(dc_complex_frac c);
 
+/**
+ * @brief Norm (squared magnitude) of a rational complex number
+ * @param c The operand (must not be NULL)
+ * @return New dynamic fraction a² + b² for c = a+bi (must be released)
+ * @note Reduced components need at most gcd(den(a), den(b)) and one gcd against its square,
+ *       instead of the products and reductions of c * conj(c)
+ */
+DC_DEC df_frac dc_frac_norm(dc_complex_frac c);
+
+/**
+ * @brief Raise a rational complex number to an integer power
+ * @param c The base (must not be NULL, and not zero when exp < 0)
+ * @param exp The exponent; negative powers are powers of the reciprocal (c^0 = 1)
+ * @return New complex number c^exp
+ * @note Result has reference count of 1
+ * @note Squarings build x² and y² without gcds (squares of reduced fractions are reduced)
+ */
+DC_DEC dc_complex_frac dc_frac_pow(dc_complex_frac c, int64_t exp);
+
 /**
  * @brief Reciprocal of a rational complex number
  * @param c The operand (must not be NULL and not zero)
  * @return New complex number 1/c
  * @note Result has reference count of 1
- * @note Equivalent to dc_frac_div(dc_frac_one(), c)
+ * @note Equivalent to dc_frac_div(dc_frac_one(), c), computed without the temporary one
  */
 DC_DEC dc_complex_frac dc_frac_reciprocal(dc_complex_frac c);
 
+/* Lazy reduction */
+
+/**
+ * @brief Switch a rational complex number to lazy reduction
+ * @param c The complex number (must not be NULL)
+ * @return New reference to the same value in lazy form
+ * @note Result has reference count of 1 (or is c retained if c is already lazy)
+ * @note Sums, differences and products involving a lazy operand are lazy too and skip
+ *       the per-component gcd; components are reduced only when a numerator or
+ *       denominator grows past DC_FRAC_LAZY_MAX_BITS bits
+ * @note Comparisons, accessors, string and type conversion see the reduced value
+ */
+DC_DEC dc_complex_frac dc_frac_lazy(dc_complex_frac c);
+
+/**
+ * @brief Reduce a rational complex number to lowest terms and leave lazy mode
+ * @param c The complex number (must not be NULL)
+ * @return New complex number with reduced components
+ * @note Result has reference count of 1 (or is c retained if c is not lazy)
+ */
+DC_DEC dc_complex_frac dc_frac_normalize(dc_complex_frac c);
+
+/**
+ * @brief Test if a rational complex number uses lazy reduction
+ * @param c The complex number (must not be NULL)
+ * @return true if arithmetic on c defers reduction
+ */
+DC_DEC bool dc_frac_is_lazy(dc_complex_frac c);
+
 /* Accessors */
 
 /**
@@ -579,6 +1182,15 @@ DC_DEC df_frac dc_frac_imag(dc_complex_frac c);
  */
 DC_DEC bool dc_frac_eq(dc_complex_frac a, dc_complex_frac b);
 
+/**
+ * @brief Compare the magnitudes of two rational complex numbers
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ * @return Negative, zero or positive as |a| is less than, equal to or greater than |b|
+ * @note Exact; the norms are only cross-multiplied when component bit lengths do not decide the order
+ */
+DC_DEC int dc_frac_compare_abs(dc_complex_frac a, dc_complex_frac b);
+
 /**
  * @brief Test if a rational complex number is zero
  * @param c The complex number (must not be NULL)
@@ -623,72 +1235,274 @@ DC_DEC char* dc_frac_to_string(dc_complex_frac c);
 /** @} */
 
 // ============================================================================
-// DOUBLE COMPLEX INTERFACE
+// COMMON-DENOMINATOR RATIONAL INTERFACE
 // ============================================================================
 
 /**
- * @defgroup dc_double_functions Double Complex Functions
- * @brief Functions for floating-point complex numbers
+ * @defgroup dc_cfrac_functions Common-Denominator Rational Functions
+ * @brief Rational complex numbers stored as (a + bi)/d
+ *
+ * dc_complex_cfrac keeps one positive denominator for both components, so
+ * each result is brought to lowest terms with a single gcd(a, b, d) instead
+ * of a gcd per component and per intermediate df_frac. Products and
+ * quotients reduce to Gaussian integer arithmetic on the numerators.
  * @{
  */
 
-/* Creation */
+/* Creation and lifetime */
 
 /**
- * @brief Create a floating-point complex number from real and imaginary parts
- * @param real The real part
- * @param imag The imaginary part
- * @return New floating-point complex number (must be released)
+ * @brief Create (real + imag i) / den from dynamic integers
+ * @param real Real part of the numerator (must not be NULL)
+ * @param imag Imaginary part of the numerator (must not be NULL)
+ * @param den Denominator (must not be NULL or zero)
+ * @return New complex number in lowest terms with a positive denominator
  * @note Result has reference count of 1
  */
-DC_DEC dc_complex_double dc_double_from_doubles(double real, double imag);
+DC_DEC dc_complex_cfrac dc_cfrac_from_di(di_int real, di_int imag, di_int den);
 
 /**
- * @brief Create a floating-point complex number from polar coordinates
- * @param magnitude The magnitude (radius)
- * @param angle The angle in radians
- * @return New floating-point complex number (must be released)
+ * @brief Create (real + imag i) / den from int64 values
+ * @param real Real part of the numerator
+ * @param imag Imaginary part of the numerator
+ * @param den Denominator (must not be zero)
+ * @return New complex number in lowest terms with a positive denominator
  * @note Result has reference count of 1
- * @note Uses formula: magnitude * e^(i*angle)
  */
-DC_DEC dc_complex_double dc_double_from_polar(double magnitude, double angle);
+DC_DEC dc_complex_cfrac dc_cfrac_from_ints(int64_t real, int64_t imag, int64_t den);
 
 /**
- * @brief Get the floating-point complex zero (0.0 + 0.0i)
- * @return Singleton zero complex number
- * @note This is a singleton with high reference count
+ * @brief Increment reference count
+ * @param c The complex number to retain (must not be NULL)
+ * @return The same complex number (for convenience)
  */
-DC_DEC dc_complex_double dc_double_zero(void);
+DC_DEC dc_complex_cfrac dc_cfrac_retain(dc_complex_cfrac c);
 
 /**
- * @brief Get the floating-point complex one (1.0 + 0.0i)
- * @return Singleton one complex number
- * @note This is a singleton with high reference count
+ * @brief Decrement reference count and free if zero
+ * @param c Pointer to complex number pointer (gracefully handles NULL)
+ * @note Sets *c to NULL after release
  */
-DC_DEC dc_complex_double dc_double_one(void);
+DC_DEC void dc_cfrac_release(dc_complex_cfrac* c);
 
 /**
- * @brief Get the floating-point complex i (0.0 + 1.0i)
- * @return Singleton imaginary unit
- * @note This is a singleton with high reference count
+ * @brief Make a common-denominator rational complex number immortal
+ * @param c The complex number (must not be NULL or arena allocated)
+ * @return The same complex number (for convenience)
+ * @note Retain and release become no-ops after a flag check, so threads sharing the value never
+ *       write its reference count; the value is never freed
+ * @note Call before the value is shared with other threads
  */
-DC_DEC dc_complex_double dc_double_i(void);
+DC_DEC dc_complex_cfrac dc_cfrac_make_immortal(dc_complex_cfrac c);
 
 /**
- * @brief Get the floating-point complex -1 (-1.0 + 0.0i)
- * @return Singleton negative one complex number
- * @note This is a singleton with high reference count
+ * @brief Test if a complex number is immortal
+ * @param c The complex number (must not be NULL)
+ * @return true for constants and values passed to dc_cfrac_make_immortal()
  */
-DC_DEC dc_complex_double dc_double_neg_one(void);
+DC_DEC bool dc_cfrac_is_immortal(dc_complex_cfrac c);
+
+/* Arithmetic */
 
 /**
- * @brief Get the floating-point complex -i (0.0 + -1.0i)
- * @return Singleton negative imaginary unit
- * @note This is a singleton with high reference count
+ * @brief Add two common-denominator rational complex numbers
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ * @return New complex number a + b
+ * @note Result has reference count of 1
+ * @note Equal denominators are kept as they are instead of multiplied
  */
-DC_DEC dc_complex_double dc_double_neg_i(void);
-
-/* Memory management */
+DC_DEC dc_complex_cfrac dc_cfrac_add(dc_complex_cfrac a, dc_complex_cfrac b);
+
+/**
+ * @brief Subtract two common-denominator rational complex numbers
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ * @return New complex number a - b
+ * @note Result has reference count of 1
+ */
+DC_DEC dc_complex_cfrac dc_cfrac_sub(dc_complex_cfrac a, dc_complex_cfrac b);
+
+/**
+ * @brief Multiply two common-denominator rational complex numbers
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ * @return New complex number a * b
+ * @note Result has reference count of 1
+ * @note One Gaussian integer product of the numerators over the product of the denominators
+ */
+DC_DEC dc_complex_cfrac dc_cfrac_mul(dc_complex_cfrac a, dc_complex_cfrac b);
+
+/**
+ * @brief Divide two common-denominator rational complex numbers
+ * @param a Dividend (must not be NULL)
+ * @param b Divisor (must not be NULL and not zero)
+ * @return New complex number a / b
+ * @note Result has reference count of 1
+ * @note Uses (p+qi)/d / ((r+si)/f) = (p+qi)(r-si)f / (d(r²+s²))
+ */
+DC_DEC dc_complex_cfrac dc_cfrac_div(dc_complex_cfrac a, dc_complex_cfrac b);
+
+/**
+ * @brief Negate a common-denominator rational complex number
+ * @param c The operand (must not be NULL)
+ * @return New complex number -c
+ * @note Result has reference count of 1
+ */
+DC_DEC dc_complex_cfrac dc_cfrac_negate(dc_complex_cfrac c);
+
+/**
+ * @brief Complex conjugate of a common-denominator rational complex number
+ * @param c The operand (must not be NULL)
+ * @return New complex number with imaginary part negated
+ * @note Result has reference count of 1
+ */
+DC_DEC dc_complex_cfrac dc_cfrac_conj(dc_complex_cfrac c);
+
+/**
+ * @brief Squared magnitude of a common-denominator rational complex number
+ * @param c The operand (must not be NULL)
+ * @return New dynamic fraction (a² + b²) / d² (must be released)
+ */
+DC_DEC df_frac dc_cfrac_norm(dc_complex_cfrac c);
+
+/* Accessors */
+
+/**
+ * @brief Get the numerator a + bi
+ * @param c The complex number (must not be NULL)
+ * @return New Gaussian integer (must be released)
+ */
+DC_DEC dc_complex_int dc_cfrac_numerator(dc_complex_cfrac c);
+
+/**
+ * @brief Get the shared denominator
+ * @param c The complex number (must not be NULL)
+ * @return New dynamic integer, always positive (must be released)
+ */
+DC_DEC di_int dc_cfrac_denominator(dc_complex_cfrac c);
+
+/* Comparisons */
+
+/**
+ * @brief Test if two common-denominator rational complex numbers are equal
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ * @return true if a == b, false otherwise
+ */
+DC_DEC bool dc_cfrac_eq(dc_complex_cfrac a, dc_complex_cfrac b);
+
+/**
+ * @brief Test if a common-denominator rational complex number is zero
+ * @param c The complex number (must not be NULL)
+ * @return true if c == 0+0i, false otherwise
+ */
+DC_DEC bool dc_cfrac_is_zero(dc_complex_cfrac c);
+
+/* Conversions */
+
+/**
+ * @brief Convert a rational complex number to the common-denominator form
+ * @param c The rational complex number (must not be NULL)
+ * @return New complex number over the lcm of the component denominators
+ * @note Result has reference count of 1
+ */
+DC_DEC dc_complex_cfrac dc_frac_to_cfrac(dc_complex_frac c);
+
+/**
+ * @brief Convert a common-denominator rational complex number to the per-component form
+ * @param c The complex number (must not be NULL)
+ * @return New rational complex number with the same value
+ * @note Result has reference count of 1
+ */
+DC_DEC dc_complex_frac dc_cfrac_to_frac(dc_complex_cfrac c);
+
+/**
+ * @brief Convert common-denominator rational complex number to string
+ * @param c The complex number (must not be NULL)
+ * @return Newly allocated string (must be freed with free())
+ * @note Format examples: "(3+4i)/5", "-i/2", "7/3", "2+i"
+ */
+DC_DEC char* dc_cfrac_to_string(dc_complex_cfrac c);
+
+/** @} */
+
+// ============================================================================
+// DOUBLE COMPLEX INTERFACE
+// ============================================================================
+
+/**
+ * @defgroup dc_double_functions Double Complex Functions
+ * @brief Functions for floating-point complex numbers
+ * @{
+ */
+
+/* Creation */
+
+/**
+ * @brief Create a floating-point complex number from real and imaginary parts
+ * @param real The real part
+ * @param imag The imaginary part
+ * @return New floating-point complex number (must be released)
+ * @note Result has reference count of 1
+ */
+DC_DEC dc_complex_double dc_double_from_doubles(double real, double imag);
+
+/**
+ * @brief Create a floating-point complex number from polar coordinates
+ * @param magnitude The magnitude (radius)
+ * @param angle The angle in radians
+ * @return New floating-point complex number (must be released)
+ * @note Result has reference count of 1
+ * @note Uses formula: magnitude * e^(i*angle)
+ */
+DC_DEC dc_complex_double dc_double_from_polar(double magnitude, double angle);
+
+/**
+ * @brief Box an unboxed complex value
+ * @param value The value to box
+ * @return New floating-point complex number (must be released)
+ * @note Result has reference count of 1
+ * @see dcv_double_functions
+ */
+DC_DEC dc_complex_double dc_double_from_value(double complex value);
+
+/**
+ * @brief Get the floating-point complex zero (0.0 + 0.0i)
+ * @return Singleton zero complex number
+ * @note Immortal constant: retain and release never modify or free it, so it is safe to share across threads
+ */
+DC_DEC dc_complex_double dc_double_zero(void);
+
+/**
+ * @brief Get the floating-point complex one (1.0 + 0.0i)
+ * @return Singleton one complex number
+ * @note Immortal constant: retain and release never modify or free it, so it is safe to share across threads
+ */
+DC_DEC dc_complex_double dc_double_one(void);
+
+/**
+ * @brief Get the floating-point complex i (0.0 + 1.0i)
+ * @return Singleton imaginary unit
+ * @note Immortal constant: retain and release never modify or free it, so it is safe to share across threads
+ */
+DC_DEC dc_complex_double dc_double_i(void);
+
+/**
+ * @brief Get the floating-point complex -1 (-1.0 + 0.0i)
+ * @return Singleton negative one complex number
+ * @note Immortal constant: retain and release never modify or free it, so it is safe to share across threads
+ */
+DC_DEC dc_complex_double dc_double_neg_one(void);
+
+/**
+ * @brief Get the floating-point complex -i (0.0 + -1.0i)
+ * @return Singleton negative imaginary unit
+ * @note Immortal constant: retain and release never modify or free it, so it is safe to share across threads
+ */
+DC_DEC dc_complex_double dc_double_neg_i(void);
+
+/* Memory management */
 
 /**
  * @brief Increment reference count and return the same object
@@ -703,10 +1517,27 @@ DC_DEC dc_complex_double dc_double_retain(dc_complex_double c);
  * @param c Pointer to complex number pointer (gracefully handles NULL)
  * @note Sets *c to NULL after release
  * @note Only frees memory when reference count reaches 0
- * @note Singletons are never freed
+ * @note Immortal values (constants, dc_*_make_immortal()) are never freed
  */
 DC_DEC void dc_double_release(dc_complex_double* c);
 
+/**
+ * @brief Make a floating-point complex number immortal
+ * @param c The complex number (must not be NULL or arena allocated)
+ * @return The same complex number (for convenience)
+ * @note Retain and release become no-ops after a flag check, so threads sharing the value never
+ *       write its reference count; the value is never freed
+ * @note Call before the value is shared with other threads
+ */
+DC_DEC dc_complex_double dc_double_make_immortal(dc_complex_double c);
+
+/**
+ * @brief Test if a complex number is immortal
+ * @param c The complex number (must not be NULL)
+ * @return true for constants and values passed to dc_double_make_immortal()
+ */
+DC_DEC bool dc_double_is_immortal(dc_complex_double c);
+
 /**
  * @brief Create a new copy with reference count 1
  * @param c The complex number to copy (must not be NULL)
@@ -715,6 +1546,28 @@ DC_DEC void dc_double_release(dc_complex_double* c);
  */
 DC_DEC dc_complex_double dc_double_copy(dc_complex_double c);
 
+#if DC_POOL_DOUBLE
+/**
+ * @brief Get allocation statistics for the calling thread's node pool
+ * @param stats Output statistics (must not be NULL)
+ * @note Only available when DC_POOL_DOUBLE is enabled
+ * @note Nodes are returned to the freelist of the thread that releases them, so values created on
+ *       one thread and released on another migrate to the releasing thread's pool for good
+ * @note Slabs are never freed; call dc_double_pool_detach() before a thread exits so its slabs and
+ *       free nodes are not lost with its thread-local lists
+ */
+DC_DEC void dc_double_pool_stats(dc_pool_stats* stats);
+
+/**
+ * @brief Hand the calling thread's free nodes and slabs back to the process
+ * @note Only available when DC_POOL_DOUBLE is enabled
+ * @note Call before a thread that allocated dc_complex_double values exits. The free nodes are
+ *       adopted by the next thread whose freelist runs dry, before it allocates a new slab; live
+ *       values stay valid. The thread may keep allocating afterwards and starts an empty pool.
+ */
+DC_DEC void dc_double_pool_detach(void);
+#endif
+
 /* Arithmetic */
 
 /**
@@ -889,6 +1742,14 @@ DC_DEC double dc_double_real(dc_complex_double c);
  */
 DC_DEC double dc_double_imag(dc_complex_double c);
 
+/**
+ * @brief Get the unboxed value of a floating-point complex number
+ * @param c The complex number (must not be NULL)
+ * @return The value as a C99 double complex
+ * @see dcv_double_functions
+ */
+DC_DEC double complex dc_double_value(dc_complex_double c);
+
 /**
  * @brief Get the absolute value (magnitude) of a complex number
  * @param c The complex number (must not be NULL)
@@ -971,1145 +1832,9004 @@ DC_DEC char* dc_double_to_string(dc_complex_double c);
 /** @} */
 
 // ============================================================================
-// TYPE CONVERSION INTERFACE
+// DOUBLE COMPLEX VALUE INTERFACE
 // ============================================================================
 
 /**
- * @defgroup dc_conversion_functions Type Conversion Functions
- * @brief Functions for converting between complex number types
+ * @defgroup dcv_double_functions Double Complex Value Functions
+ * @brief Unboxed floating-point complex arithmetic that never touches the heap
+ *
+ * These functions operate on plain C99 `double complex` values and are defined
+ * inline so hot loops can keep intermediates in registers. The boxed
+ * dc_double_* functions are implemented on top of them, so both APIs produce
+ * identical results. Use dc_double_from_value() and dc_double_value() to cross
+ * between the two at API boundaries.
  * @{
  */
 
-/* Upward conversions (lossless) */
+#if defined(__GNUC__) || defined(__clang__)
+#define DC_INLINE static inline __attribute__((always_inline))
+#else
+#define DC_INLINE static inline
+#endif
+
+/* Round a product to double before it is summed, so no -ffp-contract setting can fuse it into an FMA.
+ * The empty asm keeps the value in its register; elsewhere a volatile round trip does the same. */
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define DC_ROUNDED(x) __asm__("" : "+x"(x))
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+#define DC_ROUNDED(x) __asm__("" : "+w"(x))
+#else
+#define DC_ROUNDED(x)                      \
+    do {                                   \
+        volatile double dc_rounded_ = (x); \
+        (x) = dc_rounded_;                 \
+    } while (0)
+#endif
 
 /**
- * @brief Convert Gaussian integer to rational complex (lossless)
- * @param c The Gaussian integer (must not be NULL)
- * @return New rational complex number with same value
- * @note Result has reference count of 1
- * @note Conversion is exact: integer n becomes n/1
+ * @typedef dcv_double
+ * @brief Unboxed floating-point complex value
  */
-DC_DEC dc_complex_frac dc_int_to_frac(dc_complex_int c);
+typedef double complex dcv_double;
+
+/* Creation */
 
 /**
- * @brief Convert Gaussian integer to floating-point complex (lossless for small integers)
- * @param c The Gaussian integer (must not be NULL)
- * @return New floating-point complex number
- * @note Result has reference count of 1
- * @note Large integers may lose precision due to double limits
+ * @brief Make a complex value from real and imaginary parts
+ * @param real The real part
+ * @param imag The imaginary part
+ * @return The value real + imag*i
  */
-DC_DEC dc_complex_double dc_int_to_double(dc_complex_int c);
+DC_INLINE dcv_double dcv_double_from_doubles(double real, double imag) {
+    return real + imag * I;
+}
 
 /**
- * @brief Convert rational complex to floating-point complex
- * @param c The rational complex number (must not be NULL)
- * @return New floating-point complex number
- * @note Result has reference count of 1
- * @note Precision may be lost due to floating-point representation
+ * @brief Make a complex value from polar coordinates
+ * @param magnitude The magnitude (radius)
+ * @param angle The angle in radians
+ * @return The value magnitude * e^(i*angle)
  */
-DC_DEC dc_complex_double dc_frac_to_double(dc_complex_frac c);
+DC_INLINE dcv_double dcv_double_from_polar(double magnitude, double angle) {
+    return magnitude * cexp(I * angle);
+}
 
-/* Downward conversions (may round) */
+/* Arithmetic */
 
 /**
- * @brief Convert rational complex to Gaussian integer (with rounding)
- * @param c The rational complex number (must not be NULL)
- * @return New Gaussian integer (rounded to nearest)
- * @note Result has reference count of 1
- * @note Both real and imaginary parts rounded to nearest integer
- * @note Use dc_frac_is_gaussian_int() to check if conversion is exact
+ * @brief Add two complex values
+ * @return a + b
  */
-DC_DEC dc_complex_int dc_frac_to_int(dc_complex_frac c);
+DC_INLINE dcv_double dcv_double_add(dcv_double a, dcv_double b) {
+    return a + b;
+}
 
 /**
- * @brief Convert floating-point complex to Gaussian integer (with rounding)
- * @param c The floating-point complex number (must not be NULL)
- * @return New Gaussian integer (rounded to nearest)
- * @note Result has reference count of 1
- * @note Both real and imaginary parts rounded to nearest integer
- * @note NaN and infinity values may produce undefined behavior
+ * @brief Subtract two complex values
+ * @return a - b
  */
-DC_DEC dc_complex_int dc_double_to_int(dc_complex_double c);
+DC_INLINE dcv_double dcv_double_sub(dcv_double a, dcv_double b) {
+    return a - b;
+}
 
 /**
- * @brief Convert floating-point complex to rational complex (with approximation)
- * @param c The floating-point complex number (must not be NULL)
- * @param max_denominator Maximum allowed denominator for approximation
- * @return New rational complex number approximating the input
- * @note Result has reference count of 1
- * @note Uses continued fraction approximation
- * @note Larger max_denominator gives better approximation but larger fractions
+ * @brief Multiply two complex values
+ * @return a * b
+ * @note Products are rounded before they are summed, so results do not depend on FMA contraction;
+ *       NaN + NaN i results fall back to C99 complex.h multiplication for Annex G infinity recovery
  */
-DC_DEC dc_complex_frac dc_double_to_frac(dc_complex_double c, int64_t max_denominator);
+DC_INLINE dcv_double dcv_double_mul(dcv_double a, dcv_double b) {
+    double ac = creal(a) * creal(b), bd = cimag(a) * cimag(b);
+    double ad = creal(a) * cimag(b), bc = cimag(a) * creal(b);
+    DC_ROUNDED(ac);
+    DC_ROUNDED(bd);
+    DC_ROUNDED(ad);
+    DC_ROUNDED(bc);
+
+    dcv_double result;
+    ((double*)&result)[0] = ac - bd;
+    ((double*)&result)[1] = ad + bc;
+    if (creal(result) != creal(result) && cimag(result) != cimag(result)) return a * b;
+    return result;
+}
 
-/** @} */
+/**
+ * @brief Divide two complex values
+ * @param a Dividend
+ * @param b Divisor (must not be zero)
+ * @return a / b
+ * @note Uses C99 complex.h division
+ */
+DC_INLINE dcv_double dcv_double_div(dcv_double a, dcv_double b) {
+    DC_ASSERT(!(creal(b) == 0.0 && cimag(b) == 0.0) && "dcv_double_div: division by zero");
+    return a / b;
+}
 
-// ============================================================================
-// IMPLEMENTATION
-// ============================================================================
+/**
+ * @brief Negate a complex value
+ * @return -c
+ */
+DC_INLINE dcv_double dcv_double_negate(dcv_double c) {
+    return -c;
+}
 
-#ifdef DC_IMPLEMENTATION
+/**
+ * @brief Complex conjugate
+ * @return c with imaginary part negated
+ */
+DC_INLINE dcv_double dcv_double_conj(dcv_double c) {
+    return conj(c);
+}
 
-// Global singletons for common constants
-static dc_complex_int dc_int_zero_singleton = NULL;
-static dc_complex_int dc_int_one_singleton = NULL;
-static dc_complex_int dc_int_i_singleton = NULL;
-static dc_complex_int dc_int_neg_one_singleton = NULL;
-static dc_complex_int dc_int_neg_i_singleton = NULL;
+/* Complex-specific operations */
 
-static dc_complex_frac dc_frac_zero_singleton = NULL;
-static dc_complex_frac dc_frac_one_singleton = NULL;
-static dc_complex_frac dc_frac_i_singleton = NULL;
-static dc_complex_frac dc_frac_neg_one_singleton = NULL;
-static dc_complex_frac dc_frac_neg_i_singleton = NULL;
+/**
+ * @brief Complex exponential
+ * @return e^c (C99 cexp())
+ */
+DC_INLINE dcv_double dcv_double_exp(dcv_double c) {
+    return cexp(c);
+}
 
-static dc_complex_double dc_double_zero_singleton = NULL;
-static dc_complex_double dc_double_one_singleton = NULL;
-static dc_complex_double dc_double_i_singleton = NULL;
-static dc_complex_double dc_double_neg_one_singleton = NULL;
-static dc_complex_double dc_double_neg_i_singleton = NULL;
+/**
+ * @brief Complex natural logarithm (principal branch)
+ * @param c The operand (must not be zero)
+ * @return log(c) (C99 clog())
+ */
+DC_INLINE dcv_double dcv_double_log(dcv_double c) {
+    DC_ASSERT(!(creal(c) == 0.0 && cimag(c) == 0.0) && "dcv_double_log: log of zero");
+    return clog(c);
+}
 
-// ============================================================================
-// INTEGER COMPLEX IMPLEMENTATION
-// ============================================================================
+/**
+ * @brief Complex power (principal branch)
+ * @return a^b (C99 cpow())
+ */
+DC_INLINE dcv_double dcv_double_pow(dcv_double a, dcv_double b) {
+    return cpow(a, b);
+}
+
+/**
+ * @brief Complex square root (principal branch)
+ * @return sqrt(c) (C99 csqrt())
+ */
+DC_INLINE dcv_double dcv_double_sqrt(dcv_double c) {
+    return csqrt(c);
+}
+
+/**
+ * @brief Complex sine
+ * @return sin(c) (C99 csin())
+ */
+DC_INLINE dcv_double dcv_double_sin(dcv_double c) {
+    return csin(c);
+}
+
+/**
+ * @brief Complex cosine
+ * @return cos(c) (C99 ccos())
+ */
+DC_INLINE dcv_double dcv_double_cos(dcv_double c) {
+    return ccos(c);
+}
+
+/**
+ * @brief Complex tangent
+ * @return tan(c) (C99 ctan())
+ */
+DC_INLINE dcv_double dcv_double_tan(dcv_double c) {
+    return ctan(c);
+}
+
+/**
+ * @brief Complex hyperbolic sine
+ * @return sinh(c) (C99 csinh())
+ */
+DC_INLINE dcv_double dcv_double_sinh(dcv_double c) {
+    return csinh(c);
+}
+
+/**
+ * @brief Complex hyperbolic cosine
+ * @return cosh(c) (C99 ccosh())
+ */
+DC_INLINE dcv_double dcv_double_cosh(dcv_double c) {
+    return ccosh(c);
+}
+
+/**
+ * @brief Complex hyperbolic tangent
+ * @return tanh(c) (C99 ctanh())
+ */
+DC_INLINE dcv_double dcv_double_tanh(dcv_double c) {
+    return ctanh(c);
+}
+
+/* Accessors */
+
+/**
+ * @brief Real part of a complex value
+ */
+DC_INLINE double dcv_double_real(dcv_double c) {
+    return creal(c);
+}
+
+/**
+ * @brief Imaginary part of a complex value
+ */
+DC_INLINE double dcv_double_imag(dcv_double c) {
+    return cimag(c);
+}
+
+/**
+ * @brief Magnitude of a complex value (C99 cabs())
+ */
+DC_INLINE double dcv_double_abs(dcv_double c) {
+    return cabs(c);
+}
+
+/**
+ * @brief Argument (phase angle) of a complex value in (-π, π] (C99 carg())
+ */
+DC_INLINE double dcv_double_arg(dcv_double c) {
+    return carg(c);
+}
+
+/* Comparisons */
+
+/**
+ * @brief Exact equality of two complex values
+ */
+DC_INLINE bool dcv_double_eq(dcv_double a, dcv_double b) {
+    return creal(a) == creal(b) && cimag(a) == cimag(b);
+}
+
+/**
+ * @brief Test if a complex value is 0.0+0.0i
+ */
+DC_INLINE bool dcv_double_is_zero(dcv_double c) {
+    return creal(c) == 0.0 && cimag(c) == 0.0;
+}
+
+/**
+ * @brief Test if the imaginary part is 0.0
+ */
+DC_INLINE bool dcv_double_is_real(dcv_double c) {
+    return cimag(c) == 0.0;
+}
+
+/**
+ * @brief Test if the real part is 0.0
+ */
+DC_INLINE bool dcv_double_is_imag(dcv_double c) {
+    return creal(c) == 0.0;
+}
+
+/**
+ * @brief Test if either component is NaN
+ */
+DC_INLINE bool dcv_double_is_nan(dcv_double c) {
+    return isnan(creal(c)) || isnan(cimag(c));
+}
+
+/**
+ * @brief Test if either component is infinite
+ */
+DC_INLINE bool dcv_double_is_inf(dcv_double c) {
+    return isinf(creal(c)) || isinf(cimag(c));
+}
+
+/** @} */
+
+// ============================================================================
+// IN-PLACE ARITHMETIC INTERFACE
+// ============================================================================
+
+/**
+ * @defgroup dc_inplace_functions In-Place Arithmetic Functions
+ * @brief Destination-passing and ownership-stealing arithmetic
+ *
+ * The _into variants store their result in *dst. When *dst is uniquely owned
+ * (reference count 1) its node is overwritten in place; otherwise *dst is
+ * released and replaced by a freshly allocated result. *dst may be NULL and
+ * may alias either operand, so accumulation loops can be written as
+ * dc_int_add_into(&acc, acc, x) without allocating a node per iteration.
+ *
+ * The _steal variants consume their first operand and return the result,
+ * reusing the operand's node when it is uniquely owned:
+ * acc = dc_double_mul_steal(acc, x).
+ * @{
+ */
+/**
+ * @brief Add two complex numbers, storing the result in *dst
+ * @param dst Destination (must not be NULL; *dst may be NULL or alias an operand)
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ */
+DC_DEC void dc_int_add_into(dc_complex_int* dst, dc_complex_int a, dc_complex_int b);
+/**
+ * @brief Subtract two complex numbers, storing the result in *dst
+ * @param dst Destination (must not be NULL; *dst may be NULL or alias an operand)
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ */
+DC_DEC void dc_int_sub_into(dc_complex_int* dst, dc_complex_int a, dc_complex_int b);
+/**
+ * @brief Multiply two complex numbers, storing the result in *dst
+ * @param dst Destination (must not be NULL; *dst may be NULL or alias an operand)
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ */
+DC_DEC void dc_int_mul_into(dc_complex_int* dst, dc_complex_int a, dc_complex_int b);
+/**
+ * @brief Divide two Gaussian integers, storing the rational result in *dst
+ * @param dst Destination (must not be NULL; *dst may be NULL)
+ * @param a Dividend (must not be NULL)
+ * @param b Divisor (must not be NULL)
+ * @note Asserts on division by zero
+ */
+DC_DEC void dc_int_div_into(dc_complex_frac* dst, dc_complex_int a, dc_complex_int b);
+/**
+ * @brief Negate a complex number, storing the result in *dst
+ * @param dst Destination (must not be NULL; *dst may be NULL or alias c)
+ * @param c The complex number (must not be NULL)
+ */
+DC_DEC void dc_int_negate_into(dc_complex_int* dst, dc_complex_int c);
+/**
+ * @brief Complex conjugate, storing the result in *dst
+ * @param dst Destination (must not be NULL; *dst may be NULL or alias c)
+ * @param c The complex number (must not be NULL)
+ */
+DC_DEC void dc_int_conj_into(dc_complex_int* dst, dc_complex_int c);
+/**
+ * @brief Add two complex numbers, consuming the first operand
+ * @param a First operand, released by the call (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ * @return Result, in a's node when a was uniquely owned
+ */
+DC_DEC dc_complex_int dc_int_add_steal(dc_complex_int a, dc_complex_int b);
+/**
+ * @brief Subtract two complex numbers, consuming the first operand
+ * @param a First operand, released by the call (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ * @return Result, in a's node when a was uniquely owned
+ */
+DC_DEC dc_complex_int dc_int_sub_steal(dc_complex_int a, dc_complex_int b);
+/**
+ * @brief Multiply two complex numbers, consuming the first operand
+ * @param a First operand, released by the call (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ * @return Result, in a's node when a was uniquely owned
+ */
+DC_DEC dc_complex_int dc_int_mul_steal(dc_complex_int a, dc_complex_int b);
+/**
+ * @brief Negate a complex number, consuming the operand
+ * @param c The complex number, released by the call (must not be NULL)
+ * @return Result, in c's node when c was uniquely owned
+ */
+DC_DEC dc_complex_int dc_int_negate_steal(dc_complex_int c);
+/**
+ * @brief Complex conjugate, consuming the operand
+ * @param c The complex number, released by the call (must not be NULL)
+ * @return Result, in c's node when c was uniquely owned
+ */
+DC_DEC dc_complex_int dc_int_conj_steal(dc_complex_int c);
+/**
+ * @brief Add two complex numbers, storing the result in *dst
+ * @param dst Destination (must not be NULL; *dst may be NULL or alias an operand)
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ */
+DC_DEC void dc_frac_add_into(dc_complex_frac* dst, dc_complex_frac a, dc_complex_frac b);
+/**
+ * @brief Subtract two complex numbers, storing the result in *dst
+ * @param dst Destination (must not be NULL; *dst may be NULL or alias an operand)
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ */
+DC_DEC void dc_frac_sub_into(dc_complex_frac* dst, dc_complex_frac a, dc_complex_frac b);
+/**
+ * @brief Multiply two complex numbers, storing the result in *dst
+ * @param dst Destination (must not be NULL; *dst may be NULL or alias an operand)
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ */
+DC_DEC void dc_frac_mul_into(dc_complex_frac* dst, dc_complex_frac a, dc_complex_frac b);
+/**
+ * @brief Divide two complex numbers, storing the result in *dst
+ * @param dst Destination (must not be NULL; *dst may be NULL or alias an operand)
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ */
+DC_DEC void dc_frac_div_into(dc_complex_frac* dst, dc_complex_frac a, dc_complex_frac b);
+/**
+ * @brief Negate a complex number, storing the result in *dst
+ * @param dst Destination (must not be NULL; *dst may be NULL or alias c)
+ * @param c The complex number (must not be NULL)
+ */
+DC_DEC void dc_frac_negate_into(dc_complex_frac* dst, dc_complex_frac c);
+/**
+ * @brief Complex conjugate, storing the result in *dst
+ * @param dst Destination (must not be NULL; *dst may be NULL or alias c)
+ * @param c The complex number (must not be NULL)
+ */
+DC_DEC void dc_frac_conj_into(dc_complex_frac* dst, dc_complex_frac c);
+/**
+ * @brief Reciprocal of a complex number, storing the result in *dst
+ * @param dst Destination (must not be NULL; *dst may be NULL or alias c)
+ * @param c The complex number (must not be NULL)
+ */
+DC_DEC void dc_frac_reciprocal_into(dc_complex_frac* dst, dc_complex_frac c);
+/**
+ * @brief Add two complex numbers, consuming the first operand
+ * @param a First operand, released by the call (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ * @return Result, in a's node when a was uniquely owned
+ */
+DC_DEC dc_complex_frac dc_frac_add_steal(dc_complex_frac a, dc_complex_frac b);
+/**
+ * @brief Subtract two complex numbers, consuming the first operand
+ * @param a First operand, released by the call (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ * @return Result, in a's node when a was uniquely owned
+ */
+DC_DEC dc_complex_frac dc_frac_sub_steal(dc_complex_frac a, dc_complex_frac b);
+/**
+ * @brief Multiply two complex numbers, consuming the first operand
+ * @param a First operand, released by the call (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ * @return Result, in a's node when a was uniquely owned
+ */
+DC_DEC dc_complex_frac dc_frac_mul_steal(dc_complex_frac a, dc_complex_frac b);
+/**
+ * @brief Divide two complex numbers, consuming the first operand
+ * @param a First operand, released by the call (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ * @return Result, in a's node when a was uniquely owned
+ */
+DC_DEC dc_complex_frac dc_frac_div_steal(dc_complex_frac a, dc_complex_frac b);
+/**
+ * @brief Negate a complex number, consuming the operand
+ * @param c The complex number, released by the call (must not be NULL)
+ * @return Result, in c's node when c was uniquely owned
+ */
+DC_DEC dc_complex_frac dc_frac_negate_steal(dc_complex_frac c);
+/**
+ * @brief Complex conjugate, consuming the operand
+ * @param c The complex number, released by the call (must not be NULL)
+ * @return Result, in c's node when c was uniquely owned
+ */
+DC_DEC dc_complex_frac dc_frac_conj_steal(dc_complex_frac c);
+/**
+ * @brief Reciprocal of a complex number, consuming the operand
+ * @param c The complex number, released by the call (must not be NULL)
+ * @return Result, in c's node when c was uniquely owned
+ */
+DC_DEC dc_complex_frac dc_frac_reciprocal_steal(dc_complex_frac c);
+/**
+ * @brief Add two complex numbers, storing the result in *dst
+ * @param dst Destination (must not be NULL; *dst may be NULL or alias an operand)
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ */
+DC_DEC void dc_double_add_into(dc_complex_double* dst, dc_complex_double a, dc_complex_double b);
+/**
+ * @brief Subtract two complex numbers, storing the result in *dst
+ * @param dst Destination (must not be NULL; *dst may be NULL or alias an operand)
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ */
+DC_DEC void dc_double_sub_into(dc_complex_double* dst, dc_complex_double a, dc_complex_double b);
+/**
+ * @brief Multiply two complex numbers, storing the result in *dst
+ * @param dst Destination (must not be NULL; *dst may be NULL or alias an operand)
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ */
+DC_DEC void dc_double_mul_into(dc_complex_double* dst, dc_complex_double a, dc_complex_double b);
+/**
+ * @brief Divide two complex numbers, storing the result in *dst
+ * @param dst Destination (must not be NULL; *dst may be NULL or alias an operand)
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ */
+DC_DEC void dc_double_div_into(dc_complex_double* dst, dc_complex_double a, dc_complex_double b);
+/**
+ * @brief Negate a complex number, storing the result in *dst
+ * @param dst Destination (must not be NULL; *dst may be NULL or alias c)
+ * @param c The complex number (must not be NULL)
+ */
+DC_DEC void dc_double_negate_into(dc_complex_double* dst, dc_complex_double c);
+/**
+ * @brief Complex conjugate, storing the result in *dst
+ * @param dst Destination (must not be NULL; *dst may be NULL or alias c)
+ * @param c The complex number (must not be NULL)
+ */
+DC_DEC void dc_double_conj_into(dc_complex_double* dst, dc_complex_double c);
+/**
+ * @brief Add two complex numbers, consuming the first operand
+ * @param a First operand, released by the call (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ * @return Result, in a's node when a was uniquely owned
+ */
+DC_DEC dc_complex_double dc_double_add_steal(dc_complex_double a, dc_complex_double b);
+/**
+ * @brief Subtract two complex numbers, consuming the first operand
+ * @param a First operand, released by the call (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ * @return Result, in a's node when a was uniquely owned
+ */
+DC_DEC dc_complex_double dc_double_sub_steal(dc_complex_double a, dc_complex_double b);
+/**
+ * @brief Multiply two complex numbers, consuming the first operand
+ * @param a First operand, released by the call (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ * @return Result, in a's node when a was uniquely owned
+ */
+DC_DEC dc_complex_double dc_double_mul_steal(dc_complex_double a, dc_complex_double b);
+/**
+ * @brief Divide two complex numbers, consuming the first operand
+ * @param a First operand, released by the call (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ * @return Result, in a's node when a was uniquely owned
+ */
+DC_DEC dc_complex_double dc_double_div_steal(dc_complex_double a, dc_complex_double b);
+/**
+ * @brief Negate a complex number, consuming the operand
+ * @param c The complex number, released by the call (must not be NULL)
+ * @return Result, in c's node when c was uniquely owned
+ */
+DC_DEC dc_complex_double dc_double_negate_steal(dc_complex_double c);
+/**
+ * @brief Complex conjugate, consuming the operand
+ * @param c The complex number, released by the call (must not be NULL)
+ * @return Result, in c's node when c was uniquely owned
+ */
+DC_DEC dc_complex_double dc_double_conj_steal(dc_complex_double c);
+/** @} */
+
+// ============================================================================
+// DOUBLE COMPLEX ARRAY INTERFACE
+// ============================================================================
+
+/**
+ * @defgroup dc_double_array_functions Double Complex Array Functions
+ * @brief Element-wise arithmetic over structure-of-arrays complex buffers
+ *
+ * A dc_double_array stores n complex numbers as two aligned arrays of n
+ * doubles, so element-wise kernels run on full SIMD registers. On x86 with
+ * GCC or clang the add/sub/mul/conj kernels are vectorized for SSE2, AVX2 and
+ * AVX-512F and selected at runtime; elsewhere (or with DC_SIMD set to 0) a
+ * scalar loop is used.
+ *
+ * Every element of a result is bit-for-bit identical to the corresponding
+ * dc_double_* operation, provided the scalar code is not itself compiled to
+ * fused multiply-add instructions (e.g. by -march flags that enable FMA); the
+ * vector kernels never fuse. Multiplication lanes that produce
+ * NaN+NaNi are recomputed with the C99 infinity-recovery rules. Division,
+ * abs and arg run per element, because their libm/libgcc algorithms are not
+ * reproducible lane-wise.
+ * @{
+ */
+
+#define DC_DOUBLE_ARRAY_ALIGN 64
+
+/**
+ * @brief Create a zero-filled complex array
+ * @param length Number of elements (may be 0)
+ * @return New array with reference count 1
+ */
+DC_DEC dc_double_array dc_double_array_new(size_t length);
+
+/**
+ * @brief Create a complex array from interleaved C99 complex values
+ * @param values Source values (may be NULL only if length is 0)
+ * @param length Number of elements
+ * @return New array with reference count 1
+ */
+DC_DEC dc_double_array dc_double_array_from_values(const double complex* values, size_t length);
+
+/**
+ * @brief Create a complex array from separate real and imaginary parts
+ * @param real Real parts (may be NULL only if length is 0)
+ * @param imag Imaginary parts (may be NULL only if length is 0)
+ * @param length Number of elements
+ * @return New array with reference count 1
+ */
+DC_DEC dc_double_array dc_double_array_from_parts(const double* real, const double* imag, size_t length);
+
+/**
+ * @brief Increment reference count
+ * @param a The array (must not be NULL)
+ * @return The same array
+ */
+DC_DEC dc_double_array dc_double_array_retain(dc_double_array a);
+
+/**
+ * @brief Decrement reference count and free if zero
+ * @param a Pointer to the array (may point to NULL)
+ * @note Sets *a to NULL
+ */
+DC_DEC void dc_double_array_release(dc_double_array* a);
+
+/**
+ * @brief Create an independent copy of an array
+ * @param a The array (must not be NULL)
+ * @return New array with reference count 1
+ */
+DC_DEC dc_double_array dc_double_array_copy(dc_double_array a);
+
+/**
+ * @brief Get the number of elements
+ * @param a The array (must not be NULL)
+ * @return Number of elements
+ */
+DC_DEC size_t dc_double_array_length(dc_double_array a);
+
+/**
+ * @brief Get the real parts
+ * @param a The array (must not be NULL)
+ * @return Pointer to length aligned, writable doubles owned by the array
+ */
+DC_DEC double* dc_double_array_real(dc_double_array a);
+
+/**
+ * @brief Get the imaginary parts
+ * @param a The array (must not be NULL)
+ * @return Pointer to length aligned, writable doubles owned by the array
+ */
+DC_DEC double* dc_double_array_imag(dc_double_array a);
+
+/**
+ * @brief Get one element
+ * @param a The array (must not be NULL)
+ * @param index Element index (must be less than the length)
+ * @return The element as a C99 complex value
+ */
+DC_DEC double complex dc_double_array_get(dc_double_array a, size_t index);
+
+/**
+ * @brief Set one element
+ * @param a The array (must not be NULL)
+ * @param index Element index (must be less than the length)
+ * @param value New value
+ */
+DC_DEC void dc_double_array_set(dc_double_array a, size_t index, double complex value);
+
+/**
+ * @brief Copy all elements out as interleaved C99 complex values
+ * @param a The array (must not be NULL)
+ * @param out Destination for length values (may be NULL only if length is 0)
+ */
+DC_DEC void dc_double_array_to_values(dc_double_array a, double complex* out);
+
+/**
+ * @brief Element-wise addition
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL, same length as a)
+ * @return New array with reference count 1
+ */
+DC_DEC dc_double_array dc_double_array_add(dc_double_array a, dc_double_array b);
+
+/**
+ * @brief Element-wise subtraction
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL, same length as a)
+ * @return New array with reference count 1
+ */
+DC_DEC dc_double_array dc_double_array_sub(dc_double_array a, dc_double_array b);
+
+/**
+ * @brief Element-wise multiplication
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL, same length as a)
+ * @return New array with reference count 1
+ */
+DC_DEC dc_double_array dc_double_array_mul(dc_double_array a, dc_double_array b);
+
+/**
+ * @brief Element-wise division
+ * @param a Dividends (must not be NULL)
+ * @param b Divisors (must not be NULL, same length as a)
+ * @return New array with reference count 1
+ * @note Asserts on division by zero
+ */
+DC_DEC dc_double_array dc_double_array_div(dc_double_array a, dc_double_array b);
+
+/**
+ * @brief Element-wise complex conjugate
+ * @param a The array (must not be NULL)
+ * @return New array with reference count 1
+ */
+DC_DEC dc_double_array dc_double_array_conj(dc_double_array a);
+
+/**
+ * @brief Element-wise addition into an existing array
+ * @param dst Destination (must not be NULL, same length; may alias a or b)
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ */
+DC_DEC void dc_double_array_add_into(dc_double_array dst, dc_double_array a, dc_double_array b);
+
+/**
+ * @brief Element-wise subtraction into an existing array
+ * @param dst Destination (must not be NULL, same length; may alias a or b)
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ */
+DC_DEC void dc_double_array_sub_into(dc_double_array dst, dc_double_array a, dc_double_array b);
+
+/**
+ * @brief Element-wise multiplication into an existing array
+ * @param dst Destination (must not be NULL, same length; may alias a or b)
+ * @param a First operand (must not be NULL)
+ * @param b Second operand (must not be NULL)
+ */
+DC_DEC void dc_double_array_mul_into(dc_double_array dst, dc_double_array a, dc_double_array b);
+
+/**
+ * @brief Element-wise division into an existing array
+ * @param dst Destination (must not be NULL, same length; may alias a or b)
+ * @param a Dividends (must not be NULL)
+ * @param b Divisors (must not be NULL)
+ * @note Asserts on division by zero
+ */
+DC_DEC void dc_double_array_div_into(dc_double_array dst, dc_double_array a, dc_double_array b);
+
+/**
+ * @brief Element-wise complex conjugate into an existing array
+ * @param dst Destination (must not be NULL, same length; may alias a)
+ * @param a The array (must not be NULL)
+ */
+DC_DEC void dc_double_array_conj_into(dc_double_array dst, dc_double_array a);
+
+/**
+ * @brief Element-wise magnitude
+ * @param a The array (must not be NULL)
+ * @param out Destination for length doubles (may be NULL only if length is 0)
+ */
+DC_DEC void dc_double_array_abs(dc_double_array a, double* out);
+
+/**
+ * @brief Element-wise argument (phase angle) in radians
+ * @param a The array (must not be NULL)
+ * @param out Destination for length doubles (may be NULL only if length is 0)
+ */
+DC_DEC void dc_double_array_arg(dc_double_array a, double* out);
+
+/**
+ * @brief Element-wise complex exponential
+ * @param a The array (must not be NULL)
+ * @return New array with reference count 1
+ * @note Vectorized for |Re| <= 708 and |Im| <= 2^20; at most 3 ulp per component
+ */
+DC_DEC dc_double_array dc_double_array_exp(dc_double_array a);
+
+/**
+ * @brief Element-wise complex natural logarithm (principal branch)
+ * @param a The array (must not be NULL, no zero elements)
+ * @return New array with reference count 1
+ * @note Vectorized for finite elements with normal magnitude; at most 3 ulp per component
+ */
+DC_DEC dc_double_array dc_double_array_log(dc_double_array a);
+
+/**
+ * @brief Element-wise complex sine
+ * @param a The array (must not be NULL)
+ * @return New array with reference count 1
+ * @note Vectorized for |Re| <= 2^20 and |Im| <= 708; at most 4 ulp per component
+ */
+DC_DEC dc_double_array dc_double_array_sin(dc_double_array a);
+
+/**
+ * @brief Element-wise complex cosine
+ * @param a The array (must not be NULL)
+ * @return New array with reference count 1
+ * @note Vectorized for |Re| <= 2^20 and |Im| <= 708; at most 4 ulp per component
+ */
+DC_DEC dc_double_array dc_double_array_cos(dc_double_array a);
+
+/**
+ * @brief Element-wise complex square root (principal branch)
+ * @param a The array (must not be NULL)
+ * @return New array with reference count 1
+ * @note Vectorized for max(|Re|, |Im|) in [2^-510, 2^510]; at most 3 ulp per component
+ */
+DC_DEC dc_double_array dc_double_array_sqrt(dc_double_array a);
+
+/**
+ * @brief Element-wise complex exponential into an existing array
+ * @param dst Destination (must not be NULL, same length; may alias a)
+ * @param a The array (must not be NULL)
+ */
+DC_DEC void dc_double_array_exp_into(dc_double_array dst, dc_double_array a);
+
+/**
+ * @brief Element-wise complex natural logarithm into an existing array
+ * @param dst Destination (must not be NULL, same length; may alias a)
+ * @param a The array (must not be NULL, no zero elements)
+ */
+DC_DEC void dc_double_array_log_into(dc_double_array dst, dc_double_array a);
+
+/**
+ * @brief Element-wise complex sine into an existing array
+ * @param dst Destination (must not be NULL, same length; may alias a)
+ * @param a The array (must not be NULL)
+ */
+DC_DEC void dc_double_array_sin_into(dc_double_array dst, dc_double_array a);
+
+/**
+ * @brief Element-wise complex cosine into an existing array
+ * @param dst Destination (must not be NULL, same length; may alias a)
+ * @param a The array (must not be NULL)
+ */
+DC_DEC void dc_double_array_cos_into(dc_double_array dst, dc_double_array a);
+
+/**
+ * @brief Element-wise complex square root into an existing array
+ * @param dst Destination (must not be NULL, same length; may alias a)
+ * @param a The array (must not be NULL)
+ */
+DC_DEC void dc_double_array_sqrt_into(dc_double_array dst, dc_double_array a);
+
+/**
+ * @brief Name of the instruction set selected for array kernels
+ * @return "avx512f", "avx2", "sse2", "vector" (generic vector extensions) or "scalar"
+ */
+DC_DEC const char* dc_double_array_simd_level(void);
+
+/** @} */
+
+// ============================================================================
+// FAST FOURIER TRANSFORM INTERFACE
+// ============================================================================
+
+/**
+ * @defgroup dc_fft_functions Fast Fourier Transform Functions
+ * @brief Discrete Fourier transforms over complex and real sequences
+ *
+ * Transforms use a Stockham autosort algorithm with radix-4, 2, 3 and 5
+ * stages, so any size of the form 2^a * 3^b * 5^c is supported and results
+ * come out in natural order without a bit-reversal pass. A plan holds the
+ * twiddle factors and scratch space for one size; after planning, no
+ * transform allocates.
+ *
+ * The forward transform computes X[k] = sum x[j] e^(-2 pi i jk/n). The
+ * inverse uses e^(+2 pi i jk/n) and divides by n, so inverse(forward(x))
+ * reproduces x up to rounding.
+ *
+ * dc_fft_plan_new() caches plans per thread: later requests for the same
+ * size on the same thread return the cached plan. Because a plan owns its
+ * scratch space, a single plan must not execute two transforms at once;
+ * threads that each obtain their own plan from dc_fft_plan_new() are safe.
+ * @{
+ */
+
+/**
+ * @brief Check whether a transform size is supported
+ * @param n Number of points
+ * @return true if n > 0 and n has no prime factors other than 2, 3 and 5
+ */
+DC_DEC bool dc_fft_size_supported(size_t n);
+
+/**
+ * @brief Get a transform plan for n points
+ * @param n Number of points (must satisfy dc_fft_size_supported)
+ * @return Plan with an added reference; release with dc_fft_plan_release
+ * @note Plans are cached per thread, so repeated calls with the same size
+ *       return the same plan without recomputing twiddles
+ */
+DC_DEC dc_fft_plan dc_fft_plan_new(size_t n);
+
+/**
+ * @brief Increment reference count
+ * @param plan The plan (must not be NULL)
+ * @return The same plan
+ */
+DC_DEC dc_fft_plan dc_fft_plan_retain(dc_fft_plan plan);
+
+/**
+ * @brief Decrement reference count and free if zero
+ * @param plan Pointer to the plan (may point to NULL)
+ * @note Sets *plan to NULL; cached plans stay alive until dc_fft_plan_cache_clear
+ */
+DC_DEC void dc_fft_plan_release(dc_fft_plan* plan);
+
+/**
+ * @brief Get the number of points a plan transforms
+ * @param plan The plan (must not be NULL)
+ * @return Transform size
+ */
+DC_DEC size_t dc_fft_plan_size(dc_fft_plan plan);
+
+/**
+ * @brief Drop the calling thread's cached plans
+ * @note Plans still referenced elsewhere stay valid until released
+ */
+DC_DEC void dc_fft_plan_cache_clear(void);
+
+/**
+ * @brief Forward transform of separate real and imaginary parts, in place
+ * @param plan The plan (must not be NULL)
+ * @param real Real parts, plan size elements (must not be NULL)
+ * @param imag Imaginary parts, plan size elements (must not be NULL)
+ */
+DC_DEC void dc_fft_forward(dc_fft_plan plan, double* real, double* imag);
+
+/**
+ * @brief Normalized inverse transform of separate real and imaginary parts, in place
+ * @param plan The plan (must not be NULL)
+ * @param real Real parts, plan size elements (must not be NULL)
+ * @param imag Imaginary parts, plan size elements (must not be NULL)
+ */
+DC_DEC void dc_fft_inverse(dc_fft_plan plan, double* real, double* imag);
+
+/**
+ * @brief Forward transform of interleaved C99 complex values, in place
+ * @param plan The plan (must not be NULL)
+ * @param values Plan size values (must not be NULL)
+ */
+DC_DEC void dc_fft_forward_values(dc_fft_plan plan, double complex* values);
+
+/**
+ * @brief Normalized inverse transform of interleaved C99 complex values, in place
+ * @param plan The plan (must not be NULL)
+ * @param values Plan size values (must not be NULL)
+ */
+DC_DEC void dc_fft_inverse_values(dc_fft_plan plan, double complex* values);
+
+/**
+ * @brief Forward transform of a real sequence
+ * @param plan Plan for the length of the real input (must not be NULL)
+ * @param input n real samples (must not be NULL)
+ * @param out_real Receives n/2 + 1 real parts (must not be NULL)
+ * @param out_imag Receives n/2 + 1 imaginary parts (must not be NULL)
+ * @note Only the non-negative frequencies are produced; the rest follow from
+ *       X[n - k] = conj(X[k]). Even sizes run a half-length complex transform.
+ */
+DC_DEC void dc_fft_real_forward(dc_fft_plan plan, const double* input, double* out_real, double* out_imag);
+
+/**
+ * @brief Normalized inverse of dc_fft_real_forward
+ * @param plan Plan for the length of the real output (must not be NULL)
+ * @param in_real n/2 + 1 real parts (must not be NULL)
+ * @param in_imag n/2 + 1 imaginary parts (must not be NULL)
+ * @param output Receives n real samples (must not be NULL)
+ * @note The imaginary parts of bin 0 and, for even n, bin n/2 are ignored,
+ *       since they are zero for the spectrum of any real sequence
+ */
+DC_DEC void dc_fft_real_inverse(dc_fft_plan plan, const double* in_real, const double* in_imag, double* output);
+
+/**
+ * @brief Forward transform of a complex array
+ * @param a The array (must not be NULL, supported length or empty)
+ * @return New array with reference count 1
+ */
+DC_DEC dc_double_array dc_double_array_fft(dc_double_array a);
+
+/**
+ * @brief Normalized inverse transform of a complex array
+ * @param a The array (must not be NULL, supported length or empty)
+ * @return New array with reference count 1
+ */
+DC_DEC dc_double_array dc_double_array_ifft(dc_double_array a);
+
+/**
+ * @brief Forward transform of a complex array into an existing array
+ * @param dst Destination (must not be NULL, same length; may alias a)
+ * @param a The array (must not be NULL, supported length or empty)
+ */
+DC_DEC void dc_double_array_fft_into(dc_double_array dst, dc_double_array a);
+
+/**
+ * @brief Normalized inverse transform of a complex array into an existing array
+ * @param dst Destination (must not be NULL, same length; may alias a)
+ * @param a The array (must not be NULL, supported length or empty)
+ */
+DC_DEC void dc_double_array_ifft_into(dc_double_array dst, dc_double_array a);
+
+/** @} */
+
+// ============================================================================
+// GAUSSIAN INTEGER POLYNOMIAL INTERFACE
+// ============================================================================
+
+/**
+ * @defgroup dc_poly_functions Gaussian Integer Polynomial Functions
+ * @brief Exact products of polynomials with dc_complex_int coefficients
+ * @{
+ */
+
+/**
+ * @brief Multiply two polynomials with Gaussian integer coefficients
+ * @param result Receives a_len + b_len - 1 new coefficients (must not overlap a or b)
+ * @param a Coefficients of the first polynomial, lowest degree first
+ * @param a_len Number of coefficients in a (0 gives an empty product)
+ * @param b Coefficients of the second polynomial, lowest degree first
+ * @param b_len Number of coefficients in b (0 gives an empty product)
+ * @note Each result slot receives a reference the caller must release;
+ *       previous contents of the slots are overwritten, not released.
+ *
+ * The product is exact. Once the shorter operand reaches
+ * DC_POLY_NTT_THRESHOLD coefficients (scaled up by the square root of the
+ * coefficient width) it is computed with number-theoretic transforms modulo
+ * word-sized primes p = 1 (mod 4). Each such prime has a square root of -1,
+ * so a + bi maps to a + b*sqrt(-1) and a - b*sqrt(-1), and two cyclic
+ * convolutions per prime recover the real and imaginary parts. Enough
+ * primes are used to cover the coefficient bound and the results are
+ * rebuilt with Garner's CRT algorithm, so the cost is O(n log n) per prime
+ * instead of O(n^2) dc_int_mul calls.
+ */
+DC_DEC void dc_int_poly_mul(dc_complex_int* result, const dc_complex_int* a, size_t a_len, const dc_complex_int* b,
+                            size_t b_len);
+
+/** @} */
+
+// ============================================================================
+// TYPE CONVERSION INTERFACE
+// ============================================================================
+
+/**
+ * @defgroup dc_conversion_functions Type Conversion Functions
+ * @brief Functions for converting between complex number types
+ * @{
+ */
+
+/* Upward conversions (lossless) */
+
+/**
+ * @brief Convert Gaussian integer to rational complex (lossless)
+ * @param c The Gaussian integer (must not be NULL)
+ * @return New rational complex number with same value
+ * @note Result has reference count of 1
+ * @note Conversion is exact: integer n becomes n/1
+ */
+DC_DEC dc_complex_frac dc_int_to_frac(dc_complex_int c);
+
+/**
+ * @brief Convert Gaussian integer to floating-point complex (lossless for small integers)
+ * @param c The Gaussian integer (must not be NULL)
+ * @return New floating-point complex number
+ * @note Result has reference count of 1
+ * @note Large integers may lose precision due to double limits
+ */
+DC_DEC dc_complex_double dc_int_to_double(dc_complex_int c);
+
+/**
+ * @brief Convert rational complex to floating-point complex
+ * @param c The rational complex number (must not be NULL)
+ * @return New floating-point complex number
+ * @note Result has reference count of 1
+ * @note Precision may be lost due to floating-point representation
+ */
+DC_DEC dc_complex_double dc_frac_to_double(dc_complex_frac c);
+
+/* Downward conversions (may round) */
+
+/**
+ * @brief Convert rational complex to Gaussian integer (with rounding)
+ * @param c The rational complex number (must not be NULL)
+ * @return New Gaussian integer (rounded to nearest)
+ * @note Result has reference count of 1
+ * @note Both real and imaginary parts rounded to nearest integer
+ * @note Use dc_frac_is_gaussian_int() to check if conversion is exact
+ */
+DC_DEC dc_complex_int dc_frac_to_int(dc_complex_frac c);
+
+/**
+ * @brief Convert floating-point complex to Gaussian integer (with rounding)
+ * @param c The floating-point complex number (must not be NULL)
+ * @return New Gaussian integer (rounded to nearest)
+ * @note Result has reference count of 1
+ * @note Both real and imaginary parts rounded to nearest integer
+ * @note NaN and infinity values may produce undefined behavior
+ */
+DC_DEC dc_complex_int dc_double_to_int(dc_complex_double c);
+
+/**
+ * @brief Convert floating-point complex to rational complex (with approximation)
+ * @param c The floating-point complex number (must not be NULL)
+ * @param max_denominator Maximum allowed denominator for approximation
+ * @return New rational complex number approximating the input
+ * @note Result has reference count of 1
+ * @note Uses continued fraction approximation
+ * @note Larger max_denominator gives better approximation but larger fractions
+ */
+DC_DEC dc_complex_frac dc_double_to_frac(dc_complex_double c, int64_t max_denominator);
+
+/** @} */
+
+// ============================================================================
+// SERIALIZATION INTERFACE
+// ============================================================================
+
+/**
+ * @defgroup dc_serial_functions Binary Serialization Functions
+ * @brief Compact, versioned little-endian encoding of complex numbers
+ *
+ * A value is one tag byte, (DC_SERIAL_VERSION << 4) | kind, followed by its
+ * components. Each integer is a LEB128 varint holding 2 * limb_count + sign,
+ * then limb_count 32-bit little-endian magnitude limbs (zero has none), so a
+ * Gaussian integer with small parts takes a handful of bytes. Fractions store
+ * numerator and denominator per part; common-denominator values store real,
+ * imaginary and denominator; doubles store two IEEE 754 binary64 values.
+ *
+ * Encodings are self-delimiting: deserialize reports the bytes it consumed,
+ * so values can be packed back to back in one buffer. Limbs are read straight
+ * from the caller's buffer with no intermediate copy of the input.
+ * @{
+ */
+
+/** @brief Format version stored in the high nibble of every tag byte */
+#define DC_SERIAL_VERSION 1
+
+/**
+ * @brief Number of bytes dc_int_serialize() writes for c
+ * @param c The Gaussian integer (must not be NULL)
+ * @return Encoded size in bytes
+ */
+DC_DEC size_t dc_int_serialized_size(dc_complex_int c);
+
+/**
+ * @brief Encode a Gaussian integer into a caller buffer
+ * @param c The Gaussian integer (must not be NULL)
+ * @param buffer Destination buffer
+ * @param capacity Size of the buffer in bytes
+ * @return Bytes written, or 0 if capacity is less than dc_int_serialized_size(c)
+ */
+DC_DEC size_t dc_int_serialize(dc_complex_int c, uint8_t* buffer, size_t capacity);
+
+/**
+ * @brief Decode a Gaussian integer written by dc_int_serialize()
+ * @param buffer Encoded bytes
+ * @param length Bytes available in the buffer
+ * @param consumed If not NULL, receives the size of the encoding read
+ * @return New Gaussian integer, or NULL if the input is truncated, malformed or of another kind
+ * @note Result has reference count of 1
+ */
+DC_DEC dc_complex_int dc_int_deserialize(const uint8_t* buffer, size_t length, size_t* consumed);
+
+/**
+ * @brief Number of bytes dc_frac_serialize() writes for c
+ * @param c The rational complex number (must not be NULL)
+ * @return Encoded size in bytes
+ */
+DC_DEC size_t dc_frac_serialized_size(dc_complex_frac c);
+
+/**
+ * @brief Encode a rational complex number into a caller buffer
+ * @param c The rational complex number (must not be NULL)
+ * @param buffer Destination buffer
+ * @param capacity Size of the buffer in bytes
+ * @return Bytes written, or 0 if capacity is less than dc_frac_serialized_size(c)
+ * @note Parts are written as stored; a lazily reduced value stays unreduced
+ */
+DC_DEC size_t dc_frac_serialize(dc_complex_frac c, uint8_t* buffer, size_t capacity);
+
+/**
+ * @brief Decode a rational complex number written by dc_frac_serialize()
+ * @param buffer Encoded bytes
+ * @param length Bytes available in the buffer
+ * @param consumed If not NULL, receives the size of the encoding read
+ * @return New rational complex number, or NULL if the input is truncated, malformed or of another kind
+ * @note Result has reference count of 1
+ * @note Denominators must be positive, and unless the value was written lazily each part must be
+ *       in lowest terms (one gcd per part); other encodings are rejected as malformed
+ */
+DC_DEC dc_complex_frac dc_frac_deserialize(const uint8_t* buffer, size_t length, size_t* consumed);
+
+/**
+ * @brief Number of bytes dc_cfrac_serialize() writes for c
+ * @param c The common-denominator rational (must not be NULL)
+ * @return Encoded size in bytes
+ */
+DC_DEC size_t dc_cfrac_serialized_size(dc_complex_cfrac c);
+
+/**
+ * @brief Encode a common-denominator rational into a caller buffer
+ * @param c The common-denominator rational (must not be NULL)
+ * @param buffer Destination buffer
+ * @param capacity Size of the buffer in bytes
+ * @return Bytes written, or 0 if capacity is less than dc_cfrac_serialized_size(c)
+ */
+DC_DEC size_t dc_cfrac_serialize(dc_complex_cfrac c, uint8_t* buffer, size_t capacity);
+
+/**
+ * @brief Decode a common-denominator rational written by dc_cfrac_serialize()
+ * @param buffer Encoded bytes
+ * @param length Bytes available in the buffer
+ * @param consumed If not NULL, receives the size of the encoding read
+ * @return New common-denominator rational, or NULL if the input is truncated, malformed or of another kind
+ * @note Result has reference count of 1
+ * @note The denominator must be positive and gcd(real, imag, den) must be 1; the value is
+ *       checked, not re-reduced, so other encodings are rejected as malformed
+ */
+DC_DEC dc_complex_cfrac dc_cfrac_deserialize(const uint8_t* buffer, size_t length, size_t* consumed);
+
+/**
+ * @brief Number of bytes dc_double_serialize() writes (always 17)
+ * @param c The floating-point complex number (must not be NULL)
+ * @return Encoded size in bytes
+ */
+DC_DEC size_t dc_double_serialized_size(dc_complex_double c);
+
+/**
+ * @brief Encode a floating-point complex number into a caller buffer
+ * @param c The floating-point complex number (must not be NULL)
+ * @param buffer Destination buffer
+ * @param capacity Size of the buffer in bytes
+ * @return Bytes written, or 0 if capacity is less than dc_double_serialized_size(c)
+ * @note The bit patterns are kept, including signed zeros and NaN payloads
+ */
+DC_DEC size_t dc_double_serialize(dc_complex_double c, uint8_t* buffer, size_t capacity);
+
+/**
+ * @brief Decode a floating-point complex number written by dc_double_serialize()
+ * @param buffer Encoded bytes
+ * @param length Bytes available in the buffer
+ * @param consumed If not NULL, receives the size of the encoding read
+ * @return New floating-point complex number, or NULL if the input is truncated or of another kind
+ * @note Result has reference count of 1
+ */
+DC_DEC dc_complex_double dc_double_deserialize(const uint8_t* buffer, size_t length, size_t* consumed);
+
+/** @} */
+
+// ============================================================================
+// COLUMNAR FILE INTERFACE
+// ============================================================================
+
+/**
+ * @defgroup dc_array_file_functions Columnar Array File Functions
+ * @brief On-disk dc_double_array format that loads as a view without copying
+ *
+ * A file is a 64-byte little-endian header followed by the real column and
+ * the imaginary column, each padded to DC_DOUBLE_ARRAY_ALIGN bytes:
+ *
+ * | Offset | Field                                            |
+ * |--------|--------------------------------------------------|
+ * | 0      | magic "DCARRAY" and a zero byte                  |
+ * | 8      | u32 version (DC_ARRAY_FILE_VERSION)              |
+ * | 12     | u32 flags (bit 0: column checksums present)      |
+ * | 16     | u64 element count                                |
+ * | 24     | u64 offset of the real column                    |
+ * | 32     | u64 offset of the imaginary column               |
+ * | 40     | u32 CRC-32 of the real column                    |
+ * | 44     | u32 CRC-32 of the imaginary column               |
+ * | 48     | u32 CRC-32 of bytes 0-47                         |
+ * | 52     | reserved, zero                                   |
+ *
+ * Columns are raw IEEE 754 doubles, so dc_double_array_map() can point an
+ * array straight at them. Element data is only paged in as it is touched.
+ * Files are written and read only on little-endian hosts; elsewhere these
+ * functions fail.
+ * @{
+ */
+
+/** @brief Format version stored in columnar array file headers */
+#define DC_ARRAY_FILE_VERSION 1
+
+/**
+ * @brief Write an array to a columnar file
+ * @param a The array (must not be NULL)
+ * @param path File to create or replace
+ * @param checksums Store CRC-32 checksums of both columns
+ * @return true on success, false on an I/O error
+ */
+DC_DEC bool dc_double_array_save(dc_double_array a, const char* path, bool checksums);
+
+/**
+ * @brief Open a columnar file as an array
+ * @param path File written by dc_double_array_save() or a dc_double_array_writer
+ * @param verify Check the column checksums, if the file has them
+ * @return New array with reference count 1, or NULL if the file cannot be read,
+ *         is truncated or malformed, or fails verification
+ * @note With DC_MMAP the array is a private mapping of the file: no data is
+ *       copied, and writes to the array are copy-on-write and never reach the
+ *       file. The mapping is removed when the last reference is released.
+ * @note Without DC_MMAP the columns are read into a heap array
+ */
+DC_DEC dc_double_array dc_double_array_map(const char* path, bool verify);
+
+/**
+ * @brief Start a columnar file whose length is not known in advance
+ * @param path File to create or replace
+ * @param checksums Store CRC-32 checksums of both columns
+ * @return New writer, or NULL if the file or its spool file cannot be created
+ * @note The imaginary column is spooled to a temporary file and copied behind
+ *       the real one by dc_double_array_writer_close(). Until then the header
+ *       is zero, so an interrupted file is never taken for a valid one.
+ */
+DC_DEC dc_double_array_writer dc_double_array_writer_open(const char* path, bool checksums);
+
+/**
+ * @brief Append a chunk of elements
+ * @param w The writer (must not be NULL)
+ * @param real Real parts (may be NULL only if count is 0)
+ * @param imag Imaginary parts (may be NULL only if count is 0)
+ * @param count Number of elements in the chunk
+ * @return true on success; false on an I/O error, after which the file is
+ *         left invalid and every later call fails
+ */
+DC_DEC bool dc_double_array_writer_append(dc_double_array_writer w, const double* real, const double* imag,
+                                          size_t count);
+
+/**
+ * @brief Finish the file and free the writer
+ * @param w Pointer to the writer; set to NULL
+ * @return true if every append and the final writes succeeded
+ */
+DC_DEC bool dc_double_array_writer_close(dc_double_array_writer* w);
+
+/** @} */
+
+// ============================================================================
+// REFERENCE COUNTING INTERFACE
+// ============================================================================
+
+/**
+ * @brief Merge values other threads handed back to the calling thread
+ * @note Only does work with DC_BIASED_REFCOUNT, where values released by a thread other than the
+ *       one that created them may be queued on their creator. Creators merge their queue on every
+ *       allocation; call this before a thread that created shared values goes idle.
+ */
+DC_DEC void dc_refcount_flush(void);
+
+/**
+ * @brief Stop owning the values the calling thread created
+ * @note Only does work with DC_BIASED_REFCOUNT. Merges the thread's queue one last time; values
+ *       whose last reference is dropped afterwards are freed by the releasing thread. Runs
+ *       automatically when a thread exits on POSIX systems; call it before a thread exits elsewhere.
+ *       A thread that keeps running afterwards owns the values it creates from then on.
+ */
+DC_DEC void dc_refcount_detach(void);
+
+#if DC_STATS
+// ============================================================================
+// STATISTICS INTERFACE
+// ============================================================================
+
+/**
+ * @brief Read the allocation and operation counters of all threads
+ * @param stats Output counters (must not be NULL)
+ * @note Only available when DC_STATS is enabled
+ * @note Each thread counts into its own record without atomic read-modify-writes; records are
+ *       summed here, so a snapshot taken while other threads run is not an instant in time
+ * @note Cumulative counters start from the last dc_stats_reset(); live counts are never reset.
+ *       Nodes abandoned to dc_arena_end() stay counted as live.
+ * @note Dependency allocations and di_mul/di_gcd calls are only seen when dynamic_complex.h is
+ *       included before dynamic_int.h and dynamic_fraction.h and their allocators are not overridden;
+ *       dynamic_fraction's calls are counted when DF_IMPLEMENTATION is defined alongside DC_IMPLEMENTATION
+ */
+DC_DEC void dc_stats_snapshot(dc_stats* stats);
+
+/**
+ * @brief Restart the cumulative counters (allocations, frees, bytes, di_mul and di_gcd calls) at zero
+ * @note Only available when DC_STATS is enabled
+ */
+DC_DEC void dc_stats_reset(void);
+#endif
+
+#if DC_TRACK_ALLOCS
+// ============================================================================
+// ALLOCATION TRACKING INTERFACE
+// ============================================================================
+
+/**
+ * @brief Print the live values created through each call site, most first
+ * @param out Stream to write to (must not be NULL)
+ * @return Number of live values attributed to a call site
+ * @note Only available when DC_TRACK_ALLOCS is enabled, which also dumps to stderr at exit when
+ *       anything is still live
+ * @note Sites are recorded by macros that wrap the constructors, arithmetic and conversions returning
+ *       a new value. Values created by other calls (_into destinations, xgcd cofactors, calls inside
+ *       this library) are not attributed; immortal values and arena values are not tracked.
+ */
+DC_DEC size_t dc_track_dump(FILE* out);
+
+/**
+ * @brief Attribute a newly created value to a call site
+ * @param c Value returned by a dc_int_* call (returned unchanged)
+ * @param file Source file of the call
+ * @param line Source line of the call
+ * @param api Name of the function called
+ * @return c
+ * @note Called by the DC_TRACK_ALLOCS wrapper macros; values that already have a site keep it
+ */
+DC_DEC dc_complex_int dc_int_track(dc_complex_int c, const char* file, int line, const char* api);
+
+/** @brief dc_int_track() for rational complex numbers */
+DC_DEC dc_complex_frac dc_frac_track(dc_complex_frac c, const char* file, int line, const char* api);
+
+/** @brief dc_int_track() for common-denominator rational complex numbers */
+DC_DEC dc_complex_cfrac dc_cfrac_track(dc_complex_cfrac c, const char* file, int line, const char* api);
+
+/** @brief dc_int_track() for floating-point complex numbers */
+DC_DEC dc_complex_double dc_double_track(dc_complex_double c, const char* file, int line, const char* api);
+#endif
+
+#if DC_ARENA
+
+// ============================================================================
+// ARENA ALLOCATION INTERFACE
+// ============================================================================
+
+/**
+ * @defgroup dc_arena_functions Arena Allocation Functions
+ * @brief Expression-scoped bump allocation for short-lived temporaries
+ *
+ * While a scope opened by dc_arena_begin() is active on the calling thread,
+ * every complex number, dynamic integer and fraction allocated on that thread
+ * is bump-allocated from a thread-local region, and releasing it is a no-op.
+ * dc_arena_end() frees everything allocated since the matching
+ * dc_arena_begin() in one shot. Values that must outlive the scope are
+ * promoted to the heap with dc_int_escape(), dc_frac_escape(),
+ * dc_cfrac_escape() or dc_double_escape().
+ *
+ * dc_arena_end() does not run releases. An arena value that references a
+ * heap-allocated di_int or df_frac (for example one built from a value
+ * created before the scope) holds a reference that is only dropped when the
+ * arena value itself is released, so such values must be released
+ * explicitly before the scope closes or the heap parts leak.
+ *
+ * Arena values must not be passed to other threads. Strings returned by the
+ * dc_*_to_string() functions are always heap allocated.
+ *
+ * Only available when DC_ARENA is enabled. dynamic_complex.h must be
+ * included before dynamic_int.h and dynamic_fraction.h so their allocators
+ * can be routed through the arena.
+ * @{
+ */
+
+/**
+ * @brief Open an arena scope on the calling thread
+ * @note Scopes nest; each must be closed by a matching dc_arena_end()
+ */
+DC_DEC void dc_arena_begin(void);
+
+/**
+ * @brief Close the innermost arena scope, freeing everything allocated in it
+ * @note Any value allocated in the scope becomes invalid unless escaped
+ */
+DC_DEC void dc_arena_end(void);
+
+/**
+ * @brief Test if a pointer was allocated from the calling thread's arena
+ * @param ptr The pointer to test (may be NULL)
+ * @return true if ptr lies in an active arena region, false otherwise
+ */
+DC_DEC bool dc_arena_contains(const void* ptr);
+
+/**
+ * @brief Promote a Gaussian integer to the global heap
+ * @param c The complex number (must not be NULL)
+ * @return Heap copy with reference count 1, or c retained if it is not arena allocated
+ */
+DC_DEC dc_complex_int dc_int_escape(dc_complex_int c);
+
+/**
+ * @brief Promote a rational complex number to the global heap
+ * @param c The complex number (must not be NULL)
+ * @return Heap copy with reference count 1, or c retained if it is not arena allocated
+ */
+DC_DEC dc_complex_frac dc_frac_escape(dc_complex_frac c);
+
+/**
+ * @brief Promote a common-denominator rational complex number to the global heap
+ * @param c The complex number (must not be NULL)
+ * @return Heap copy with reference count 1, or c retained if it is not arena allocated
+ */
+DC_DEC dc_complex_cfrac dc_cfrac_escape(dc_complex_cfrac c);
+
+/**
+ * @brief Promote a floating-point complex number to the global heap
+ * @param c The complex number (must not be NULL)
+ * @return Heap copy with reference count 1, or c retained if it is not arena allocated
+ */
+DC_DEC dc_complex_double dc_double_escape(dc_complex_double c);
+
+/** @} */
+
+#endif
+
+// ============================================================================
+// IMPLEMENTATION
+// ============================================================================
+
+#ifdef DC_IMPLEMENTATION
+
+// ============================================================================
+// STATISTICS IMPLEMENTATION
+// ============================================================================
+
+#if DC_STATS
+
+enum {
+    DC_STAT_ALLOCATIONS,
+    DC_STAT_FREES,
+    DC_STAT_BYTES,
+    DC_STAT_LIVE_INT,
+    DC_STAT_LIVE_FRAC,
+    DC_STAT_LIVE_CFRAC,
+    DC_STAT_LIVE_DOUBLE,
+    DC_STAT_LIVE_ARRAY,
+    DC_STAT_LIVE_FFT_PLAN,
+    DC_STAT_DI_MUL,
+    DC_STAT_DI_GCD,
+    DC_STAT_COUNT
+};
+
+// Per-thread counters. Only the owning thread writes them (relaxed load and store, no read-modify-write);
+// records are linked on first use and never freed, so counts survive their thread. Live counts of a single
+// record may wrap below zero when values are freed by another thread; the sums are exact.
+typedef struct dc_stats_record {
+    _Atomic size_t counters[DC_STAT_COUNT];
+    struct dc_stats_record* next;
+} dc_stats_record;
+
+static _Atomic(dc_stats_record*) dc_stats_records = NULL;
+static DC_THREAD_LOCAL dc_stats_record* dc_stats_self = NULL;
+static _Atomic size_t dc_stats_baseline[DC_STAT_COUNT];
+
+// Records come from the user's allocator before it is wrapped below, so they are not counted
+static dc_stats_record* dc_stats_register(void) {
+    dc_stats_record* self = DC_MALLOC(sizeof(dc_stats_record));
+    DC_ASSERT(self && "dc_stats_register: allocation failed");
+
+    for (int k = 0; k < DC_STAT_COUNT; k++) atomic_init(&self->counters[k], 0);
+    self->next = atomic_load(&dc_stats_records);
+    while (!atomic_compare_exchange_weak(&dc_stats_records, &self->next, self)) {
+    }
+    dc_stats_self = self;
+    return self;
+}
+
+static void dc_stats_add(int counter, size_t n) {
+    dc_stats_record* self = dc_stats_self ? dc_stats_self : dc_stats_register();
+    size_t value = atomic_load_explicit(&self->counters[counter], memory_order_relaxed);
+    atomic_store_explicit(&self->counters[counter], value + n, memory_order_relaxed);
+}
+
+static void dc_stats_totals(size_t totals[DC_STAT_COUNT]) {
+    for (int k = 0; k < DC_STAT_COUNT; k++) totals[k] = 0;
+    for (dc_stats_record* r = atomic_load_explicit(&dc_stats_records, memory_order_acquire); r; r = r->next) {
+        for (int k = 0; k < DC_STAT_COUNT; k++) {
+            totals[k] += atomic_load_explicit(&r->counters[k], memory_order_relaxed);
+        }
+    }
+}
+
+static bool dc_stats_is_live(int counter) {
+    return counter >= DC_STAT_LIVE_INT && counter <= DC_STAT_LIVE_FFT_PLAN;
+}
+
+DC_DEF void* dc_stats_malloc(size_t size) {
+    void* ptr = DC_MALLOC(size);
+    if (ptr) {
+        dc_stats_add(DC_STAT_ALLOCATIONS, 1);
+        dc_stats_add(DC_STAT_BYTES, size);
+    }
+    return ptr;
+}
+
+DC_DEF void* dc_stats_realloc(void* ptr, size_t size) {
+    void* result = DC_REALLOC(ptr, size);
+    if (result) {
+        dc_stats_add(DC_STAT_ALLOCATIONS, 1);
+        dc_stats_add(DC_STAT_BYTES, size);
+    }
+    return result;
+}
+
+DC_DEF void dc_stats_free(void* ptr) {
+    if (ptr) dc_stats_add(DC_STAT_FREES, 1);
+    DC_FREE(ptr);
+}
+
+DC_DEF void dc_stats_count_di_mul(void) {
+    dc_stats_add(DC_STAT_DI_MUL, 1);
+}
+
+DC_DEF void dc_stats_count_di_gcd(void) {
+    dc_stats_add(DC_STAT_DI_GCD, 1);
+}
+
+DC_DEF void dc_stats_snapshot(dc_stats* stats) {
+    DC_ASSERT(stats && "dc_stats_snapshot: stats cannot be NULL");
+
+    size_t totals[DC_STAT_COUNT];
+    dc_stats_totals(totals);
+    for (int k = 0; k < DC_STAT_COUNT; k++) {
+        if (!dc_stats_is_live(k)) totals[k] -= atomic_load_explicit(&dc_stats_baseline[k], memory_order_relaxed);
+    }
+
+    stats->allocations = totals[DC_STAT_ALLOCATIONS];
+    stats->frees = totals[DC_STAT_FREES];
+    stats->bytes_allocated = totals[DC_STAT_BYTES];
+    stats->live_ints = totals[DC_STAT_LIVE_INT];
+    stats->live_fracs = totals[DC_STAT_LIVE_FRAC];
+    stats->live_cfracs = totals[DC_STAT_LIVE_CFRAC];
+    stats->live_doubles = totals[DC_STAT_LIVE_DOUBLE];
+    stats->live_double_arrays = totals[DC_STAT_LIVE_ARRAY];
+    stats->live_fft_plans = totals[DC_STAT_LIVE_FFT_PLAN];
+    stats->di_mul_calls = totals[DC_STAT_DI_MUL];
+    stats->di_gcd_calls = totals[DC_STAT_DI_GCD];
+}
+
+DC_DEF void dc_stats_reset(void) {
+    size_t totals[DC_STAT_COUNT];
+    dc_stats_totals(totals);
+    for (int k = 0; k < DC_STAT_COUNT; k++) {
+        atomic_store_explicit(&dc_stats_baseline[k], totals[k], memory_order_relaxed);
+    }
+}
+
+// Every heap allocation below (and the arena's chunks) is counted
+#undef DC_MALLOC
+#undef DC_REALLOC
+#undef DC_FREE
+#define DC_MALLOC dc_stats_malloc
+#define DC_REALLOC dc_stats_realloc
+#define DC_FREE dc_stats_free
+
+#define DC_STATS_LIVE(counter, delta) dc_stats_add(counter, (size_t)(delta))
+#else
+#define DC_STATS_LIVE(counter, delta) ((void)0)
+#endif
+
+// ============================================================================
+// ALLOCATION TRACKING IMPLEMENTATION
+// ============================================================================
+
+#if DC_TRACK_ALLOCS
+
+enum { DC_TRACK_EMPTY, DC_TRACK_CLAIMED, DC_TRACK_READY };
+
+// One call site: the wrapper macros pass string literals, so sites are keyed by pointer
+struct dc_track_site {
+    _Atomic int state;
+    const char* file;
+    int line;
+    const char* api;
+    _Atomic size_t live;
+};
+
+// Open-addressed site table; slots are claimed once and never removed
+static struct dc_track_site dc_track_sites[DC_TRACK_SITES];
+static struct dc_track_site dc_track_overflow = {DC_TRACK_READY, "(site table full)", 0, "", 0};
+
+// Nodes start out pointing here until a wrapper tags them; untagged nodes are not counted, so
+// allocation itself touches no shared counter
+static struct dc_track_site dc_track_untagged;
+
+static atomic_bool dc_track_exit_registered = false;
+
+static void dc_track_at_exit(void) {
+    size_t live = 0;
+    for (size_t k = 0; k < DC_TRACK_SITES; k++) live += atomic_load(&dc_track_sites[k].live);
+    live += atomic_load(&dc_track_overflow.live);
+    if (live) dc_track_dump(stderr);
+}
+
+static struct dc_track_site* dc_track_lookup(const char* file, int line, const char* api) {
+    size_t hash = (size_t)(((uintptr_t)file ^ ((uintptr_t)api << 7) ^ (uintptr_t)line) * 0x9E3779B97F4A7C15ULL);
+
+    for (size_t probe = 0; probe < DC_TRACK_SITES; probe++) {
+        struct dc_track_site* site = &dc_track_sites[(hash + probe) % DC_TRACK_SITES];
+        int state = atomic_load_explicit(&site->state, memory_order_acquire);
+
+        if (state == DC_TRACK_EMPTY && atomic_compare_exchange_strong(&site->state, &state, DC_TRACK_CLAIMED)) {
+            site->file = file;
+            site->line = line;
+            site->api = api;
+            atomic_store_explicit(&site->state, DC_TRACK_READY, memory_order_release);
+
+            if (!atomic_exchange(&dc_track_exit_registered, true)) atexit(dc_track_at_exit);
+            return site;
+        }
+
+        // Another thread is filling the slot in
+        while (state == DC_TRACK_CLAIMED) state = atomic_load_explicit(&site->state, memory_order_acquire);
+        if (site->file == file && site->line == line && site->api == api) return site;
+    }
+    return &dc_track_overflow;
+}
+
+static void dc_track_tag(struct dc_track_site** slot, const char* file, int line, const char* api) {
+    if (*slot != &dc_track_untagged) return;
+
+    struct dc_track_site* site = dc_track_lookup(file, line, api);
+    atomic_fetch_add_explicit(&site->live, 1, memory_order_relaxed);
+    *slot = site;
+}
+
+// Drop a value from its site's count (freed or made immortal)
+static void dc_track_forget(struct dc_track_site** slot) {
+    struct dc_track_site* site = *slot;
+    if (site && site != &dc_track_untagged) atomic_fetch_sub_explicit(&site->live, 1, memory_order_relaxed);
+    *slot = NULL;
+}
+
+static int dc_track_compare(const void* a, const void* b) {
+    size_t live_a = atomic_load(&(*(struct dc_track_site* const*)a)->live);
+    size_t live_b = atomic_load(&(*(struct dc_track_site* const*)b)->live);
+    return live_a < live_b ? 1 : live_a > live_b ? -1 : 0;
+}
+
+DC_DEF size_t dc_track_dump(FILE* out) {
+    DC_ASSERT(out && "dc_track_dump: stream cannot be NULL");
+
+    struct dc_track_site** live = DC_MALLOC((DC_TRACK_SITES + 1) * sizeof(struct dc_track_site*));
+    DC_ASSERT(live && "dc_track_dump: allocation failed");
+
+    size_t count = 0, total = 0;
+    for (size_t k = 0; k < DC_TRACK_SITES; k++) {
+        struct dc_track_site* site = &dc_track_sites[k];
+        if (atomic_load_explicit(&site->state, memory_order_acquire) == DC_TRACK_READY && atomic_load(&site->live)) {
+            live[count++] = site;
+        }
+    }
+    if (atomic_load(&dc_track_overflow.live)) live[count++] = &dc_track_overflow;
+    qsort(live, count, sizeof(live[0]), dc_track_compare);
+
+    for (size_t k = 0; k < count; k++) total += atomic_load(&live[k]->live);
+    fprintf(out, "dc_track: %zu live value%s from %zu call site%s\n", total, total == 1 ? "" : "s", count,
+            count == 1 ? "" : "s");
+    for (size_t k = 0; k < count; k++) {
+        fprintf(out, "%10zu  %s:%d  %s\n", atomic_load(&live[k]->live), live[k]->file, live[k]->line, live[k]->api);
+    }
+
+    DC_FREE(live);
+    return total;
+}
+
+DC_DEF dc_complex_int dc_int_track(dc_complex_int c, const char* file, int line, const char* api) {
+    if (c) dc_track_tag(&c->site, file, line, api);
+    return c;
+}
+
+DC_DEF dc_complex_frac dc_frac_track(dc_complex_frac c, const char* file, int line, const char* api) {
+    if (c) dc_track_tag(&c->site, file, line, api);
+    return c;
+}
+
+DC_DEF dc_complex_cfrac dc_cfrac_track(dc_complex_cfrac c, const char* file, int line, const char* api) {
+    if (c) dc_track_tag(&c->site, file, line, api);
+    return c;
+}
+
+DC_DEF dc_complex_double dc_double_track(dc_complex_double c, const char* file, int line, const char* api) {
+    if (c) dc_track_tag(&c->site, file, line, api);
+    return c;
+}
+
+// Arena values are freed in bulk by dc_arena_end(), so they are never tracked
+#if DC_ARENA
+#define DC_TRACK_NEW(c) ((c)->site = dc_arena_active() ? NULL : &dc_track_untagged)
+#else
+#define DC_TRACK_NEW(c) ((c)->site = &dc_track_untagged)
+#endif
+#define DC_TRACK_FORGET(c) dc_track_forget(&(c)->site)
+#define DC_TRACK_SITE_INIT , NULL
+#else
+#define DC_TRACK_NEW(c) ((void)0)
+#define DC_TRACK_FORGET(c) ((void)0)
+#define DC_TRACK_SITE_INIT
+#endif
+
+// ============================================================================
+// REFERENCE COUNTING IMPLEMENTATION
+// ============================================================================
+
+// Value families, so a value merged from the owner's queue can be freed without its static type
+enum { DC_KIND_INT, DC_KIND_FRAC, DC_KIND_CFRAC, DC_KIND_DOUBLE };
+
+// Kept out of line so the free is never inlined into a release the compiler can see is applied to
+// an immortal constant; GCC would otherwise report -Wfree-nonheap-object on the unreachable path
+#if defined(__GNUC__) || defined(__clang__)
+#define DC_NOINLINE __attribute__((noinline))
+#else
+#define DC_NOINLINE
+#endif
+
+static DC_NOINLINE void dc_int_destroy(dc_complex_int c);
+static DC_NOINLINE void dc_frac_destroy(dc_complex_frac c);
+static DC_NOINLINE void dc_cfrac_destroy(dc_complex_cfrac c);
+static DC_NOINLINE void dc_double_free(dc_complex_double c);
+
+#if DC_BIASED_REFCOUNT
+
+// Free a value whose last reference was dropped; the count is the first member of every node
+static void dc_refcount_destroy(dc_refcount* rc, int kind) {
+    switch (kind) {
+        case DC_KIND_INT: dc_int_destroy((dc_complex_int)rc); break;
+        case DC_KIND_FRAC: dc_frac_destroy((dc_complex_frac)rc); break;
+        case DC_KIND_CFRAC: dc_cfrac_destroy((dc_complex_cfrac)rc); break;
+        default: dc_double_free((dc_complex_double)rc); break;
+    }
+}
+
+#define DC_SHARED_MERGED 1
+#define DC_SHARED_QUEUED 2
+#define DC_SHARED_ONE 4
+
+// Per-thread record that values point to as their owner. Other threads push values onto pending
+// (tagged with their kind in the low bits). Records are never freed, so releasing a value whose
+// creator has exited stays safe; once the creator detaches, pending holds DC_OWNER_DETACHED and
+// releasers fold the creator's count in themselves instead of queueing.
+typedef struct dc_refcount_owner {
+    _Atomic uintptr_t pending;
+    struct dc_refcount_owner* next;
+} dc_refcount_owner;
+
+// Never a queue entry, which always carries a node address
+#define DC_OWNER_DETACHED ((uintptr_t)1)
+
+static dc_refcount_owner dc_refcount_immortal_owner;
+static DC_THREAD_LOCAL dc_refcount_owner* dc_refcount_self = NULL;
+
+// Detached records stay listed here, since values may still point to them
+static _Atomic(dc_refcount_owner*) dc_refcount_detached = NULL;
+
+#define DC_REFCOUNT_IMMORTAL_INIT {0, 0, &dc_refcount_immortal_owner, 0}
+
+// Fold the owner's count of a queued value into its shared count; true when the value is dead.
+// A queued value is freed here only, even if the owner merged it in the meantime.
+static bool dc_refcount_fold(dc_refcount* rc) {
+    intptr_t delta = (intptr_t)rc->local * DC_SHARED_ONE - DC_SHARED_QUEUED;
+    if (rc->local) delta += DC_SHARED_MERGED;
+    rc->local = 0;
+    return DC_ATOMIC_FETCH_ADD(&rc->shared, delta) + delta == DC_SHARED_MERGED;
+}
+
+// Fold every queued value and free the dead ones, leaving `replacement` as the new queue head
+static void dc_refcount_drain_to(dc_refcount_owner* owner, uintptr_t replacement) {
+    uintptr_t entry = atomic_exchange(&owner->pending, replacement);
+    while (entry) {
+        dc_refcount* rc = (dc_refcount*)(entry & ~(uintptr_t)3);
+        int kind = (int)(entry & 3);
+        entry = rc->next;
+        if (dc_refcount_fold(rc)) dc_refcount_destroy(rc, kind);
+    }
+}
+
+static void dc_refcount_drain(dc_refcount_owner* owner) {
+    dc_refcount_drain_to(owner, 0);
+}
+
+static void dc_refcount_detach_owner(void* record) {
+    dc_refcount_owner* owner = record;
+    dc_refcount_drain_to(owner, DC_OWNER_DETACHED);
+
+    owner->next = atomic_load(&dc_refcount_detached);
+    while (!atomic_compare_exchange_weak(&dc_refcount_detached, &owner->next, owner)) {
+    }
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+// Threads detach their record automatically when they exit
+static pthread_key_t dc_refcount_exit_key;
+static pthread_once_t dc_refcount_exit_once = PTHREAD_ONCE_INIT;
+
+static void dc_refcount_exit_key_create(void) {
+    pthread_key_create(&dc_refcount_exit_key, dc_refcount_detach_owner);
+}
+#endif
+
+static dc_refcount_owner* dc_refcount_owner_get(void) {
+    if (!dc_refcount_self) {
+        dc_refcount_owner* self = DC_MALLOC(sizeof(dc_refcount_owner));
+        DC_ASSERT(self && "dc_refcount_owner_get: allocation failed");
+        atomic_init(&self->pending, 0);
+        dc_refcount_self = self;
+#if defined(__unix__) || defined(__APPLE__)
+        pthread_once(&dc_refcount_exit_once, dc_refcount_exit_key_create);
+        pthread_setspecific(dc_refcount_exit_key, self);
+#endif
+    }
+    return dc_refcount_self;
+}
+
+static void dc_refcount_init(dc_refcount* rc) {
+    dc_refcount_owner* self = dc_refcount_owner_get();
+    if (atomic_load_explicit(&self->pending, memory_order_relaxed)) dc_refcount_drain(self);
+    atomic_init(&rc->shared, 0);
+    rc->local = 1;
+    rc->owner = self;
+    rc->next = 0;
+}
+
+static bool dc_refcount_is_immortal(dc_refcount* rc) {
+    return rc->owner == &dc_refcount_immortal_owner;
+}
+
+static void dc_refcount_make_immortal(dc_refcount* rc) {
+    rc->owner = &dc_refcount_immortal_owner;
+}
+
+static void dc_refcount_retain(dc_refcount* rc) {
+    if (rc->owner == dc_refcount_self && rc->local) {
+        rc->local++;
+    } else if (rc->owner != &dc_refcount_immortal_owner) {
+        DC_ATOMIC_FETCH_ADD(&rc->shared, DC_SHARED_ONE);
+    }
+}
+
+// true when the caller dropped the last reference and must free the value
+static bool dc_refcount_release(dc_refcount* rc, int kind) {
+    dc_refcount_owner* owner = rc->owner;
+    if (owner == &dc_refcount_immortal_owner) return false;
+
+    if (owner == dc_refcount_self && rc->local) {
+        if (--rc->local) return false;
+        return DC_ATOMIC_FETCH_ADD(&rc->shared, DC_SHARED_MERGED) + DC_SHARED_MERGED == DC_SHARED_MERGED;
+    }
+
+    // Once merged (never undone) the shared count is the whole count
+    intptr_t old = DC_ATOMIC_LOAD(&rc->shared);
+    if (old & DC_SHARED_MERGED) {
+        return DC_ATOMIC_FETCH_SUB(&rc->shared, DC_SHARED_ONE) - DC_SHARED_ONE == DC_SHARED_MERGED;
+    }
+
+    // Before the merge a negative shared count means a reference the owner counted was released
+    // here; queue the value once so the owner folds its count in
+    intptr_t updated;
+    do {
+        updated = old - DC_SHARED_ONE;
+        if (updated < 0 && !(old & (DC_SHARED_MERGED | DC_SHARED_QUEUED))) updated |= DC_SHARED_QUEUED;
+    } while (!atomic_compare_exchange_weak(&rc->shared, &old, updated));
+
+    if ((updated ^ old) & DC_SHARED_QUEUED) {
+        uintptr_t head = atomic_load(&owner->pending);
+        do {
+            // The owner is gone and will not drain again, so fold its count in here
+            if (head == DC_OWNER_DETACHED) return dc_refcount_fold(rc);
+            rc->next = head;
+        } while (!atomic_compare_exchange_weak(&owner->pending, &head, (uintptr_t)rc | (uintptr_t)kind));
+        return false;
+    }
+    return updated == DC_SHARED_MERGED;
+}
+
+// The caller holds the only reference, so the node may be overwritten in place
+static bool dc_refcount_is_unique(dc_refcount* rc) {
+    intptr_t shared = DC_ATOMIC_LOAD(&rc->shared);
+    if (rc->owner == dc_refcount_self && rc->local) return rc->local == 1 && shared == 0;
+    return shared == (DC_SHARED_ONE | DC_SHARED_MERGED);
+}
+
+DC_DEF void dc_refcount_flush(void) {
+    if (dc_refcount_self) dc_refcount_drain(dc_refcount_self);
+}
+
+DC_DEF void dc_refcount_detach(void) {
+    if (!dc_refcount_self) return;
+#if defined(__unix__) || defined(__APPLE__)
+    pthread_setspecific(dc_refcount_exit_key, NULL);
+#endif
+    dc_refcount_detach_owner(dc_refcount_self);
+    dc_refcount_self = NULL;
+}
+
+#else
+
+#define DC_REFCOUNT_IMMORTAL_INIT DC_REFCOUNT_IMMORTAL
+
+static void dc_refcount_init(dc_refcount* rc) {
+    DC_ATOMIC_STORE(rc, 1);
+}
+
+static bool dc_refcount_is_immortal(dc_refcount* rc) {
+    return DC_ATOMIC_LOAD_RELAXED(rc) >= DC_REFCOUNT_IMMORTAL;
+}
+
+static void dc_refcount_make_immortal(dc_refcount* rc) {
+    DC_ATOMIC_STORE(rc, DC_REFCOUNT_IMMORTAL);
+}
+
+static void dc_refcount_retain(dc_refcount* rc) {
+    if (!dc_refcount_is_immortal(rc)) DC_ATOMIC_FETCH_ADD(rc, 1);
+}
+
+static bool dc_refcount_release(dc_refcount* rc, int kind) {
+    (void)kind;
+    return !dc_refcount_is_immortal(rc) && DC_ATOMIC_FETCH_SUB(rc, 1) == 1;
+}
+
+static bool dc_refcount_is_unique(dc_refcount* rc) {
+    return DC_ATOMIC_LOAD(rc) == 1;
+}
+
+DC_DEF void dc_refcount_flush(void) {
+}
+
+DC_DEF void dc_refcount_detach(void) {
+}
+
+#endif
+
+// Constants. Integer and floating-point constants are immortal static objects,
+// so they need no initialization at all; rational constants hold df_frac parts,
+// which cannot be built at compile time, and are published once on first use.
+#define DC_INT_CONSTANT(re, im) {DC_REFCOUNT_IMMORTAL_INIT, true, {.small = {re, im}} DC_TRACK_SITE_INIT}
+#ifdef CMPLX
+#define DC_DOUBLE_CONSTANT(re, im) {DC_REFCOUNT_IMMORTAL_INIT, CMPLX(re, im) DC_TRACK_SITE_INIT}
+#else
+#define DC_DOUBLE_CONSTANT(re, im) {DC_REFCOUNT_IMMORTAL_INIT, (re) + (im) * I DC_TRACK_SITE_INIT}
+#endif
+
+static struct dc_complex_int_internal dc_int_zero_constant = DC_INT_CONSTANT(0, 0);
+static struct dc_complex_int_internal dc_int_one_constant = DC_INT_CONSTANT(1, 0);
+static struct dc_complex_int_internal dc_int_i_constant = DC_INT_CONSTANT(0, 1);
+static struct dc_complex_int_internal dc_int_neg_one_constant = DC_INT_CONSTANT(-1, 0);
+static struct dc_complex_int_internal dc_int_neg_i_constant = DC_INT_CONSTANT(0, -1);
+
+static DC_ATOMIC_PTR(dc_complex_frac) dc_frac_zero_singleton = NULL;
+static DC_ATOMIC_PTR(dc_complex_frac) dc_frac_one_singleton = NULL;
+static DC_ATOMIC_PTR(dc_complex_frac) dc_frac_i_singleton = NULL;
+static DC_ATOMIC_PTR(dc_complex_frac) dc_frac_neg_one_singleton = NULL;
+static DC_ATOMIC_PTR(dc_complex_frac) dc_frac_neg_i_singleton = NULL;
+
+static struct dc_complex_double_internal dc_double_zero_constant = DC_DOUBLE_CONSTANT(0.0, 0.0);
+static struct dc_complex_double_internal dc_double_one_constant = DC_DOUBLE_CONSTANT(1.0, 0.0);
+static struct dc_complex_double_internal dc_double_i_constant = DC_DOUBLE_CONSTANT(0.0, 1.0);
+static struct dc_complex_double_internal dc_double_neg_one_constant = DC_DOUBLE_CONSTANT(-1.0, 0.0);
+static struct dc_complex_double_internal dc_double_neg_i_constant = DC_DOUBLE_CONSTANT(0.0, -1.0);
+
+// ============================================================================
+// ARENA IMPLEMENTATION
+// ============================================================================
+
+#if DC_ARENA
+
+#define DC_ARENA_ALIGN 16
+#define DC_ARENA_ROUND(n) (((n) + DC_ARENA_ALIGN - 1) & ~(size_t)(DC_ARENA_ALIGN - 1))
+
+// Chunks are linked newest first; data starts DC_ARENA_ROUND(sizeof(chunk)) bytes in
+typedef struct dc_arena_chunk {
+    struct dc_arena_chunk* prev;
+    size_t size;
+    size_t used;
+} dc_arena_chunk;
+
+// Saved allocation position of an enclosing scope, stored in the arena itself
+typedef struct dc_arena_mark {
+    struct dc_arena_mark* prev;
+    dc_arena_chunk* chunk;
+    size_t used;
+} dc_arena_mark;
+
+static DC_THREAD_LOCAL dc_arena_chunk* dc_arena_chunks = NULL;
+static DC_THREAD_LOCAL dc_arena_mark* dc_arena_marks = NULL;
+static DC_THREAD_LOCAL size_t dc_arena_suspended = 0;
+
+// Address range [low, high) spanned by all live chunks, so frees of heap nodes are rejected without a chunk walk
+static DC_THREAD_LOCAL uintptr_t dc_arena_low = 0;
+static DC_THREAD_LOCAL uintptr_t dc_arena_high = 0;
+
+#define DC_ARENA_DATA(chunk) ((char*)(chunk) + DC_ARENA_ROUND(sizeof(dc_arena_chunk)))
+
+// Heap allocations (singletons, strings, escapes) bypass any active scope
+#define DC_ARENA_SUSPEND() (dc_arena_suspended++)
+#define DC_ARENA_RESUME() (dc_arena_suspended--)
+
+static bool dc_arena_active(void) {
+    return dc_arena_marks != NULL && dc_arena_suspended == 0;
+}
+
+// Each block is preceded by its size so dc_arena_realloc() knows how much to copy
+static void* dc_arena_bump(size_t size) {
+    size_t need = DC_ARENA_ROUND(size) + DC_ARENA_ALIGN;
+    dc_arena_chunk* chunk = dc_arena_chunks;
+
+    if (!chunk || chunk->used + need > chunk->size) {
+        size_t capacity = need > DC_ARENA_CHUNK_SIZE ? need : DC_ARENA_CHUNK_SIZE;
+        chunk = DC_MALLOC(DC_ARENA_ROUND(sizeof(dc_arena_chunk)) + capacity);
+        DC_ASSERT(chunk && "dc_arena_bump: allocation failed");
+
+        chunk->prev = dc_arena_chunks;
+        chunk->size = capacity;
+        chunk->used = 0;
+        dc_arena_chunks = chunk;
+
+        uintptr_t low = (uintptr_t)DC_ARENA_DATA(chunk);
+        uintptr_t high = low + capacity;
+        if (!chunk->prev || low < dc_arena_low) dc_arena_low = low;
+        if (!chunk->prev || high > dc_arena_high) dc_arena_high = high;
+    }
+
+    char* block = DC_ARENA_DATA(chunk) + chunk->used;
+    chunk->used += need;
+    *(size_t*)block = size;
+
+    return block + DC_ARENA_ALIGN;
+}
+
+DC_DEF bool dc_arena_contains(const void* ptr) {
+    if (!ptr) return false;
+
+    if ((uintptr_t)ptr < dc_arena_low || (uintptr_t)ptr >= dc_arena_high) return false;
+
+    const char* p = ptr;
+    for (dc_arena_chunk* chunk = dc_arena_chunks; chunk; chunk = chunk->prev) {
+        const char* data = DC_ARENA_DATA(chunk);
+        if (p >= data && p < data + chunk->used) return true;
+    }
+    return false;
+}
+
+DC_DEF void dc_arena_begin(void) {
+    dc_arena_chunk* chunk = dc_arena_chunks;
+    size_t used = chunk ? chunk->used : 0;
+
+    dc_arena_mark* mark = dc_arena_bump(sizeof(dc_arena_mark));
+    mark->prev = dc_arena_marks;
+    mark->chunk = chunk;
+    mark->used = used;
+    dc_arena_marks = mark;
+}
+
+DC_DEF void dc_arena_end(void) {
+    DC_ASSERT(dc_arena_marks && "dc_arena_end: no active arena scope");
+
+    dc_arena_mark mark = *dc_arena_marks;
+    while (dc_arena_chunks != mark.chunk) {
+        dc_arena_chunk* prev = dc_arena_chunks->prev;
+        DC_FREE(dc_arena_chunks);
+        dc_arena_chunks = prev;
+    }
+    if (mark.chunk) {
+        mark.chunk->used = mark.used;
+    }
+
+    dc_arena_low = dc_arena_high = 0;
+    for (dc_arena_chunk* chunk = dc_arena_chunks; chunk; chunk = chunk->prev) {
+        uintptr_t low = (uintptr_t)DC_ARENA_DATA(chunk);
+        uintptr_t high = low + chunk->size;
+        if (!dc_arena_low || low < dc_arena_low) dc_arena_low = low;
+        if (high > dc_arena_high) dc_arena_high = high;
+    }
+    dc_arena_marks = mark.prev;
+}
+
+DC_DEF void* dc_arena_malloc(size_t size) {
+    return dc_arena_active() ? dc_arena_bump(size) : DC_MALLOC(size);
+}
+
+DC_DEF void* dc_arena_realloc(void* ptr, size_t size) {
+    if (!dc_arena_contains(ptr)) {
+        return DC_REALLOC(ptr, size);
+    }
+
+    size_t old_size = *(size_t*)((char*)ptr - DC_ARENA_ALIGN);
+    void* result = dc_arena_malloc(size);
+    if (result) {
+        memcpy(result, ptr, old_size < size ? old_size : size);
+    }
+    return result;
+}
+
+DC_DEF void dc_arena_free(void* ptr) {
+    if (!ptr || dc_arena_contains(ptr)) return;
+    DC_FREE(ptr);
+}
+
+#else
+#define DC_ARENA_SUSPEND() ((void)0)
+#define DC_ARENA_RESUME() ((void)0)
+#endif
+
+// Complex number nodes go to the arena when one is enabled
+#if DC_ARENA
+#define DC_OBJ_MALLOC dc_arena_malloc
+#define DC_OBJ_FREE dc_arena_free
+#else
+#define DC_OBJ_MALLOC DC_MALLOC
+#define DC_OBJ_FREE DC_FREE
+#endif
+
+// ============================================================================
+// INTEGER COMPLEX IMPLEMENTATION
+// ============================================================================
+
+// Allocate an uninitialized Gaussian integer with reference count 1
+static dc_complex_int dc_int_alloc(void) {
+    dc_complex_int result = DC_OBJ_MALLOC(sizeof(struct dc_complex_int_internal));
+    DC_ASSERT(result && "dc_int_alloc: allocation failed");
+
+    dc_refcount_init(&result->ref_count);
+    DC_STATS_LIVE(DC_STAT_LIVE_INT, 1);
+    DC_TRACK_NEW(result);
+    return result;
+}
+
+// Store small components into an uninitialized node
+static void dc_int_set_ints(dc_complex_int out, int64_t real, int64_t imag) {
+    out->is_small = true;
+    out->small.real = real;
+    out->small.imag = imag;
+}
+
+// Store retained components into an uninitialized node, demoting when they fit
+static void dc_int_set_di(dc_complex_int out, di_int real, di_int imag) {
+    int64_t small_real, small_imag;
+    if (di_to_int64(real, &small_real) && di_to_int64(imag, &small_imag)) {
+        dc_int_set_ints(out, small_real, small_imag);
+        return;
+    }
+
+    out->is_small = false;
+    out->big.real = di_retain(real);
+    out->big.imag = di_retain(imag);
+}
 
 DC_DEF dc_complex_int dc_int_from_ints(int64_t real, int64_t imag) {
-    dc_complex_int result = DC_MALLOC(sizeof(struct dc_complex_int_internal));
-    DC_ASSERT(result && "dc_int_from_ints: allocation failed");
+    dc_complex_int result = dc_int_alloc();
+    dc_int_set_ints(result, real, imag);
+
+    return result;
+}
+
+DC_DEF dc_complex_int dc_int_from_di(di_int real, di_int imag) {
+    DC_ASSERT(real && "dc_int_from_di: real part cannot be NULL");
+    DC_ASSERT(imag && "dc_int_from_di: imaginary part cannot be NULL");
+
+    dc_complex_int result = dc_int_alloc();
+    dc_int_set_di(result, real, imag);
+
+    return result;
+}
+
+DC_DEF dc_complex_int dc_int_zero(void) {
+    return &dc_int_zero_constant;
+}
+
+DC_DEF dc_complex_int dc_int_one(void) {
+    return &dc_int_one_constant;
+}
+
+DC_DEF dc_complex_int dc_int_i(void) {
+    return &dc_int_i_constant;
+}
+
+DC_DEF dc_complex_int dc_int_neg_one(void) {
+    return &dc_int_neg_one_constant;
+}
+
+DC_DEF dc_complex_int dc_int_neg_i(void) {
+    return &dc_int_neg_i_constant;
+}
+
+DC_DEF dc_complex_int dc_int_retain(dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_retain: cannot retain NULL");
+    dc_refcount_retain(&c->ref_count);
+    return c;
+}
+
+static void dc_int_destroy(dc_complex_int c) {
+    if (!c->is_small) {
+        di_release(&c->big.real);
+        di_release(&c->big.imag);
+    }
+    DC_TRACK_FORGET(c);
+    DC_OBJ_FREE(c);
+    DC_STATS_LIVE(DC_STAT_LIVE_INT, -1);
+}
+
+DC_DEF void dc_int_release(dc_complex_int* c) {
+    if (!c || !*c) return;
+
+    if (dc_refcount_release(&(*c)->ref_count, DC_KIND_INT)) dc_int_destroy(*c);
+    *c = NULL;
+}
+
+DC_DEF dc_complex_int dc_int_make_immortal(dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_make_immortal: value cannot be NULL");
+#if DC_ARENA
+    DC_ASSERT(!dc_arena_contains(c) && "dc_int_make_immortal: arena values cannot be immortal");
+#endif
+    dc_refcount_make_immortal(&c->ref_count);
+    DC_TRACK_FORGET(c);
+    return c;
+}
+
+DC_DEF bool dc_int_is_immortal(dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_is_immortal: value cannot be NULL");
+    return dc_refcount_is_immortal(&c->ref_count);
+}
+
+DC_DEF dc_complex_int dc_int_copy(dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_copy: cannot copy NULL");
+    if (c->is_small) {
+        return dc_int_from_ints(c->small.real, c->small.imag);
+    }
+    return dc_int_from_di(c->big.real, c->big.imag);
+}
+
+static void dc_int_add_to(dc_complex_int out, dc_complex_int a, dc_complex_int b) {
+    DC_ASSERT(a && "dc_int_add: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_int_add: second operand cannot be NULL");
+
+    if (a->is_small && b->is_small) {
+        int64_t real, imag;
+        if (di_add_overflow_int64(a->small.real, b->small.real, &real) &&
+            di_add_overflow_int64(a->small.imag, b->small.imag, &imag)) {
+            dc_int_set_ints(out, real, imag);
+            return;
+        }
+    }
+
+    di_int ar = dc_int_real(a), ai = dc_int_imag(a);
+    di_int br = dc_int_real(b), bi = dc_int_imag(b);
+    di_int real = di_add(ar, br);
+    di_int imag = di_add(ai, bi);
+    dc_int_set_di(out, real, imag);
+    di_release(&ar);
+    di_release(&ai);
+    di_release(&br);
+    di_release(&bi);
+    di_release(&real);
+    di_release(&imag);
+}
+
+DC_DEF dc_complex_int dc_int_add(dc_complex_int a, dc_complex_int b) {
+    dc_complex_int result = dc_int_alloc();
+    dc_int_add_to(result, a, b);
+    return result;
+}
+
+static void dc_int_sub_to(dc_complex_int out, dc_complex_int a, dc_complex_int b) {
+    DC_ASSERT(a && "dc_int_sub: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_int_sub: second operand cannot be NULL");
+
+    if (a->is_small && b->is_small) {
+        int64_t real, imag;
+        if (di_subtract_overflow_int64(a->small.real, b->small.real, &real) &&
+            di_subtract_overflow_int64(a->small.imag, b->small.imag, &imag)) {
+            dc_int_set_ints(out, real, imag);
+            return;
+        }
+    }
+
+    di_int ar = dc_int_real(a), ai = dc_int_imag(a);
+    di_int br = dc_int_real(b), bi = dc_int_imag(b);
+    di_int real = di_sub(ar, br);
+    di_int imag = di_sub(ai, bi);
+    dc_int_set_di(out, real, imag);
+    di_release(&ar);
+    di_release(&ai);
+    di_release(&br);
+    di_release(&bi);
+    di_release(&real);
+    di_release(&imag);
+}
+
+DC_DEF dc_complex_int dc_int_sub(dc_complex_int a, dc_complex_int b) {
+    dc_complex_int result = dc_int_alloc();
+    dc_int_sub_to(result, a, b);
+    return result;
+}
+
+// (a + bi) * (c + di) = (ac - bd) + (ad + bc)i with four multiplications
+static void dc_int_mul_schoolbook(di_int a, di_int b, di_int c, di_int d, di_int* real, di_int* imag) {
+    di_int ac = di_mul(a, c);
+    di_int bd = di_mul(b, d);
+    di_int ad = di_mul(a, d);
+    di_int bc = di_mul(b, c);
+
+    *real = di_sub(ac, bd);
+    *imag = di_add(ad, bc);
+
+    di_release(&ac);
+    di_release(&bd);
+    di_release(&ad);
+    di_release(&bc);
+}
+
+// Gauss: k1 = c(a + b), k2 = a(d - c), k3 = b(c + d); real = k1 - k3, imag = k1 + k2.
+// Trades one multiplication for three additions, which pays off once limbs are long.
+static void dc_int_mul_gauss(di_int a, di_int b, di_int c, di_int d, di_int* real, di_int* imag) {
+    di_int a_plus_b = di_add(a, b);
+    di_int d_minus_c = di_sub(d, c);
+    di_int c_plus_d = di_add(c, d);
+    di_int k1 = di_mul(c, a_plus_b);
+    di_int k2 = di_mul(a, d_minus_c);
+    di_int k3 = di_mul(b, c_plus_d);
+
+    *real = di_sub(k1, k3);
+    *imag = di_add(k1, k2);
+
+    di_release(&a_plus_b);
+    di_release(&d_minus_c);
+    di_release(&c_plus_d);
+    di_release(&k1);
+    di_release(&k2);
+    di_release(&k3);
+}
+
+static void dc_int_mul_to(dc_complex_int out, dc_complex_int a, dc_complex_int b) {
+    DC_ASSERT(a && "dc_int_mul: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_int_mul: second operand cannot be NULL");
+
+    // (a + bi) * (c + di) = (ac - bd) + (ad + bc)i
+    if (a->is_small && b->is_small) {
+        int64_t ac, bd, ad, bc, real, imag;
+        if (di_multiply_overflow_int64(a->small.real, b->small.real, &ac) &&
+            di_multiply_overflow_int64(a->small.imag, b->small.imag, &bd) &&
+            di_multiply_overflow_int64(a->small.real, b->small.imag, &ad) &&
+            di_multiply_overflow_int64(a->small.imag, b->small.real, &bc) &&
+            di_subtract_overflow_int64(ac, bd, &real) &&
+            di_add_overflow_int64(ad, bc, &imag)) {
+            dc_int_set_ints(out, real, imag);
+            return;
+        }
+    }
+
+    di_int ar = dc_int_real(a), ai = dc_int_imag(a);
+    di_int br = dc_int_real(b), bi = dc_int_imag(b);
+    size_t a_limbs = di_limb_count(ar) > di_limb_count(ai) ? di_limb_count(ar) : di_limb_count(ai);
+    size_t b_limbs = di_limb_count(br) > di_limb_count(bi) ? di_limb_count(br) : di_limb_count(bi);
+    di_int real, imag;
+    if (a_limbs >= DC_GAUSS_MUL_THRESHOLD && b_limbs >= DC_GAUSS_MUL_THRESHOLD) {
+        dc_int_mul_gauss(ar, ai, br, bi, &real, &imag);
+    } else {
+        dc_int_mul_schoolbook(ar, ai, br, bi, &real, &imag);
+    }
+
+    dc_int_set_di(out, real, imag);
+
+    di_release(&ar);
+    di_release(&ai);
+    di_release(&br);
+    di_release(&bi);
+    di_release(&real);
+    di_release(&imag);
+}
+
+DC_DEF dc_complex_int dc_int_mul(dc_complex_int a, dc_complex_int b) {
+    dc_complex_int result = dc_int_alloc();
+    dc_int_mul_to(result, a, b);
+    return result;
+}
+
+// (a + bi)^2 = (a + b)(a - b) + 2ab i with two multiplications
+static void dc_int_square_parts(di_int a, di_int b, di_int* real, di_int* imag) {
+    di_int sum = di_add(a, b);
+    di_int diff = di_sub(a, b);
+    di_int ab = di_mul(a, b);
+    *real = di_mul(sum, diff);
+    *imag = di_add(ab, ab);
+    di_release(&sum);
+    di_release(&diff);
+    di_release(&ab);
+}
+
+static void dc_int_square_to(dc_complex_int out, dc_complex_int c) {
+    if (c->is_small) {
+        int64_t sum, diff, ab, real, imag;
+        if (di_add_overflow_int64(c->small.real, c->small.imag, &sum) &&
+            di_subtract_overflow_int64(c->small.real, c->small.imag, &diff) &&
+            di_multiply_overflow_int64(sum, diff, &real) &&
+            di_multiply_overflow_int64(c->small.real, c->small.imag, &ab) &&
+            di_add_overflow_int64(ab, ab, &imag)) {
+            dc_int_set_ints(out, real, imag);
+            return;
+        }
+    }
+
+    di_int a = dc_int_real(c), b = dc_int_imag(c);
+    di_int real, imag;
+    dc_int_square_parts(a, b, &real, &imag);
+    dc_int_set_di(out, real, imag);
+    di_release(&a);
+    di_release(&b);
+    di_release(&real);
+    di_release(&imag);
+}
+
+DC_DEF dc_complex_frac dc_int_div(dc_complex_int a, dc_complex_int b) {
+    DC_ASSERT(a && "dc_int_div: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_int_div: second operand cannot be NULL");
+
+    // Convert to fractions and divide
+    dc_complex_frac af = dc_int_to_frac(a);
+    dc_complex_frac bf = dc_int_to_frac(b);
+    dc_complex_frac result = dc_frac_div(af, bf);
+
+    dc_frac_release(&af);
+    dc_frac_release(&bf);
+
+    return result;
+}
+
+static void dc_int_negate_to(dc_complex_int out, dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_negate: operand cannot be NULL");
+
+    if (c->is_small) {
+        int64_t real, imag;
+        if (di_subtract_overflow_int64(0, c->small.real, &real) &&
+            di_subtract_overflow_int64(0, c->small.imag, &imag)) {
+            dc_int_set_ints(out, real, imag);
+            return;
+        }
+    }
+
+    di_int cr = dc_int_real(c), ci = dc_int_imag(c);
+    di_int real = di_negate(cr);
+    di_int imag = di_negate(ci);
+    dc_int_set_di(out, real, imag);
+    di_release(&cr);
+    di_release(&ci);
+    di_release(&real);
+    di_release(&imag);
+}
+
+DC_DEF dc_complex_int dc_int_negate(dc_complex_int c) {
+    dc_complex_int result = dc_int_alloc();
+    dc_int_negate_to(result, c);
+    return result;
+}
+
+static void dc_int_conj_to(dc_complex_int out, dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_conj: operand cannot be NULL");
+
+    if (c->is_small) {
+        int64_t imag;
+        if (di_subtract_overflow_int64(0, c->small.imag, &imag)) {
+            dc_int_set_ints(out, c->small.real, imag);
+            return;
+        }
+    }
+
+    di_int real = dc_int_real(c);
+    di_int ci = dc_int_imag(c);
+    di_int imag = di_negate(ci);
+    dc_int_set_di(out, real, imag);
+    di_release(&ci);
+    di_release(&real);
+    di_release(&imag);
+}
+
+DC_DEF dc_complex_int dc_int_conj(dc_complex_int c) {
+    dc_complex_int result = dc_int_alloc();
+    dc_int_conj_to(result, c);
+    return result;
+}
+
+DC_DEF di_int dc_int_norm(dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_norm: operand cannot be NULL");
+
+    if (c->is_small) {
+        int64_t real_sq, imag_sq, norm;
+        if (di_multiply_overflow_int64(c->small.real, c->small.real, &real_sq) &&
+            di_multiply_overflow_int64(c->small.imag, c->small.imag, &imag_sq) &&
+            di_add_overflow_int64(real_sq, imag_sq, &norm)) {
+            return di_from_int64(norm);
+        }
+    }
+
+    di_int real = dc_int_real(c), imag = dc_int_imag(c);
+    di_int real_sq = di_mul(real, real);
+    di_int imag_sq = di_mul(imag, imag);
+    di_int norm = di_add(real_sq, imag_sq);
+    di_release(&real);
+    di_release(&imag);
+    di_release(&real_sq);
+    di_release(&imag_sq);
+    return norm;
+}
+
+// ----------------------------------------------------------------------------
+// Euclidean division and GCD
+// ----------------------------------------------------------------------------
+
+// Gaussian integer on di_int components, the working form of the Euclidean loops
+typedef struct {
+    di_int real;
+    di_int imag;
+} dc_gauss;
+
+static dc_gauss dc_gauss_of(dc_complex_int c) {
+    dc_gauss g = {dc_int_real(c), dc_int_imag(c)};
+    return g;
+}
+
+static dc_gauss dc_gauss_from_ints(int64_t real, int64_t imag) {
+    dc_gauss g = {di_from_int64(real), di_from_int64(imag)};
+    return g;
+}
+
+static void dc_gauss_release(dc_gauss* g) {
+    di_release(&g->real);
+    di_release(&g->imag);
+}
+
+// Move a working value into a new dc_complex_int
+static dc_complex_int dc_gauss_finish(dc_gauss* g) {
+    dc_complex_int result = dc_int_from_di(g->real, g->imag);
+    dc_gauss_release(g);
+    return result;
+}
+
+static bool dc_gauss_is_zero(dc_gauss g) {
+    return di_is_zero(g.real) && di_is_zero(g.imag);
+}
+
+static size_t dc_gauss_bits(dc_gauss g) {
+    size_t real_bits = di_bit_length(g.real), imag_bits = di_bit_length(g.imag);
+    return real_bits > imag_bits ? real_bits : imag_bits;
+}
+
+static dc_gauss dc_gauss_mul(dc_gauss a, dc_gauss b) {
+    size_t a_limbs = di_limb_count(a.real) > di_limb_count(a.imag) ? di_limb_count(a.real) : di_limb_count(a.imag);
+    size_t b_limbs = di_limb_count(b.real) > di_limb_count(b.imag) ? di_limb_count(b.real) : di_limb_count(b.imag);
+    dc_gauss result;
+    if (a_limbs >= DC_GAUSS_MUL_THRESHOLD && b_limbs >= DC_GAUSS_MUL_THRESHOLD) {
+        dc_int_mul_gauss(a.real, a.imag, b.real, b.imag, &result.real, &result.imag);
+    } else {
+        dc_int_mul_schoolbook(a.real, a.imag, b.real, b.imag, &result.real, &result.imag);
+    }
+    return result;
+}
+
+// a - q * b
+static dc_gauss dc_gauss_sub_mul(dc_gauss a, dc_gauss q, dc_gauss b) {
+    dc_gauss qb = dc_gauss_mul(q, b);
+    dc_gauss result = {di_sub(a.real, qb.real), di_sub(a.imag, qb.imag)};
+    dc_gauss_release(&qb);
+    return result;
+}
+
+// u * a + v * b
+static dc_gauss dc_gauss_combine(dc_gauss u, dc_gauss a, dc_gauss v, dc_gauss b) {
+    dc_gauss ua = dc_gauss_mul(u, a);
+    dc_gauss vb = dc_gauss_mul(v, b);
+    dc_gauss result = {di_add(ua.real, vb.real), di_add(ua.imag, vb.imag)};
+    dc_gauss_release(&ua);
+    dc_gauss_release(&vb);
+    return result;
+}
+
+// floor(x / n) for n > 0. di_div truncates multi-limb negative quotients toward zero,
+// so the quotient is corrected from the sign of the remainder.
+static di_int dc_di_floor_div(di_int x, di_int n) {
+    di_int q = di_div(x, n);
+    di_int qn = di_mul(q, n);
+    di_int rem = di_sub(x, qn);
+    if (di_is_negative(rem)) {
+        di_int adjusted = di_sub_i32(q, 1);
+        di_release(&q);
+        q = adjusted;
+    }
+    di_release(&qn);
+    di_release(&rem);
+    return q;
+}
+
+// Nearest integer to x / n for n > 0, ties upward: floor((2x + n) / 2n)
+static di_int dc_di_div_round(di_int x, di_int n) {
+    di_int two_x = di_add(x, x);
+    di_int num = di_add(two_x, n);
+    di_int den = di_add(n, n);
+    di_int result = dc_di_floor_div(num, den);
+    di_release(&two_x);
+    di_release(&num);
+    di_release(&den);
+    return result;
+}
+
+// a / b rounded componentwise to the nearest Gaussian integer, from a * conj(b) / norm(b)
+static dc_gauss dc_gauss_quotient(dc_gauss a, dc_gauss b) {
+    dc_gauss b_conj = {di_retain(b.real), di_negate(b.imag)};
+    dc_gauss num = dc_gauss_mul(a, b_conj);
+    di_int real_sq = di_mul(b.real, b.real);
+    di_int imag_sq = di_mul(b.imag, b.imag);
+    di_int norm = di_add(real_sq, imag_sq);
+
+    dc_gauss q = {dc_di_div_round(num.real, norm), dc_di_div_round(num.imag, norm)};
+
+    dc_gauss_release(&b_conj);
+    dc_gauss_release(&num);
+    di_release(&real_sq);
+    di_release(&imag_sq);
+    di_release(&norm);
+    return q;
+}
+
+static dc_gauss dc_gauss_square(dc_gauss g) {
+    dc_gauss result;
+    dc_int_square_parts(g.real, g.imag, &result.real, &result.imag);
+    return result;
+}
+
+// Components below 2^30 keep every product of a Euclidean step inside int64_t
+#define DC_GAUSS_SMALL_BITS 30
+
+// Inline value with both components below 2^DC_GAUSS_SMALL_BITS in magnitude
+static bool dc_int_fits_gauss_small(dc_complex_int c) {
+    const int64_t bound = (int64_t)1 << DC_GAUSS_SMALL_BITS;
+    return c->is_small && c->small.real > -bound && c->small.real < bound && c->small.imag > -bound &&
+           c->small.imag < bound;
+}
+
+// int64 counterpart of dc_di_div_round; |x| < 2^61 and 0 < n < 2^61
+static int64_t dc_i64_div_round(int64_t x, int64_t n) {
+    int64_t num = 2 * x + n, den = 2 * n;
+    int64_t q = num / den;
+    if (num % den != 0 && num < 0) q--;
+    return q;
+}
+
+// int64 counterpart of dc_gauss_quotient for components below 2^DC_GAUSS_SMALL_BITS
+static void dc_i64_quotient(int64_t ar, int64_t ai, int64_t br, int64_t bi, int64_t* qr, int64_t* qi) {
+    int64_t norm = br * br + bi * bi;
+    *qr = dc_i64_div_round(ar * br + ai * bi, norm);
+    *qi = dc_i64_div_round(ai * br - ar * bi, norm);
+}
+
+// Rotate g by i^k
+static void dc_gauss_rotate(dc_gauss* g, int k) {
+    for (int j = 0; j < k; j++) {
+        // i * (x + yi) = -y + xi
+        di_int real = di_negate(g->imag);
+        di_release(&g->imag);
+        g->imag = g->real;
+        g->real = real;
+    }
+}
+
+// Power of i that moves g into the normalized quadrant (real > 0, imag >= 0)
+static int dc_gauss_normalizing_unit(dc_gauss g) {
+    if (dc_gauss_is_zero(g)) return 0;
+    bool real_pos = !di_is_negative(g.real) && !di_is_zero(g.real);
+    bool real_neg = di_is_negative(g.real);
+    bool imag_neg = di_is_negative(g.imag);
+    bool imag_pos = !imag_neg && !di_is_zero(g.imag);
+
+    if (real_pos && !imag_neg) return 0;
+    if (!real_pos && imag_pos) return 3;
+    if (real_neg && !imag_pos) return 2;
+    return 1;
+}
+
+// Leading bits of a component: |c| >> shift with the sign of c
+static int64_t dc_di_leading(di_int c, size_t shift) {
+    di_int magnitude = di_abs(c);
+    di_int top = di_shift_right(magnitude, shift);
+    int64_t value = 0;
+    di_to_int64(top, &value);
+    di_release(&magnitude);
+    di_release(&top);
+    return di_is_negative(c) ? -value : value;
+}
+
+static bool dc_i64_below(int64_t real, int64_t imag, int bits) {
+    int64_t limit = (int64_t)1 << bits;
+    return real > -limit && real < limit && imag > -limit && imag < limit;
+}
+
+/*
+ * One Lehmer round. The Euclidean algorithm runs on the leading
+ * DC_GAUSS_SMALL_BITS bits of (a, b) in int64_t while the remainders keep
+ * at least half of those bits, so the quotients still match the full
+ * values. The quotients are collected in the matrix [[u0 v0] [u1 v1]],
+ * a product of [[0 1] [1 -q]] steps, and applied to a, b (and the Bezout
+ * cofactors x, y when given) with a handful of big multiplications instead
+ * of one big division per step. The matrix is unimodular, so the gcd is
+ * preserved even if an approximate quotient is off. Returns false when no
+ * step could be taken from the leading bits alone.
+ */
+static bool dc_gauss_lehmer_round(dc_gauss* a, dc_gauss* b, dc_gauss* x, dc_gauss* y) {
+    size_t a_bits = dc_gauss_bits(*a), b_bits = dc_gauss_bits(*b);
+    size_t bits = a_bits > b_bits ? a_bits : b_bits;
+    size_t shift = bits > DC_GAUSS_SMALL_BITS ? bits - DC_GAUSS_SMALL_BITS : 0;
+
+    int64_t ar = dc_di_leading(a->real, shift), ai = dc_di_leading(a->imag, shift);
+    int64_t br = dc_di_leading(b->real, shift), bi = dc_di_leading(b->imag, shift);
+    int64_t u0r = 1, u0i = 0, v0r = 0, v0i = 0;
+    int64_t u1r = 0, u1i = 0, v1r = 1, v1i = 0;
+    int steps = 0;
+
+    while (!dc_i64_below(br, bi, DC_GAUSS_SMALL_BITS / 2)) {
+        int64_t qr, qi;
+        dc_i64_quotient(ar, ai, br, bi, &qr, &qi);
+        if (!dc_i64_below(qr, qi, 20)) break;
+
+        // (u, v) rows follow the remainders: row1' = row0 - q * row1
+        int64_t nur = u0r - (qr * u1r - qi * u1i), nui = u0i - (qr * u1i + qi * u1r);
+        int64_t nvr = v0r - (qr * v1r - qi * v1i), nvi = v0i - (qr * v1i + qi * v1r);
+        if (!dc_i64_below(nur, nui, 40) || !dc_i64_below(nvr, nvi, 40)) break;
+
+        int64_t rr = ar - (qr * br - qi * bi), ri = ai - (qr * bi + qi * br);
+        ar = br;
+        ai = bi;
+        br = rr;
+        bi = ri;
+        u0r = u1r;
+        u0i = u1i;
+        v0r = v1r;
+        v0i = v1i;
+        u1r = nur;
+        u1i = nui;
+        v1r = nvr;
+        v1i = nvi;
+        steps++;
+    }
+    if (steps == 0) return false;
+
+    dc_gauss u0 = dc_gauss_from_ints(u0r, u0i), v0 = dc_gauss_from_ints(v0r, v0i);
+    dc_gauss u1 = dc_gauss_from_ints(u1r, u1i), v1 = dc_gauss_from_ints(v1r, v1i);
+
+    dc_gauss new_a = dc_gauss_combine(u0, *a, v0, *b);
+    dc_gauss new_b = dc_gauss_combine(u1, *a, v1, *b);
+    dc_gauss_release(a);
+    dc_gauss_release(b);
+    *a = new_a;
+    *b = new_b;
+
+    if (x) {
+        dc_gauss new_x0 = dc_gauss_combine(u0, x[0], v0, x[1]);
+        dc_gauss new_x1 = dc_gauss_combine(u1, x[0], v1, x[1]);
+        dc_gauss new_y0 = dc_gauss_combine(u0, y[0], v0, y[1]);
+        dc_gauss new_y1 = dc_gauss_combine(u1, y[0], v1, y[1]);
+        dc_gauss_release(&x[0]);
+        dc_gauss_release(&x[1]);
+        dc_gauss_release(&y[0]);
+        dc_gauss_release(&y[1]);
+        x[0] = new_x0;
+        x[1] = new_x1;
+        y[0] = new_y0;
+        y[1] = new_y1;
+    }
+
+    dc_gauss_release(&u0);
+    dc_gauss_release(&v0);
+    dc_gauss_release(&u1);
+    dc_gauss_release(&v1);
+    return true;
+}
+
+// One exact Euclidean step: (a, b) <- (b, a - q b), applied to the cofactor pairs as well
+static void dc_gauss_euclid_step(dc_gauss* a, dc_gauss* b, dc_gauss* x, dc_gauss* y) {
+    dc_gauss q = dc_gauss_quotient(*a, *b);
+    dc_gauss r = dc_gauss_sub_mul(*a, q, *b);
+    dc_gauss_release(a);
+    *a = *b;
+    *b = r;
+
+    if (x) {
+        dc_gauss next_x = dc_gauss_sub_mul(x[0], q, x[1]);
+        dc_gauss next_y = dc_gauss_sub_mul(y[0], q, y[1]);
+        dc_gauss_release(&x[0]);
+        dc_gauss_release(&y[0]);
+        x[0] = x[1];
+        x[1] = next_x;
+        y[0] = y[1];
+        y[1] = next_y;
+    }
+    dc_gauss_release(&q);
+}
+
+// Euclidean loop on *a, *b; leaves the gcd (unnormalized) in *a and zero in *b.
+// x and y, when given, hold the cofactor pairs of a and b with respect to the inputs.
+static void dc_gauss_gcd_loop(dc_gauss* a, dc_gauss* b, dc_gauss* x, dc_gauss* y, bool lehmer) {
+    size_t threshold_bits = (size_t)DC_LEHMER_GCD_THRESHOLD * 32;
+    while (!dc_gauss_is_zero(*b)) {
+        size_t a_before = dc_gauss_bits(*a), b_before = dc_gauss_bits(*b);
+        size_t bits_before = a_before > b_before ? a_before : b_before;
+        if (lehmer && bits_before >= threshold_bits && dc_gauss_lehmer_round(a, b, x, y)) {
+            // Leading-bit quotients are heuristics; stop using them if they made no progress
+            size_t a_bits = dc_gauss_bits(*a), b_bits = dc_gauss_bits(*b);
+            if ((a_bits > b_bits ? a_bits : b_bits) >= bits_before) lehmer = false;
+            continue;
+        }
+        dc_gauss_euclid_step(a, b, x, y);
+    }
+}
+
+DC_DEF void dc_int_divmod(dc_complex_int a, dc_complex_int b, dc_complex_int* quotient, dc_complex_int* remainder) {
+    DC_ASSERT(a && "dc_int_divmod: dividend cannot be NULL");
+    DC_ASSERT(b && "dc_int_divmod: divisor cannot be NULL");
+    DC_ASSERT(!dc_int_is_zero(b) && "dc_int_divmod: division by zero");
+    DC_ASSERT(quotient && remainder && "dc_int_divmod: result pointers cannot be NULL");
+
+    if (dc_int_fits_gauss_small(a) && dc_int_fits_gauss_small(b)) {
+        int64_t qr, qi;
+        dc_i64_quotient(a->small.real, a->small.imag, b->small.real, b->small.imag, &qr, &qi);
+        *quotient = dc_int_from_ints(qr, qi);
+        *remainder = dc_int_from_ints(a->small.real - (qr * b->small.real - qi * b->small.imag),
+                                      a->small.imag - (qr * b->small.imag + qi * b->small.real));
+        return;
+    }
+
+    dc_gauss ga = dc_gauss_of(a), gb = dc_gauss_of(b);
+    dc_gauss q = dc_gauss_quotient(ga, gb);
+    dc_gauss r = dc_gauss_sub_mul(ga, q, gb);
+    *quotient = dc_gauss_finish(&q);
+    *remainder = dc_gauss_finish(&r);
+    dc_gauss_release(&ga);
+    dc_gauss_release(&gb);
+}
+
+// gcd of values whose components fit DC_GAUSS_SMALL_BITS, entirely in int64_t
+static void dc_i64_gcd(int64_t* ar, int64_t* ai, int64_t br, int64_t bi) {
+    while (br != 0 || bi != 0) {
+        int64_t qr, qi;
+        dc_i64_quotient(*ar, *ai, br, bi, &qr, &qi);
+        int64_t rr = *ar - (qr * br - qi * bi), ri = *ai - (qr * bi + qi * br);
+        *ar = br;
+        *ai = bi;
+        br = rr;
+        bi = ri;
+    }
+}
+
+// int64 counterpart of rotating by dc_gauss_normalizing_unit (components below 2^DC_GAUSS_SMALL_BITS)
+static void dc_i64_normalize(int64_t* real, int64_t* imag) {
+    if (*real == 0 && *imag == 0) return;
+    while (!(*real > 0 && *imag >= 0)) {
+        int64_t rotated = -*imag;
+        *imag = *real;
+        *real = rotated;
+    }
+}
+
+static dc_complex_int dc_int_gcd_impl(dc_complex_int a, dc_complex_int b, bool lehmer) {
+    if (dc_int_fits_gauss_small(a) && dc_int_fits_gauss_small(b)) {
+        int64_t gr = a->small.real, gi = a->small.imag;
+        dc_i64_gcd(&gr, &gi, b->small.real, b->small.imag);
+        dc_i64_normalize(&gr, &gi);
+        return dc_int_from_ints(gr, gi);
+    }
+
+    dc_gauss ga = dc_gauss_of(a), gb = dc_gauss_of(b);
+    dc_gauss_gcd_loop(&ga, &gb, NULL, NULL, lehmer);
+    dc_gauss_release(&gb);
+    dc_gauss_rotate(&ga, dc_gauss_normalizing_unit(ga));
+    return dc_gauss_finish(&ga);
+}
+
+DC_DEF dc_complex_int dc_int_gcd(dc_complex_int a, dc_complex_int b) {
+    DC_ASSERT(a && "dc_int_gcd: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_int_gcd: second operand cannot be NULL");
+    return dc_int_gcd_impl(a, b, true);
+}
+
+static dc_complex_int dc_int_xgcd_impl(dc_complex_int a, dc_complex_int b, dc_complex_int* x, dc_complex_int* y,
+                                       bool lehmer) {
+    // Invariants: a_k = xs[k] * a + ys[k] * b for the two working values
+    dc_gauss ga = dc_gauss_of(a), gb = dc_gauss_of(b);
+    dc_gauss xs[2] = {dc_gauss_from_ints(1, 0), dc_gauss_from_ints(0, 0)};
+    dc_gauss ys[2] = {dc_gauss_from_ints(0, 0), dc_gauss_from_ints(1, 0)};
+
+    dc_gauss_gcd_loop(&ga, &gb, xs, ys, lehmer);
+
+    int unit = dc_gauss_normalizing_unit(ga);
+    dc_gauss_rotate(&ga, unit);
+    dc_gauss_rotate(&xs[0], unit);
+    dc_gauss_rotate(&ys[0], unit);
+
+    *x = dc_gauss_finish(&xs[0]);
+    *y = dc_gauss_finish(&ys[0]);
+    dc_gauss_release(&xs[1]);
+    dc_gauss_release(&ys[1]);
+    dc_gauss_release(&gb);
+    return dc_gauss_finish(&ga);
+}
+
+DC_DEF dc_complex_int dc_int_xgcd(dc_complex_int a, dc_complex_int b, dc_complex_int* x, dc_complex_int* y) {
+    DC_ASSERT(a && "dc_int_xgcd: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_int_xgcd: second operand cannot be NULL");
+    DC_ASSERT(x && y && "dc_int_xgcd: coefficient pointers cannot be NULL");
+    return dc_int_xgcd_impl(a, b, x, y, true);
+}
+
+// ----------------------------------------------------------------------------
+// Primality and factorization
+// ----------------------------------------------------------------------------
+
+// One bit per odd number below DC_PRIME_SIEVE_LIMIT, set for composites. Built on first use and
+// published with a compare-and-swap like the constants; the table is never freed.
+#define DC_PRIME_SIEVE_BYTES ((DC_PRIME_SIEVE_LIMIT / 2 + 7) / 8)
+static DC_ATOMIC_PTR(uint8_t*) dc_prime_sieve_table = NULL;
+
+static bool dc_prime_sieve_bit(const uint8_t* bits, uint32_t n) {
+    return (bits[n / 16] >> (n / 2 % 8)) & 1;
+}
+
+// Valid once dc_prime_sieve_init() has returned on the calling thread, whose acquire load
+// makes the table contents visible
+static bool dc_prime_sieve_composite(uint32_t n) {
+    return dc_prime_sieve_bit(DC_ATOMIC_LOAD_RELAXED(&dc_prime_sieve_table), n);
+}
+
+static void dc_prime_sieve_init(void) {
+    uint8_t* published = DC_ATOMIC_LOAD_ACQUIRE(&dc_prime_sieve_table);
+    if (published) return;
+
+    uint8_t* candidate = DC_MALLOC(DC_PRIME_SIEVE_BYTES);
+    DC_ASSERT(candidate && "dc_prime_sieve_init: allocation failed");
+    memset(candidate, 0, DC_PRIME_SIEVE_BYTES);
+    for (uint32_t p = 3; (uint64_t)p * p < DC_PRIME_SIEVE_LIMIT; p += 2) {
+        if (dc_prime_sieve_bit(candidate, p)) continue;
+        for (uint32_t m = p * p; m < DC_PRIME_SIEVE_LIMIT; m += 2 * p) {
+            candidate[m / 16] |= (uint8_t)(1u << (m / 2 % 8));
+        }
+    }
+
+    // Concurrent first callers may each build a table; the losers free theirs
+    if (!DC_ATOMIC_CAS_PTR(&dc_prime_sieve_table, &published, candidate)) DC_FREE(candidate);
+}
+
+// n < DC_PRIME_SIEVE_LIMIT
+static bool dc_sieve_is_prime(uint32_t n) {
+    if (n < 2) return false;
+    if (n % 2 == 0) return n == 2;
+    dc_prime_sieve_init();
+    return !dc_prime_sieve_composite(n);
+}
+
+// Smallest prime above p from the table, or 0 past DC_PRIME_SIEVE_LIMIT (the sieve must be built)
+static uint32_t dc_sieve_next(uint32_t p) {
+    if (p < 2) return 2;
+    for (uint32_t n = p == 2 ? 3 : p + 2; n < DC_PRIME_SIEVE_LIMIT; n += 2) {
+        if (!dc_prime_sieve_composite(n)) return n;
+    }
+    return 0;
+}
+
+static uint64_t dc_u64_mulmod(uint64_t a, uint64_t b, uint64_t m) {
+#if defined(__SIZEOF_INT128__)
+    return (uint64_t)((unsigned __int128)a * b % m);
+#else
+    uint64_t result = 0;
+    a %= m;
+    while (b) {
+        if (b & 1) result = result >= m - a ? result - (m - a) : result + a;
+        a = a >= m - a ? a - (m - a) : a + a;
+        b >>= 1;
+    }
+    return result;
+#endif
+}
+
+static uint64_t dc_u64_powmod(uint64_t base, uint64_t exp, uint64_t m) {
+    uint64_t result = 1 % m;
+    base %= m;
+    while (exp) {
+        if (exp & 1) result = dc_u64_mulmod(result, base, m);
+        base = dc_u64_mulmod(base, base, m);
+        exp >>= 1;
+    }
+    return result;
+}
+
+static uint64_t dc_u64_gcd(uint64_t a, uint64_t b) {
+    while (b) {
+        uint64_t r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+static uint64_t dc_u64_isqrt(uint64_t n) {
+    uint64_t x = (uint64_t)sqrt((double)n);
+    while (x > 0 && (x > UINT32_MAX || x * x > n)) x--;
+    while (x < UINT32_MAX && (x + 1) * (x + 1) <= n) x++;
+    return x;
+}
+
+// Miller-Rabin with these bases is exact below 3.3 * 10^24 (bases up to 37 alone only reach 3.18 * 10^23),
+// which covers every uint64_t; above the bound the test is probabilistic
+static const uint32_t dc_miller_rabin_bases[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41};
+#define DC_MILLER_RABIN_BASES (sizeof(dc_miller_rabin_bases) / sizeof(dc_miller_rabin_bases[0]))
+
+// Product of the bases, for one remainder that screens out their multiples
+#define DC_MILLER_RABIN_PRIMORIAL 304250263527210ULL
+
+static bool dc_u64_is_prime(uint64_t n) {
+    if (n < DC_PRIME_SIEVE_LIMIT) return dc_sieve_is_prime((uint32_t)n);
+    if (dc_u64_gcd(n, DC_MILLER_RABIN_PRIMORIAL) != 1) return false;
+
+    uint64_t d = n - 1;
+    int s = 0;
+    while (d % 2 == 0) {
+        d /= 2;
+        s++;
+    }
+    for (size_t k = 0; k < DC_MILLER_RABIN_BASES; k++) {
+        uint64_t x = dc_u64_powmod(dc_miller_rabin_bases[k], d, n);
+        if (x == 1 || x == n - 1) continue;
+        int r = 1;
+        for (; r < s; r++) {
+            x = dc_u64_mulmod(x, x, n);
+            if (x == n - 1) break;
+        }
+        if (r == s) return false;
+    }
+    return true;
+}
+
+// Rho iteration y^2 + c mod n without overflowing near 2^64
+static uint64_t dc_u64_rho_step(uint64_t y, uint64_t c, uint64_t n) {
+    uint64_t sq = dc_u64_mulmod(y, y, n);
+    return sq >= n - c ? sq - (n - c) : sq + c;
+}
+
+// Brent's variant of Pollard's rho: a nontrivial factor of an odd composite n.
+// Differences are multiplied together so one gcd covers a batch of steps.
+#define DC_RHO_BATCH 128
+
+static uint64_t dc_u64_rho(uint64_t n) {
+    for (uint64_t c = 1;; c++) {
+        uint64_t x = 2, y = 2, saved = 2, q = 1, g = 1;
+        for (size_t r = 1; g == 1; r *= 2) {
+            x = y;
+            for (size_t i = 0; i < r; i++) y = dc_u64_rho_step(y, c, n);
+            for (size_t k = 0; k < r && g == 1; k += DC_RHO_BATCH) {
+                saved = y;
+                size_t batch = r - k < DC_RHO_BATCH ? r - k : DC_RHO_BATCH;
+                for (size_t i = 0; i < batch; i++) {
+                    y = dc_u64_rho_step(y, c, n);
+                    q = dc_u64_mulmod(q, x > y ? x - y : y - x, n);
+                }
+                g = dc_u64_gcd(q, n);
+            }
+        }
+        if (g == n) {
+            // The batch overshot: replay it one step at a time
+            do {
+                saved = dc_u64_rho_step(saved, c, n);
+                g = dc_u64_gcd(x > saved ? x - saved : saved - x, n);
+            } while (g == 1);
+        }
+        if (g != n) return g;
+    }
+}
+
+// di_int division is bit-serial, so primality and rho on values of 64 bits or more run
+// on little-endian arrays of 32-bit limbs instead, with Montgomery multiplication.
+
+// Limbs of 0 <= x < 2^(32 len). Halving keeps every shift on a value of about the current
+// size, so n limbs cost O(n log n) limb operations instead of one full-width shift per limb.
+static void dc_di_split_limbs(di_int x, uint32_t* out, size_t len) {
+    if (len <= 2) {
+        uint64_t value = 0;
+        di_to_uint64(x, &value);
+        out[0] = (uint32_t)value;
+        if (len == 2) out[1] = (uint32_t)(value >> 32);
+        return;
+    }
+    size_t half = len / 2;
+    di_int high = di_shift_right(x, 32 * half);
+    di_int top = di_shift_left(high, 32 * half);
+    di_int low = di_sub(x, top);
+    dc_di_split_limbs(low, out, half);
+    dc_di_split_limbs(high, out + half, len - half);
+    di_release(&low);
+    di_release(&top);
+    di_release(&high);
+}
+
+// Magnitude of x as `len` limbs, least significant first (higher limbs are dropped)
+static void dc_di_to_limbs(di_int x, uint32_t* out, size_t len) {
+    di_int rest = di_abs(x);
+    size_t bits = di_bit_length(rest);
+    if (bits > 32 * len) {
+        di_int high = di_shift_right(rest, 32 * len);
+        di_int top = di_shift_left(high, 32 * len);
+        di_int low = di_sub(rest, top);
+        di_release(&top);
+        di_release(&high);
+        di_release(&rest);
+        rest = low;
+        bits = di_bit_length(rest);
+    }
+    size_t used = (bits + 31) / 32;
+    if (used) dc_di_split_limbs(rest, out, used);
+    for (size_t k = used; k < len; k++) out[k] = 0;
+    di_release(&rest);
+}
+
+static uint32_t dc_di_low_limb(di_int x) {
+    uint32_t low;
+    dc_di_to_limbs(x, &low, 1);
+    return low;
+}
+
+// Value of `len` limbs, least significant first; halves like dc_di_split_limbs
+static di_int dc_limbs_to_di(const uint32_t* x, size_t len) {
+    if (len <= 2) {
+        uint64_t value = len == 0 ? 0 : len == 1 ? x[0] : (uint64_t)x[1] << 32 | x[0];
+        return di_from_uint64(value);
+    }
+    size_t half = len / 2;
+    di_int high = dc_limbs_to_di(x + half, len - half);
+    di_int low = dc_limbs_to_di(x, half);
+    di_int top = di_shift_left(high, 32 * half);
+    di_int result = di_add(top, low);
+    di_release(&top);
+    di_release(&low);
+    di_release(&high);
+    return result;
+}
+
+static size_t dc_di_limb_len(di_int x) {
+    size_t bits = di_bit_length(x);
+    return bits ? (bits + 31) / 32 : 1;
+}
+
+static int dc_limbs_cmp(const uint32_t* a, const uint32_t* b, size_t len) {
+    for (size_t k = len; k-- > 0;) {
+        if (a[k] != b[k]) return a[k] < b[k] ? -1 : 1;
+    }
+    return 0;
+}
+
+static bool dc_limbs_is_zero(const uint32_t* a, size_t len) {
+    for (size_t k = 0; k < len; k++) {
+        if (a[k]) return false;
+    }
+    return true;
+}
+
+// a -= b, returning the borrow
+static uint32_t dc_limbs_sub(uint32_t* a, const uint32_t* b, size_t len) {
+    uint64_t borrow = 0;
+    for (size_t k = 0; k < len; k++) {
+        uint64_t diff = (uint64_t)a[k] - b[k] - borrow;
+        a[k] = (uint32_t)diff;
+        borrow = (diff >> 32) & 1;
+    }
+    return (uint32_t)borrow;
+}
+
+// a += b, returning the carry
+static uint32_t dc_limbs_add(uint32_t* a, const uint32_t* b, size_t len) {
+    uint64_t carry = 0;
+    for (size_t k = 0; k < len; k++) {
+        uint64_t sum = (uint64_t)a[k] + b[k] + carry;
+        a[k] = (uint32_t)sum;
+        carry = sum >> 32;
+    }
+    return (uint32_t)carry;
+}
+
+static void dc_limbs_shift_right(uint32_t* a, size_t len, size_t bits) {
+    size_t limbs = bits / 32 < len ? bits / 32 : len;
+    unsigned rest = (unsigned)(bits % 32);
+    memmove(a, a + limbs, (len - limbs) * sizeof(uint32_t));
+    memset(a + len - limbs, 0, limbs * sizeof(uint32_t));
+    if (rest == 0) return;
+    for (size_t k = 0; k < len; k++) {
+        uint32_t high = k + 1 < len ? a[k + 1] : 0;
+        a[k] = (a[k] >> rest) | (high << (32 - rest));
+    }
+}
+
+// Number of trailing zero bits of a non-zero value
+static size_t dc_limbs_trailing_zeros(const uint32_t* a) {
+    size_t zeros = 0;
+    while (a[zeros / 32] == 0) zeros += 32;
+    for (uint32_t limb = a[zeros / 32]; (limb & 1) == 0; limb >>= 1) zeros++;
+    return zeros;
+}
+
+static uint32_t dc_limbs_mod_u32(const uint32_t* a, size_t len, uint32_t m) {
+    uint64_t rem = 0;
+    for (size_t k = len; k-- > 0;) {
+        rem = ((rem << 32) | a[k]) % m;
+    }
+    return (uint32_t)rem;
+}
+
+static void dc_limbs_div_u32(uint32_t* a, size_t len, uint32_t m) {
+    uint64_t rem = 0;
+    for (size_t k = len; k-- > 0;) {
+        uint64_t cur = (rem << 32) | a[k];
+        a[k] = (uint32_t)(cur / m);
+        rem = cur % m;
+    }
+}
+
+// gcd(a, n) for odd n, left in a; n is overwritten
+static void dc_limbs_gcd_odd(uint32_t* a, uint32_t* n, size_t len) {
+    // Binary gcd: factors of two in a cannot be shared with odd n
+    while (!dc_limbs_is_zero(a, len)) {
+        dc_limbs_shift_right(a, len, dc_limbs_trailing_zeros(a));
+        if (dc_limbs_cmp(a, n, len) < 0) {
+            for (size_t k = 0; k < len; k++) {
+                uint32_t swap = a[k];
+                a[k] = n[k];
+                n[k] = swap;
+            }
+        }
+        dc_limbs_sub(a, n, len);
+    }
+    memcpy(a, n, len * sizeof(uint32_t));
+}
+
+// Arithmetic modulo an odd n > 1 in Montgomery form, with R = 2^(32 len)
+typedef struct {
+    size_t len;
+    uint32_t n_inv;     // -n^-1 mod 2^32
+    uint32_t* n;
+    uint32_t* one;      // R mod n
+    uint32_t* r2;       // R^2 mod n
+    uint32_t* scratch;  // len + 2 limbs for dc_mont_mul
+} dc_mont;
+
+static void dc_mont_init(dc_mont* m, di_int n) {
+    m->len = dc_di_limb_len(n);
+    size_t len = m->len;
+    m->n = DC_MALLOC((4 * len + 2) * sizeof(uint32_t));
+    DC_ASSERT(m->n && "dc_mont_init: allocation failed");
+    m->one = m->n + len;
+    m->r2 = m->one + len;
+    m->scratch = m->r2 + len;
+    dc_di_to_limbs(n, m->n, len);
+
+    // Newton iteration doubles the correct low bits of n^-1 each step
+    uint32_t inv = m->n[0];
+    for (int k = 0; k < 5; k++) inv *= 2 - m->n[0] * inv;
+    m->n_inv = (uint32_t)0 - inv;
+
+    // R and R^2 mod n by doubling 1
+    uint32_t* x = m->r2;
+    memset(x, 0, len * sizeof(uint32_t));
+    x[0] = 1;
+    for (size_t k = 0; k < 64 * len; k++) {
+        uint32_t carry = dc_limbs_add(x, x, len);
+        if (carry || dc_limbs_cmp(x, m->n, len) >= 0) dc_limbs_sub(x, m->n, len);
+        if (k + 1 == 32 * len) memcpy(m->one, x, len * sizeof(uint32_t));
+    }
+}
+
+static void dc_mont_free(dc_mont* m) {
+    DC_FREE(m->n);
+}
+
+// out = a * b / R mod n (coarsely integrated operand scanning); out may alias a or b
+static void dc_mont_mul(const dc_mont* m, uint32_t* out, const uint32_t* a, const uint32_t* b) {
+    size_t len = m->len;
+    uint32_t* t = m->scratch;
+    memset(t, 0, (len + 2) * sizeof(uint32_t));
+    for (size_t i = 0; i < len; i++) {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < len; j++) {
+            uint64_t uv = t[j] + (uint64_t)a[j] * b[i] + carry;
+            t[j] = (uint32_t)uv;
+            carry = uv >> 32;
+        }
+        uint64_t top = t[len] + carry;
+        t[len] = (uint32_t)top;
+        t[len + 1] = (uint32_t)(top >> 32);
+
+        uint32_t q = t[0] * m->n_inv;
+        carry = (t[0] + (uint64_t)q * m->n[0]) >> 32;
+        for (size_t j = 1; j < len; j++) {
+            uint64_t uv = t[j] + (uint64_t)q * m->n[j] + carry;
+            t[j - 1] = (uint32_t)uv;
+            carry = uv >> 32;
+        }
+        top = t[len] + carry;
+        t[len - 1] = (uint32_t)top;
+        t[len] = t[len + 1] + (uint32_t)(top >> 32);
+    }
+    if (t[len] || dc_limbs_cmp(t, m->n, len) >= 0) dc_limbs_sub(t, m->n, len);
+    memcpy(out, t, len * sizeof(uint32_t));
+}
+
+// out = (a + b) mod n for reduced a, b; out may alias a
+static void dc_mont_add(const dc_mont* m, uint32_t* out, const uint32_t* a, const uint32_t* b) {
+    if (out != a) memcpy(out, a, m->len * sizeof(uint32_t));
+    uint32_t carry = dc_limbs_add(out, b, m->len);
+    if (carry || dc_limbs_cmp(out, m->n, m->len) >= 0) dc_limbs_sub(out, m->n, m->len);
+}
+
+// out = base^exp in Montgomery form, with base in Montgomery form; out must not alias base
+static void dc_mont_pow(const dc_mont* m, uint32_t* out, const uint32_t* base, const uint32_t* exp, size_t exp_len) {
+    memcpy(out, m->one, m->len * sizeof(uint32_t));
+    for (size_t bit = 32 * exp_len; bit-- > 0;) {
+        dc_mont_mul(m, out, out, out);
+        if ((exp[bit / 32] >> (bit % 32)) & 1) dc_mont_mul(m, out, out, base);
+    }
+}
+
+// Montgomery form of a small value
+static void dc_mont_from_u32(const dc_mont* m, uint32_t* out, uint32_t value) {
+    memset(out, 0, m->len * sizeof(uint32_t));
+    out[0] = value;
+    dc_mont_mul(m, out, out, m->r2);
+}
+
+static bool dc_di_is_prime(di_int n) {
+    uint64_t small;
+    if (di_is_negative(n)) return false;
+    if (di_to_uint64(n, &small)) return dc_u64_is_prime(small);
+
+    dc_mont m;
+    dc_mont_init(&m, n);
+    size_t len = m.len;
+    for (size_t k = 0; k < DC_MILLER_RABIN_BASES; k++) {
+        if (dc_limbs_mod_u32(m.n, len, dc_miller_rabin_bases[k]) == 0) {
+            dc_mont_free(&m);
+            return false;
+        }
+    }
+
+    // n - 1 = d 2^s; -1 is n - R mod n in Montgomery form
+    uint32_t* d = DC_MALLOC(4 * len * sizeof(uint32_t));
+    DC_ASSERT(d && "dc_int_is_prime: allocation failed");
+    uint32_t* minus_one = d + len;
+    uint32_t* base = minus_one + len;
+    uint32_t* x = base + len;
+    memcpy(d, m.n, len * sizeof(uint32_t));
+    d[0] -= 1;
+    size_t s = dc_limbs_trailing_zeros(d);
+    dc_limbs_shift_right(d, len, s);
+    memcpy(minus_one, m.n, len * sizeof(uint32_t));
+    dc_limbs_sub(minus_one, m.one, len);
+
+    bool prime = true;
+    for (size_t k = 0; k < DC_MILLER_RABIN_BASES && prime; k++) {
+        dc_mont_from_u32(&m, base, dc_miller_rabin_bases[k]);
+        dc_mont_pow(&m, x, base, d, len);
+        if (dc_limbs_cmp(x, m.one, len) == 0 || dc_limbs_cmp(x, minus_one, len) == 0) continue;
+        size_t r = 1;
+        for (; r < s; r++) {
+            dc_mont_mul(&m, x, x, x);
+            if (dc_limbs_cmp(x, minus_one, len) == 0) break;
+        }
+        prime = r < s;
+    }
+
+    DC_FREE(d);
+    dc_mont_free(&m);
+    return prime;
+}
+
+// dc_u64_rho on limbs for an odd composite n of 64 bits or more
+static di_int dc_di_rho(di_int n) {
+    dc_mont m;
+    dc_mont_init(&m, n);
+    size_t len = m.len;
+    uint32_t* buf = DC_MALLOC(7 * len * sizeof(uint32_t));
+    DC_ASSERT(buf && "dc_int_factor: allocation failed");
+    uint32_t *x = buf, *y = x + len, *saved = y + len, *q = saved + len, *c = q + len, *diff = c + len,
+             *g = diff + len;
+
+    for (uint32_t constant = 1;; constant++) {
+        // The step y -> y^2 + c stays in Montgomery form: (yR)^2 / R + cR = (y^2 + c) R
+        dc_mont_from_u32(&m, c, constant);
+        dc_mont_from_u32(&m, y, 2);
+        memcpy(x, y, len * sizeof(uint32_t));
+        memcpy(saved, y, len * sizeof(uint32_t));
+        memcpy(q, m.one, len * sizeof(uint32_t));
+        bool found = false;
+
+        for (size_t r = 1; !found; r *= 2) {
+            memcpy(x, y, len * sizeof(uint32_t));
+            for (size_t i = 0; i < r; i++) {
+                dc_mont_mul(&m, y, y, y);
+                dc_mont_add(&m, y, y, c);
+            }
+            for (size_t k = 0; k < r && !found; k += DC_RHO_BATCH) {
+                memcpy(saved, y, len * sizeof(uint32_t));
+                size_t batch = r - k < DC_RHO_BATCH ? r - k : DC_RHO_BATCH;
+                for (size_t i = 0; i < batch; i++) {
+                    dc_mont_mul(&m, y, y, y);
+                    dc_mont_add(&m, y, y, c);
+                    // (x - y) mod n has the same gcd with n as |x - y|
+                    memcpy(diff, x, len * sizeof(uint32_t));
+                    if (dc_limbs_sub(diff, y, len)) dc_limbs_add(diff, m.n, len);
+                    dc_mont_mul(&m, q, q, diff);
+                }
+                memcpy(g, q, len * sizeof(uint32_t));
+                memcpy(diff, m.n, len * sizeof(uint32_t));
+                dc_limbs_gcd_odd(g, diff, len);
+                found = !(g[0] == 1 && dc_limbs_is_zero(g + 1, len - 1));
+            }
+        }
+        if (dc_limbs_cmp(g, m.n, len) == 0) {
+            // The batch overshot: replay it one step at a time
+            do {
+                dc_mont_mul(&m, saved, saved, saved);
+                dc_mont_add(&m, saved, saved, c);
+                memcpy(g, x, len * sizeof(uint32_t));
+                if (dc_limbs_sub(g, saved, len)) dc_limbs_add(g, m.n, len);
+                memcpy(diff, m.n, len * sizeof(uint32_t));
+                dc_limbs_gcd_odd(g, diff, len);
+            } while (g[0] == 1 && dc_limbs_is_zero(g + 1, len - 1));
+        }
+        if (dc_limbs_cmp(g, m.n, len) != 0) break;
+    }
+
+    di_int factor = dc_limbs_to_di(g, len);
+    DC_FREE(buf);
+    dc_mont_free(&m);
+    return factor;
+}
+
+// Rational prime powers of a norm, kept sorted by prime
+typedef struct {
+    di_int prime;
+    size_t exponent;
+} dc_prime_power;
+
+typedef struct {
+    dc_prime_power* items;
+    size_t count;
+    size_t capacity;
+} dc_prime_powers;
+
+// Takes ownership of p
+static void dc_prime_powers_add(dc_prime_powers* list, di_int p, size_t exponent) {
+    size_t k = 0;
+    while (k < list->count && di_lt(list->items[k].prime, p)) k++;
+    if (k < list->count && di_eq(list->items[k].prime, p)) {
+        list->items[k].exponent += exponent;
+        di_release(&p);
+        return;
+    }
+    if (list->count == list->capacity) {
+        list->capacity = list->capacity ? 2 * list->capacity : 8;
+        list->items = DC_REALLOC(list->items, list->capacity * sizeof(dc_prime_power));
+        DC_ASSERT(list->items && "dc_int_factor: allocation failed");
+    }
+    memmove(&list->items[k + 1], &list->items[k], (list->count - k) * sizeof(dc_prime_power));
+    list->items[k].prime = p;
+    list->items[k].exponent = exponent;
+    list->count++;
+}
+
+// Composite-or-prime n with no factors below DC_PRIME_SIEVE_LIMIT
+static void dc_u64_split_into(dc_prime_powers* list, uint64_t n) {
+    if (dc_u64_is_prime(n)) {
+        dc_prime_powers_add(list, di_from_uint64(n), 1);
+        return;
+    }
+    uint64_t f = dc_u64_rho(n);
+    dc_u64_split_into(list, f);
+    dc_u64_split_into(list, n / f);
+}
+
+static void dc_u64_factor_into(dc_prime_powers* list, uint64_t n) {
+    dc_prime_sieve_init();
+    for (uint32_t p = 2; p != 0 && (uint64_t)p * p <= n; p = dc_sieve_next(p)) {
+        if (n % p != 0) continue;
+        size_t exponent = 0;
+        while (n % p == 0) {
+            n /= p;
+            exponent++;
+        }
+        dc_prime_powers_add(list, di_from_uint32(p), exponent);
+    }
+    if (n > 1) dc_u64_split_into(list, n);
+}
+
+static di_int dc_di_pow_u32(di_int base, uint32_t exp) {
+    di_int result = di_one();
+    for (uint32_t bit = 32; bit-- > 0;) {
+        di_int squared = di_mul(result, result);
+        di_release(&result);
+        result = squared;
+        if ((exp >> bit) & 1) {
+            di_int product = di_mul(result, base);
+            di_release(&result);
+            result = product;
+        }
+    }
+    return result;
+}
+
+// r with r^k = n for the smallest prime k that has one, or NULL. n has no factors below
+// DC_PRIME_SIEVE_LIMIT, so only k < bits / 16 can work. Roots are built a bit at a time
+// from multiplications alone, avoiding di_int division.
+static di_int dc_di_perfect_root(di_int n, uint32_t* k_out) {
+    size_t bits = di_bit_length(n);
+    dc_prime_sieve_init();
+    for (uint32_t k = 2; k != 0 && k <= bits / 16; k = dc_sieve_next(k)) {
+        di_int root = di_zero();
+        for (size_t bit = (bits + k - 1) / k + 1; bit-- > 0;) {
+            di_int one = di_one();
+            di_int step = di_shift_left(one, bit);
+            di_int candidate = di_add(root, step);
+            di_int power = dc_di_pow_u32(candidate, k);
+            if (di_le(power, n)) {
+                di_release(&root);
+                root = di_retain(candidate);
+            }
+            di_release(&one);
+            di_release(&step);
+            di_release(&candidate);
+            di_release(&power);
+        }
+        di_int power = dc_di_pow_u32(root, k);
+        bool exact = di_eq(power, n);
+        di_release(&power);
+        if (exact) {
+            *k_out = k;
+            return root;
+        }
+        di_release(&root);
+    }
+    return NULL;
+}
+
+static void dc_di_split_into(dc_prime_powers* list, di_int n) {
+    uint64_t small;
+    uint32_t k;
+    di_int root;
+    if (di_to_uint64(n, &small)) {
+        dc_u64_split_into(list, small);
+    } else if (dc_di_is_prime(n)) {
+        dc_prime_powers_add(list, di_retain(n), 1);
+    } else if ((root = dc_di_perfect_root(n, &k)) != NULL) {
+        // Rho needs about sqrt(p) steps, hopeless for p^k with a large p; norms of prime powers are common
+        dc_prime_powers root_factors = {NULL, 0, 0};
+        dc_di_split_into(&root_factors, root);
+        for (size_t j = 0; j < root_factors.count; j++) {
+            dc_prime_powers_add(list, root_factors.items[j].prime, root_factors.items[j].exponent * k);
+        }
+        DC_FREE(root_factors.items);
+        di_release(&root);
+    } else {
+        di_int f = dc_di_rho(n);
+        di_int cofactor = di_div(n, f);
+        dc_di_split_into(list, f);
+        dc_di_split_into(list, cofactor);
+        di_release(&f);
+        di_release(&cofactor);
+    }
+}
+
+// Factor n > 0: trial division by the table primes on limbs, dropping to uint64_t
+// arithmetic as soon as the cofactor fits
+static void dc_di_factor_into(dc_prime_powers* list, di_int n) {
+    uint64_t small;
+    if (di_to_uint64(n, &small)) {
+        dc_u64_factor_into(list, small);
+        return;
+    }
+
+    dc_prime_sieve_init();
+    size_t len = dc_di_limb_len(n);
+    uint32_t* limbs = DC_MALLOC(len * sizeof(uint32_t));
+    DC_ASSERT(limbs && "dc_int_factor: allocation failed");
+    dc_di_to_limbs(n, limbs, len);
+
+    for (uint32_t p = 2; p != 0 && len > 2; p = dc_sieve_next(p)) {
+        size_t exponent = 0;
+        while (dc_limbs_mod_u32(limbs, len, p) == 0) {
+            dc_limbs_div_u32(limbs, len, p);
+            exponent++;
+        }
+        if (exponent) dc_prime_powers_add(list, di_from_uint32(p), exponent);
+        while (len > 1 && limbs[len - 1] == 0) len--;
+    }
+
+    if (len <= 2) {
+        // Primes below p were divided out already, so repeating their trial division is harmless
+        dc_u64_factor_into(list, len == 2 ? ((uint64_t)limbs[1] << 32) | limbs[0] : limbs[0]);
+    } else {
+        di_int rest = dc_limbs_to_di(limbs, len);
+        dc_di_split_into(list, rest);
+        di_release(&rest);
+    }
+    DC_FREE(limbs);
+}
+
+// x^2 + y^2 = p for a prime p = 1 mod 4, by Cornacchia's algorithm: the Euclidean
+// remainders of (p, t) with t^2 = -1 mod p first drop below sqrt(p) at x
+static void dc_u64_two_squares(uint64_t p, uint64_t* x, uint64_t* y) {
+    uint64_t t = 0;
+    for (uint64_t c = 2;; c++) {
+        t = dc_u64_powmod(c, (p - 1) / 4, p);
+        if (dc_u64_mulmod(t, t, p) == p - 1) break;
+    }
+    uint64_t a = p, b = t, limit = dc_u64_isqrt(p);
+    while (b > limit) {
+        uint64_t r = a % b;
+        a = b;
+        b = r;
+    }
+    *x = b;
+    *y = dc_u64_isqrt(p - b * b);
+}
+
+// Gaussian prime over a rational prime p = 1 mod 4, normalized to real > imag > 0
+static dc_gauss dc_gauss_split_prime(di_int p) {
+    uint64_t small;
+    dc_gauss pi;
+    if (di_to_uint64(p, &small)) {
+        uint64_t x, y;
+        dc_u64_two_squares(small, &x, &y);
+        pi.real = di_from_uint64(x);
+        pi.imag = di_from_uint64(y);
+    } else {
+        // Hermite-Serret: gcd(p, t + i) for a square root t of -1 mod p
+        dc_mont m;
+        dc_mont_init(&m, p);
+        size_t len = m.len;
+        uint32_t* exp = DC_MALLOC(4 * len * sizeof(uint32_t));
+        DC_ASSERT(exp && "dc_int_factor: allocation failed");
+        uint32_t* minus_one = exp + len;
+        uint32_t* root = minus_one + len;
+        uint32_t* squared = root + len;
+        memcpy(exp, m.n, len * sizeof(uint32_t));
+        dc_limbs_shift_right(exp, len, 2);  // (p - 1) / 4
+        memcpy(minus_one, m.n, len * sizeof(uint32_t));
+        dc_limbs_sub(minus_one, m.one, len);
+        for (uint32_t c = 2;; c++) {
+            // c^((p-1)/4) squares to -1 exactly when c is a quadratic non-residue
+            dc_mont_from_u32(&m, squared, c);
+            dc_mont_pow(&m, root, squared, exp, len);
+            dc_mont_mul(&m, squared, root, root);
+            if (dc_limbs_cmp(squared, minus_one, len) == 0) break;
+        }
+        memset(exp, 0, len * sizeof(uint32_t));
+        exp[0] = 1;
+        dc_mont_mul(&m, root, root, exp);  // out of Montgomery form
+        di_int t = dc_limbs_to_di(root, len);
+        DC_FREE(exp);
+        dc_mont_free(&m);
+
+        di_int zero = di_zero(), one = di_one();
+        dc_complex_int cp = dc_int_from_di(p, zero);
+        dc_complex_int ct = dc_int_from_di(t, one);
+        dc_complex_int g = dc_int_gcd(cp, ct);
+        pi = dc_gauss_of(g);
+        dc_int_release(&cp);
+        dc_int_release(&ct);
+        dc_int_release(&g);
+        di_release(&zero);
+        di_release(&one);
+        di_release(&t);
+    }
+    if (di_lt(pi.real, pi.imag)) {
+        di_int swap = pi.real;
+        pi.real = pi.imag;
+        pi.imag = swap;
+    }
+    return pi;
+}
+
+// z / pi when pi divides z, where norm = pi * conj(pi); returns false and leaves z alone otherwise
+static bool dc_gauss_divide(dc_gauss* z, dc_gauss pi, di_int norm) {
+    dc_gauss pi_conj = {di_retain(pi.real), di_negate(pi.imag)};
+    dc_gauss num = dc_gauss_mul(*z, pi_conj);
+    di_int real_rem = di_mod(num.real, norm);
+    di_int imag_rem = di_mod(num.imag, norm);
+    bool divides = di_is_zero(real_rem) && di_is_zero(imag_rem);
+    if (divides) {
+        dc_gauss_release(z);
+        z->real = di_div(num.real, norm);
+        z->imag = di_div(num.imag, norm);
+    }
+    di_release(&real_rem);
+    di_release(&imag_rem);
+    dc_gauss_release(&pi_conj);
+    dc_gauss_release(&num);
+    return divides;
+}
+
+static void dc_factorization_push(dc_int_factorization* f, size_t* capacity, dc_gauss* pi, size_t exponent) {
+    if (exponent == 0) {
+        dc_gauss_release(pi);
+        return;
+    }
+    if (f->count == *capacity) {
+        *capacity = *capacity ? 2 * *capacity : 8;
+        f->primes = DC_REALLOC(f->primes, *capacity * sizeof(dc_complex_int));
+        f->exponents = DC_REALLOC(f->exponents, *capacity * sizeof(size_t));
+        DC_ASSERT(f->primes && f->exponents && "dc_int_factor: allocation failed");
+    }
+    f->primes[f->count] = dc_gauss_finish(pi);
+    f->exponents[f->count] = exponent;
+    f->count++;
+}
+
+// Primes come out grouped by the rational prime below them; inert p (norm p^2) may need to move up
+static void dc_factorization_sort(dc_int_factorization* f) {
+    if (f->count < 2) return;
+    di_int* norms = DC_MALLOC(f->count * sizeof(di_int));
+    DC_ASSERT(norms && "dc_int_factor: allocation failed");
+    for (size_t k = 0; k < f->count; k++) {
+        norms[k] = dc_int_norm(f->primes[k]);
+    }
+    // Insertion sort is stable, so split pairs keep their order
+    for (size_t k = 1; k < f->count; k++) {
+        for (size_t j = k; j > 0 && di_lt(norms[j], norms[j - 1]); j--) {
+            di_int norm = norms[j];
+            dc_complex_int prime = f->primes[j];
+            size_t exponent = f->exponents[j];
+            norms[j] = norms[j - 1];
+            f->primes[j] = f->primes[j - 1];
+            f->exponents[j] = f->exponents[j - 1];
+            norms[j - 1] = norm;
+            f->primes[j - 1] = prime;
+            f->exponents[j - 1] = exponent;
+        }
+    }
+    for (size_t k = 0; k < f->count; k++) {
+        di_release(&norms[k]);
+    }
+    DC_FREE(norms);
+}
+
+DC_DEF bool dc_int_is_prime(dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_is_prime: operand cannot be NULL");
+
+    dc_gauss g = dc_gauss_of(c);
+    bool prime;
+    if (!di_is_zero(g.real) && !di_is_zero(g.imag)) {
+        di_int norm = dc_int_norm(c);
+        prime = dc_di_is_prime(norm);
+        di_release(&norm);
+    } else {
+        // Rational primes stay prime in Z[i] only when they are 3 mod 4
+        di_int magnitude = di_abs(di_is_zero(g.real) ? g.imag : g.real);
+        prime = (dc_di_low_limb(magnitude) & 3) == 3 && dc_di_is_prime(magnitude);
+        di_release(&magnitude);
+    }
+    dc_gauss_release(&g);
+    return prime;
+}
+
+DC_DEF dc_int_factorization dc_int_factor(dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_factor: operand cannot be NULL");
+    DC_ASSERT(!dc_int_is_zero(c) && "dc_int_factor: cannot factor zero");
+
+    dc_gauss z = dc_gauss_of(c);
+    dc_prime_powers norm_factors = {NULL, 0, 0};
+    di_int norm = dc_int_norm(c);
+    dc_di_factor_into(&norm_factors, norm);
+    di_release(&norm);
+
+    dc_int_factorization f = {NULL, NULL, NULL, 0};
+    size_t capacity = 0;
+    for (size_t k = 0; k < norm_factors.count; k++) {
+        di_int p = norm_factors.items[k].prime;
+        size_t e = norm_factors.items[k].exponent;
+        uint32_t p_mod_4 = dc_di_low_limb(p) & 3;
+
+        if (p_mod_4 == 2) {
+            // 2 = -i (1 + i)^2 ramifies; N(1 + i) = 2
+            dc_gauss pi = dc_gauss_from_ints(1, 1);
+            for (size_t j = 0; j < e; j++) dc_gauss_divide(&z, pi, p);
+            dc_factorization_push(&f, &capacity, &pi, e);
+        } else if (p_mod_4 == 3) {
+            // p stays prime and divides both components e/2 times
+            dc_gauss pi = {di_retain(p), di_zero()};
+            for (size_t j = 0; j < e / 2; j++) {
+                di_int real = di_div(z.real, p);
+                di_int imag = di_div(z.imag, p);
+                dc_gauss_release(&z);
+                z.real = real;
+                z.imag = imag;
+            }
+            dc_factorization_push(&f, &capacity, &pi, e / 2);
+        } else {
+            // p = pi * conj(pi); conj(a + bi) is associated with b + ai
+            dc_gauss pi = dc_gauss_split_prime(p);
+            dc_gauss pi_bar = {di_retain(pi.imag), di_retain(pi.real)};
+            size_t count = 0;
+            while (count < e && dc_gauss_divide(&z, pi, p)) count++;
+            for (size_t j = count; j < e; j++) dc_gauss_divide(&z, pi_bar, p);
+            dc_factorization_push(&f, &capacity, &pi, count);
+            dc_factorization_push(&f, &capacity, &pi_bar, e - count);
+        }
+        di_release(&norm_factors.items[k].prime);
+    }
+    DC_FREE(norm_factors.items);
+    dc_factorization_sort(&f);
+
+    // What is left has norm 1
+    f.unit = dc_gauss_finish(&z);
+    return f;
+}
+
+DC_DEF void dc_int_factorization_release(dc_int_factorization* f) {
+    DC_ASSERT(f && "dc_int_factorization_release: factorization cannot be NULL");
+    for (size_t k = 0; k < f->count; k++) {
+        dc_int_release(&f->primes[k]);
+    }
+    dc_int_release(&f->unit);
+    DC_FREE(f->primes);
+    DC_FREE(f->exponents);
+    f->primes = NULL;
+    f->exponents = NULL;
+    f->count = 0;
+}
+
+DC_DEF di_int dc_int_real(dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_real: operand cannot be NULL");
+    return c->is_small ? di_from_int64(c->small.real) : di_retain(c->big.real);
+}
+
+DC_DEF di_int dc_int_imag(dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_imag: operand cannot be NULL");
+    return c->is_small ? di_from_int64(c->small.imag) : di_retain(c->big.imag);
+}
+
+// Bit length of the larger component magnitude
+static size_t dc_int_magnitude_bits(dc_complex_int c) {
+    if (c->is_small) {
+        uint64_t real = c->small.real < 0 ? 0 - (uint64_t)c->small.real : (uint64_t)c->small.real;
+        uint64_t imag = c->small.imag < 0 ? 0 - (uint64_t)c->small.imag : (uint64_t)c->small.imag;
+        size_t bits = 0;
+        for (uint64_t m = real > imag ? real : imag; m; m >>= 1) bits++;
+        return bits;
+    }
+    size_t real_bits = di_bit_length(c->big.real), imag_bits = di_bit_length(c->big.imag);
+    return real_bits > imag_bits ? real_bits : imag_bits;
+}
+
+DC_DEF int dc_int_compare_abs(dc_complex_int a, dc_complex_int b) {
+    DC_ASSERT(a && "dc_int_compare_abs: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_int_compare_abs: second operand cannot be NULL");
+
+    // With L the larger component bit length, 2^(2L-2) <= norm < 2^(2L+1)
+    size_t a_bits = dc_int_magnitude_bits(a), b_bits = dc_int_magnitude_bits(b);
+    if (a_bits >= b_bits + 2) return 1;
+    if (b_bits >= a_bits + 2) return -1;
+
+    di_int a_norm = dc_int_norm(a), b_norm = dc_int_norm(b);
+    int result = di_compare(a_norm, b_norm);
+    di_release(&a_norm);
+    di_release(&b_norm);
+    return result;
+}
+
+DC_DEF bool dc_int_eq(dc_complex_int a, dc_complex_int b) {
+    DC_ASSERT(a && "dc_int_eq: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_int_eq: second operand cannot be NULL");
+
+    // Representations are canonical, so mixed small/big values are never equal
+    if (a->is_small != b->is_small) return false;
+    if (a->is_small) {
+        return a->small.real == b->small.real && a->small.imag == b->small.imag;
+    }
+    return di_compare(a->big.real, b->big.real) == 0 && di_compare(a->big.imag, b->big.imag) == 0;
+}
+
+DC_DEF bool dc_int_is_zero(dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_is_zero: operand cannot be NULL");
+    return c->is_small && c->small.real == 0 && c->small.imag == 0;
+}
+
+DC_DEF bool dc_int_is_real(dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_is_real: operand cannot be NULL");
+    return c->is_small ? c->small.imag == 0 : di_is_zero(c->big.imag);
+}
+
+DC_DEF bool dc_int_is_imag(dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_is_imag: operand cannot be NULL");
+    return c->is_small ? c->small.real == 0 : di_is_zero(c->big.real);
+}
+
+DC_DEF char* dc_int_to_string(dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_to_string: operand cannot be NULL");
+
+    // Component strings are freed with free(), so keep them off the arena
+    DC_ARENA_SUSPEND();
+
+    char real_buf[24], imag_buf[24];
+    char* real_str;
+    char* imag_str;
+    bool real_zero, imag_zero, imag_neg;
+
+    if (c->is_small) {
+        snprintf(real_buf, sizeof(real_buf), "%" PRId64, c->small.real);
+        snprintf(imag_buf, sizeof(imag_buf), "%" PRId64, c->small.imag);
+        real_str = real_buf;
+        imag_str = imag_buf;
+        real_zero = c->small.real == 0;
+        imag_zero = c->small.imag == 0;
+        imag_neg = c->small.imag < 0;
+    } else {
+        real_str = di_to_string(c->big.real, 10);
+        imag_str = di_to_string(c->big.imag, 10);
+        real_zero = di_is_zero(c->big.real);
+        imag_zero = di_is_zero(c->big.imag);
+        imag_neg = di_is_negative(c->big.imag);
+    }
+
+    size_t len = strlen(real_str) + strlen(imag_str) + 10;
+    char* result = DC_MALLOC(len);
+    DC_ASSERT(result && "dc_int_to_string: allocation failed");
+
+    if (real_zero && imag_zero) {
+        strcpy(result, "0");
+    } else if (imag_zero) {
+        strcpy(result, real_str);
+    } else if (real_zero) {
+        if (strcmp(imag_str, "1") == 0) {
+            strcpy(result, "i");
+        } else if (strcmp(imag_str, "-1") == 0) {
+            strcpy(result, "-i");
+        } else {
+            sprintf(result, "%si", imag_str);
+        }
+    } else {
+        if (strcmp(imag_str, "1") == 0) {
+            sprintf(result, "%s+i", real_str);
+        } else if (strcmp(imag_str, "-1") == 0) {
+            sprintf(result, "%s-i", real_str);
+        } else if (imag_neg) {
+            sprintf(result, "%s%si", real_str, imag_str);
+        } else {
+            sprintf(result, "%s+%si", real_str, imag_str);
+        }
+    }
+
+    if (!c->is_small) {
+        free(real_str);
+        free(imag_str);
+    }
+    DC_ARENA_RESUME();
+
+    return result;
+}
+
+// ============================================================================
+// FRACTION COMPLEX IMPLEMENTATION
+// ============================================================================
+
+DC_DEF dc_complex_frac dc_frac_from_ints(int64_t real_num, int64_t real_den,
+                                          int64_t imag_num, int64_t imag_den) {
+    df_frac real = df_from_ints(real_num, real_den);
+    df_frac imag = df_from_ints(imag_num, imag_den);
+    dc_complex_frac result = dc_frac_from_df(real, imag);
+    df_release(&real);
+    df_release(&imag);
+    return result;
+}
+
+// Allocate an uninitialized rational complex number with reference count 1
+static dc_complex_frac dc_frac_alloc(void) {
+    dc_complex_frac result = DC_OBJ_MALLOC(sizeof(struct dc_complex_frac_internal));
+    DC_ASSERT(result && "dc_frac_alloc: allocation failed");
+
+    dc_refcount_init(&result->ref_count);
+    DC_STATS_LIVE(DC_STAT_LIVE_FRAC, 1);
+    DC_TRACK_NEW(result);
+    return result;
+}
+
+// Store retained components into an uninitialized node
+static void dc_frac_set_df(dc_complex_frac out, df_frac real, df_frac imag) {
+    out->lazy = false;
+    out->real = df_retain(real);
+    out->imag = df_retain(imag);
+}
+
+// ----------------------------------------------------------------------------
+// Lazy reduction
+// ----------------------------------------------------------------------------
+
+// Fraction node for num/den taken as is (den > 0); the caller guarantees or defers reduction
+static df_frac dc_df_node(di_int num, di_int den) {
+    df_frac f = (df_frac)DF_MALLOC(sizeof(struct df_frac_internal));
+    DC_ASSERT(f && "dc_df_node: allocation failed");
+    f->numerator = di_retain(num);
+    f->denominator = di_retain(den);
+    f->ref_count = 1;
+    return f;
+}
+
+// num/den without reduction (den > 0). df_from_di always runs a gcd, so the node is
+// built by hand; components past DC_FRAC_LAZY_MAX_BITS are reduced after all.
+static df_frac dc_df_unreduced(di_int num, di_int den) {
+    if (di_bit_length(num) > DC_FRAC_LAZY_MAX_BITS || di_bit_length(den) > DC_FRAC_LAZY_MAX_BITS) {
+        return df_from_di(num, den);
+    }
+    return dc_df_node(num, den);
+}
+
+// Lowest-terms copy of a possibly unreduced component
+static df_frac dc_df_reduce(df_frac f) {
+    return df_from_di(f->numerator, f->denominator);
+}
+
+// a + b (or a - b) without the gcd; equal denominators are shared instead of multiplied
+static df_frac dc_df_add_lazy(df_frac a, df_frac b, bool subtract) {
+    di_int num, den;
+    if (di_eq(a->denominator, b->denominator)) {
+        num = subtract ? di_sub(a->numerator, b->numerator) : di_add(a->numerator, b->numerator);
+        den = di_retain(a->denominator);
+    } else {
+        di_int ad = di_mul(a->numerator, b->denominator);
+        di_int bc = di_mul(b->numerator, a->denominator);
+        num = subtract ? di_sub(ad, bc) : di_add(ad, bc);
+        den = di_mul(a->denominator, b->denominator);
+        di_release(&ad);
+        di_release(&bc);
+    }
+
+    df_frac result = dc_df_unreduced(num, den);
+    di_release(&num);
+    di_release(&den);
+    return result;
+}
+
+static df_frac dc_df_mul_lazy(df_frac a, df_frac b) {
+    di_int num = di_mul(a->numerator, b->numerator);
+    di_int den = di_mul(a->denominator, b->denominator);
+    df_frac result = dc_df_unreduced(num, den);
+    di_release(&num);
+    di_release(&den);
+    return result;
+}
+
+static df_frac dc_df_negate_lazy(df_frac f) {
+    di_int num = di_negate(f->numerator);
+    df_frac result = dc_df_unreduced(num, f->denominator);
+    di_release(&num);
+    return result;
+}
+
+// Component is a whole number; unreduced components need a remainder test
+static bool dc_df_is_integer(df_frac f, bool lazy) {
+    if (!lazy || di_is_one(f->denominator)) return df_is_integer(f);
+
+    di_int rem = di_mod(f->numerator, f->denominator);
+    bool result = di_is_zero(rem);
+    di_release(&rem);
+    return result;
+}
+
+DC_DEF dc_complex_frac dc_frac_lazy(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_lazy: operand cannot be NULL");
+    if (c->lazy) return dc_frac_retain(c);
+
+    dc_complex_frac result = dc_frac_from_df(c->real, c->imag);
+    result->lazy = true;
+    return result;
+}
+
+DC_DEF dc_complex_frac dc_frac_normalize(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_normalize: operand cannot be NULL");
+    if (!c->lazy) return dc_frac_retain(c);
+
+    df_frac real = dc_df_reduce(c->real);
+    df_frac imag = dc_df_reduce(c->imag);
+    dc_complex_frac result = dc_frac_from_df(real, imag);
+    df_release(&real);
+    df_release(&imag);
+    return result;
+}
+
+DC_DEF bool dc_frac_is_lazy(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_is_lazy: operand cannot be NULL");
+    return c->lazy;
+}
+
+DC_DEF dc_complex_frac dc_frac_from_df(df_frac real, df_frac imag) {
+    DC_ASSERT(real && "dc_frac_from_df: real part cannot be NULL");
+    DC_ASSERT(imag && "dc_frac_from_df: imaginary part cannot be NULL");
+
+    dc_complex_frac result = dc_frac_alloc();
+    dc_frac_set_df(result, real, imag);
+
+    return result;
+}
+
+// Build a constant and publish it with a compare-and-swap. Concurrent first calls may each
+// build one; the losers free theirs and use the published value, so no lock is needed.
+static dc_complex_frac dc_frac_constant(DC_ATOMIC_PTR(dc_complex_frac)* slot, int64_t real, int64_t imag) {
+    dc_complex_frac published = DC_ATOMIC_LOAD_ACQUIRE(slot);
+    if (published) return published;
+
+    DC_ARENA_SUSPEND();
+    dc_complex_frac candidate = dc_frac_from_ints(real, 1, imag, 1);
+    DC_ARENA_RESUME();
+    dc_refcount_make_immortal(&candidate->ref_count);
+    DC_TRACK_FORGET(candidate);
+    if (DC_ATOMIC_CAS_PTR(slot, &published, candidate)) return candidate;
+
+    dc_frac_destroy(candidate);
+    return published;
+}
+
+DC_DEF dc_complex_frac dc_frac_zero(void) {
+    return dc_frac_constant(&dc_frac_zero_singleton, 0, 0);
+}
+
+DC_DEF dc_complex_frac dc_frac_one(void) {
+    return dc_frac_constant(&dc_frac_one_singleton, 1, 0);
+}
+
+DC_DEF dc_complex_frac dc_frac_i(void) {
+    return dc_frac_constant(&dc_frac_i_singleton, 0, 1);
+}
+
+DC_DEF dc_complex_frac dc_frac_neg_one(void) {
+    return dc_frac_constant(&dc_frac_neg_one_singleton, -1, 0);
+}
+
+DC_DEF dc_complex_frac dc_frac_neg_i(void) {
+    return dc_frac_constant(&dc_frac_neg_i_singleton, 0, -1);
+}
+
+DC_DEF dc_complex_frac dc_frac_retain(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_retain: cannot retain NULL");
+    dc_refcount_retain(&c->ref_count);
+    return c;
+}
+
+static void dc_frac_destroy(dc_complex_frac c) {
+    df_release(&c->real);
+    df_release(&c->imag);
+    DC_TRACK_FORGET(c);
+    DC_OBJ_FREE(c);
+    DC_STATS_LIVE(DC_STAT_LIVE_FRAC, -1);
+}
+
+DC_DEF void dc_frac_release(dc_complex_frac* c) {
+    if (!c || !*c) return;
+
+    if (dc_refcount_release(&(*c)->ref_count, DC_KIND_FRAC)) dc_frac_destroy(*c);
+    *c = NULL;
+}
+
+DC_DEF dc_complex_frac dc_frac_make_immortal(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_make_immortal: value cannot be NULL");
+#if DC_ARENA
+    DC_ASSERT(!dc_arena_contains(c) && "dc_frac_make_immortal: arena values cannot be immortal");
+#endif
+    dc_refcount_make_immortal(&c->ref_count);
+    DC_TRACK_FORGET(c);
+    return c;
+}
+
+DC_DEF bool dc_frac_is_immortal(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_is_immortal: value cannot be NULL");
+    return dc_refcount_is_immortal(&c->ref_count);
+}
+
+DC_DEF dc_complex_frac dc_frac_copy(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_copy: cannot copy NULL");
+    dc_complex_frac result = dc_frac_from_df(c->real, c->imag);
+    result->lazy = c->lazy;
+    return result;
+}
+
+static void dc_frac_add_to(dc_complex_frac out, dc_complex_frac a, dc_complex_frac b) {
+    DC_ASSERT(a && "dc_frac_add: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_frac_add: second operand cannot be NULL");
+
+    bool lazy = a->lazy || b->lazy;
+    df_frac real = lazy ? dc_df_add_lazy(a->real, b->real, false) : df_add(a->real, b->real);
+    df_frac imag = lazy ? dc_df_add_lazy(a->imag, b->imag, false) : df_add(a->imag, b->imag);
+    dc_frac_set_df(out, real, imag);
+    out->lazy = lazy;
+    df_release(&real);
+    df_release(&imag);
+}
+
+DC_DEF dc_complex_frac dc_frac_add(dc_complex_frac a, dc_complex_frac b) {
+    dc_complex_frac result = dc_frac_alloc();
+    dc_frac_add_to(result, a, b);
+    return result;
+}
+
+static void dc_frac_sub_to(dc_complex_frac out, dc_complex_frac a, dc_complex_frac b) {
+    DC_ASSERT(a && "dc_frac_sub: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_frac_sub: second operand cannot be NULL");
+
+    bool lazy = a->lazy || b->lazy;
+    df_frac real = lazy ? dc_df_add_lazy(a->real, b->real, true) : df_sub(a->real, b->real);
+    df_frac imag = lazy ? dc_df_add_lazy(a->imag, b->imag, true) : df_sub(a->imag, b->imag);
+    dc_frac_set_df(out, real, imag);
+    out->lazy = lazy;
+    df_release(&real);
+    df_release(&imag);
+}
+
+DC_DEF dc_complex_frac dc_frac_sub(dc_complex_frac a, dc_complex_frac b) {
+    dc_complex_frac result = dc_frac_alloc();
+    dc_frac_sub_to(result, a, b);
+    return result;
+}
+
+// (a + bi) * (c + di) = (ac - bd) + (ad + bc)i with four multiplications
+static void dc_frac_mul_schoolbook(df_frac a, df_frac b, df_frac c, df_frac d, df_frac* real, df_frac* imag) {
+    df_frac ac = df_mul(a, c);
+    df_frac bd = df_mul(b, d);
+    df_frac ad = df_mul(a, d);
+    df_frac bc = df_mul(b, c);
+
+    *real = df_sub(ac, bd);
+    *imag = df_add(ad, bc);
+
+    df_release(&ac);
+    df_release(&bd);
+    df_release(&ad);
+    df_release(&bc);
+}
+
+// Gauss three-multiplication form, as in dc_int_mul_gauss
+static void dc_frac_mul_gauss(df_frac a, df_frac b, df_frac c, df_frac d, df_frac* real, df_frac* imag) {
+    df_frac a_plus_b = df_add(a, b);
+    df_frac d_minus_c = df_sub(d, c);
+    df_frac c_plus_d = df_add(c, d);
+    df_frac k1 = df_mul(c, a_plus_b);
+    df_frac k2 = df_mul(a, d_minus_c);
+    df_frac k3 = df_mul(b, c_plus_d);
+
+    *real = df_sub(k1, k3);
+    *imag = df_add(k1, k2);
+
+    df_release(&a_plus_b);
+    df_release(&d_minus_c);
+    df_release(&c_plus_d);
+    df_release(&k1);
+    df_release(&k2);
+    df_release(&k3);
+}
+
+// Schoolbook product of lazy operands, reducing nothing
+static void dc_frac_mul_lazy(df_frac a, df_frac b, df_frac c, df_frac d, df_frac* real, df_frac* imag) {
+    df_frac ac = dc_df_mul_lazy(a, c);
+    df_frac bd = dc_df_mul_lazy(b, d);
+    df_frac ad = dc_df_mul_lazy(a, d);
+    df_frac bc = dc_df_mul_lazy(b, c);
+
+    *real = dc_df_add_lazy(ac, bd, true);
+    *imag = dc_df_add_lazy(ad, bc, false);
+
+    df_release(&ac);
+    df_release(&bd);
+    df_release(&ad);
+    df_release(&bc);
+}
+
+// Longest numerator or denominator of a complex fraction, in limbs
+static size_t dc_frac_limbs(dc_complex_frac c) {
+    size_t limbs = di_limb_count(c->real->numerator);
+    if (di_limb_count(c->real->denominator) > limbs) limbs = di_limb_count(c->real->denominator);
+    if (di_limb_count(c->imag->numerator) > limbs) limbs = di_limb_count(c->imag->numerator);
+    if (di_limb_count(c->imag->denominator) > limbs) limbs = di_limb_count(c->imag->denominator);
+    return limbs;
+}
+
+static void dc_frac_mul_to(dc_complex_frac out, dc_complex_frac a, dc_complex_frac b) {
+    DC_ASSERT(a && "dc_frac_mul: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_frac_mul: second operand cannot be NULL");
+
+    bool lazy = a->lazy || b->lazy;
+    df_frac real, imag;
+    if (lazy) {
+        dc_frac_mul_lazy(a->real, a->imag, b->real, b->imag, &real, &imag);
+    } else if (dc_frac_limbs(a) >= DC_GAUSS_FRAC_MUL_THRESHOLD && dc_frac_limbs(b) >= DC_GAUSS_FRAC_MUL_THRESHOLD) {
+        dc_frac_mul_gauss(a->real, a->imag, b->real, b->imag, &real, &imag);
+    } else {
+        dc_frac_mul_schoolbook(a->real, a->imag, b->real, b->imag, &real, &imag);
+    }
+
+    dc_frac_set_df(out, real, imag);
+    out->lazy = lazy;
+
+    df_release(&real);
+    df_release(&imag);
+}
+
+DC_DEF dc_complex_frac dc_frac_mul(dc_complex_frac a, dc_complex_frac b) {
+    dc_complex_frac result = dc_frac_alloc();
+    dc_frac_mul_to(result, a, b);
+    return result;
+}
+
+// 2f for a reduced f without a gcd: 2n/d is reduced for odd d, and n/(d/2) for even d
+static df_frac dc_df_double(df_frac f) {
+    if (dc_di_low_limb(f->denominator) & 1) {
+        di_int num = di_add(f->numerator, f->numerator);
+        df_frac result = dc_df_node(num, f->denominator);
+        di_release(&num);
+        return result;
+    }
+    di_int den = di_shift_right(f->denominator, 1);
+    df_frac result = dc_df_node(f->numerator, den);
+    di_release(&den);
+    return result;
+}
+
+// (x + yi)^2 = (x² - y²) + 2xy i. The squares of reduced fractions are reduced as they
+// stand, so only the difference and the cross product pay for gcds.
+static void dc_frac_square_to(dc_complex_frac out, dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_square: operand cannot be NULL");
+    if (c->lazy) {
+        dc_frac_mul_to(out, c, c);
+        return;
+    }
+
+    di_int p2 = di_mul(c->real->numerator, c->real->numerator);
+    di_int q2 = di_mul(c->real->denominator, c->real->denominator);
+    di_int r2 = di_mul(c->imag->numerator, c->imag->numerator);
+    di_int s2 = di_mul(c->imag->denominator, c->imag->denominator);
+    df_frac x2 = dc_df_node(p2, q2);
+    df_frac y2 = dc_df_node(r2, s2);
+    df_frac xy = df_mul(c->real, c->imag);
+
+    df_frac real = df_sub(x2, y2);
+    df_frac imag = dc_df_double(xy);
+    dc_frac_set_df(out, real, imag);
+
+    di_release(&p2);
+    di_release(&q2);
+    di_release(&r2);
+    di_release(&s2);
+    df_release(&x2);
+    df_release(&y2);
+    df_release(&xy);
+    df_release(&real);
+    df_release(&imag);
+}
+
+// (a * b) / (c * d) in lowest terms: the single reduction of a fused quotient component
+static df_frac dc_df_ratio(di_int a, di_int b, di_int c, di_int d) {
+    di_int num = di_mul(a, b);
+    di_int den = di_mul(c, d);
+    df_frac result = df_from_di(num, den);
+    di_release(&num);
+    di_release(&den);
+    return result;
+}
+
+// num * (R1 - R2 i) * S / (den * (R1² + R2²)), where the divisor is (R1 + R2 i)/S.
+// Shared by division (num = a's numerators over den = q1 q2) and the reciprocal (num = 1).
+static void dc_frac_div_common(dc_complex_frac out, di_int num_real, di_int num_imag, di_int den, dc_complex_frac b) {
+    // b = r1/s1 + (r2/s2)i = (r1 s2 + r2 s1 i) / (s1 s2)
+    di_int R1 = di_mul(b->real->numerator, b->imag->denominator);
+    di_int R2 = di_mul(b->imag->numerator, b->real->denominator);
+    di_int S = di_mul(b->real->denominator, b->imag->denominator);
+    di_int neg_R2 = di_negate(R2);
+
+    di_int real, imag;
+    dc_int_mul_schoolbook(num_real, num_imag, R1, neg_R2, &real, &imag);
+
+    di_int R1_sq = di_mul(R1, R1);
+    di_int R2_sq = di_mul(R2, R2);
+    di_int norm = di_add(R1_sq, R2_sq);
+    di_int quot_den = di_mul(den, norm);
+    di_int real_num = di_mul(real, S);
+    di_int imag_num = di_mul(imag, S);
+
+    df_frac real_part = df_from_di(real_num, quot_den);
+    df_frac imag_part = df_from_di(imag_num, quot_den);
+    dc_frac_set_df(out, real_part, imag_part);
+
+    di_release(&R1);
+    di_release(&R2);
+    di_release(&S);
+    di_release(&neg_R2);
+    di_release(&real);
+    di_release(&imag);
+    di_release(&R1_sq);
+    di_release(&R2_sq);
+    di_release(&norm);
+    di_release(&quot_den);
+    di_release(&real_num);
+    di_release(&imag_num);
+    df_release(&real_part);
+    df_release(&imag_part);
+}
+
+static void dc_frac_div_to(dc_complex_frac out, dc_complex_frac a, dc_complex_frac b) {
+    DC_ASSERT(a && "dc_frac_div: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_frac_div: second operand cannot be NULL");
+    DC_ASSERT(!dc_frac_is_zero(b) && "dc_frac_div: division by zero");
+
+    // Work on numerators and denominators directly so each component is reduced once.
+    // a = p1/q1 + (p2/q2)i, b = r1/s1 + (r2/s2)i
+    di_int p1 = a->real->numerator, q1 = a->real->denominator;
+    di_int p2 = a->imag->numerator, q2 = a->imag->denominator;
+    di_int r1 = b->real->numerator, s1 = b->real->denominator;
+    di_int r2 = b->imag->numerator, s2 = b->imag->denominator;
+    bool lazy = a->lazy || b->lazy;
+
+    if (di_is_zero(r2)) {
+        // Real divisor: (p1 s1)/(q1 r1) + ((p2 s1)/(q2 r1))i
+        df_frac real = dc_df_ratio(p1, s1, q1, r1);
+        df_frac imag = dc_df_ratio(p2, s1, q2, r1);
+        dc_frac_set_df(out, real, imag);
+        df_release(&real);
+        df_release(&imag);
+    } else if (di_is_zero(r1)) {
+        // Imaginary divisor: a / ((r2/s2)i) = (p2 s2)/(q2 r2) + ((p1 s2)/(q1 (-r2)))i
+        di_int neg_r2 = di_negate(r2);
+        df_frac real = dc_df_ratio(p2, s2, q2, r2);
+        df_frac imag = dc_df_ratio(p1, s2, q1, neg_r2);
+        dc_frac_set_df(out, real, imag);
+        di_release(&neg_r2);
+        df_release(&real);
+        df_release(&imag);
+    } else {
+        // a = (p1 q2 + p2 q1 i) / (q1 q2)
+        di_int A1 = di_mul(p1, q2);
+        di_int A2 = di_mul(p2, q1);
+        di_int den = di_mul(q1, q2);
+        dc_frac_div_common(out, A1, A2, den, b);
+        di_release(&A1);
+        di_release(&A2);
+        di_release(&den);
+    }
+
+    // Components are reduced; laziness carries over to later operations
+    out->lazy = lazy;
+}
+
+DC_DEF dc_complex_frac dc_frac_div(dc_complex_frac a, dc_complex_frac b) {
+    dc_complex_frac result = dc_frac_alloc();
+    dc_frac_div_to(result, a, b);
+    return result;
+}
+
+static void dc_frac_negate_to(dc_complex_frac out, dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_negate: operand cannot be NULL");
+
+    df_frac real = c->lazy ? dc_df_negate_lazy(c->real) : df_negate(c->real);
+    df_frac imag = c->lazy ? dc_df_negate_lazy(c->imag) : df_negate(c->imag);
+    dc_frac_set_df(out, real, imag);
+    out->lazy = c->lazy;
+    df_release(&real);
+    df_release(&imag);
+}
+
+DC_DEF dc_complex_frac dc_frac_negate(dc_complex_frac c) {
+    dc_complex_frac result = dc_frac_alloc();
+    dc_frac_negate_to(result, c);
+    return result;
+}
+
+static void dc_frac_conj_to(dc_complex_frac out, dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_conj: operand cannot be NULL");
+
+    df_frac real = df_retain(c->real);
+    df_frac imag = c->lazy ? dc_df_negate_lazy(c->imag) : df_negate(c->imag);
+    dc_frac_set_df(out, real, imag);
+    out->lazy = c->lazy;
+    df_release(&real);
+    df_release(&imag);
+}
+
+DC_DEF dc_complex_frac dc_frac_conj(dc_complex_frac c) {
+    dc_complex_frac result = dc_frac_alloc();
+    dc_frac_conj_to(result, c);
+    return result;
+}
+
+// Unreduced norm (p²s² + r²q²) / (q²s²) of p/q + (r/s)i
+static void dc_frac_norm_parts(dc_complex_frac c, di_int* num, di_int* den) {
+    di_int p2 = di_mul(c->real->numerator, c->real->numerator);
+    di_int q2 = di_mul(c->real->denominator, c->real->denominator);
+    di_int r2 = di_mul(c->imag->numerator, c->imag->numerator);
+    di_int s2 = di_mul(c->imag->denominator, c->imag->denominator);
+    di_int ps = di_mul(p2, s2), rq = di_mul(r2, q2);
+    *num = di_add(ps, rq);
+    *den = di_mul(q2, s2);
+    di_release(&p2);
+    di_release(&q2);
+    di_release(&r2);
+    di_release(&s2);
+    di_release(&ps);
+    di_release(&rq);
+}
+
+DC_DEF df_frac dc_frac_norm(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_norm: operand cannot be NULL");
+
+    if (c->lazy) {
+        // Unreduced components: one full reduction at the end
+        di_int num, den;
+        dc_frac_norm_parts(c, &num, &den);
+        df_frac result = df_from_di(num, den);
+        di_release(&num);
+        di_release(&den);
+        return result;
+    }
+
+    di_int p = c->real->numerator, q = c->real->denominator;
+    di_int r = c->imag->numerator, s = c->imag->denominator;
+    di_int p2 = di_mul(p, p), r2 = di_mul(r, r);
+    df_frac result;
+
+    if (di_eq(q, s)) {
+        // p²/q² and r²/q² are in lowest terms; only their sum can share factors with q
+        di_int num = di_add(p2, r2);
+        di_int q2 = di_mul(q, q);
+        result = di_is_one(q) ? dc_df_node(num, q) : df_from_di(num, q2);
+        di_release(&num);
+        di_release(&q2);
+    } else {
+        // With g = gcd(q, s), q = g q', s = g s': the sum is (p² s'² + r² q'²) / (g² q'² s'²),
+        // and the numerator is coprime to q' and s', so only g² can cancel
+        di_int g = di_gcd(q, s);
+        di_int q1 = di_div(q, g), s1 = di_div(s, g);
+        di_int q1_2 = di_mul(q1, q1), s1_2 = di_mul(s1, s1);
+        di_int ps = di_mul(p2, s1_2), rq = di_mul(r2, q1_2);
+        di_int num = di_add(ps, rq);
+        di_int den_rest = di_mul(q1_2, s1_2);
+        if (di_is_one(g)) {
+            result = dc_df_node(num, den_rest);
+        } else {
+            di_int g2 = di_mul(g, g);
+            df_frac part = df_from_di(num, g2);  // num / g² reduced
+            di_int den = di_mul(part->denominator, den_rest);
+            result = dc_df_node(part->numerator, den);
+            df_release(&part);
+            di_release(&g2);
+            di_release(&den);
+        }
+        di_release(&g);
+        di_release(&q1);
+        di_release(&s1);
+        di_release(&q1_2);
+        di_release(&s1_2);
+        di_release(&ps);
+        di_release(&rq);
+        di_release(&num);
+        di_release(&den_rest);
+    }
+
+    di_release(&p2);
+    di_release(&r2);
+    return result;
+}
+
+static void dc_frac_reciprocal_to(dc_complex_frac out, dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_reciprocal: operand cannot be NULL");
+    DC_ASSERT(!dc_frac_is_zero(c) && "dc_frac_reciprocal: division by zero");
+
+    // c = r1/s1 + (r2/s2)i
+    di_int r1 = c->real->numerator, s1 = c->real->denominator;
+    di_int r2 = c->imag->numerator, s2 = c->imag->denominator;
+    di_int zero = di_zero();
+    di_int one = di_one();
+
+    if (di_is_zero(r2)) {
+        df_frac real = df_from_di(s1, r1);
+        df_frac imag = df_from_di(zero, one);
+        dc_frac_set_df(out, real, imag);
+        df_release(&real);
+        df_release(&imag);
+    } else if (di_is_zero(r1)) {
+        // 1 / ((r2/s2)i) = (s2/(-r2))i
+        di_int neg_r2 = di_negate(r2);
+        df_frac real = df_from_di(zero, one);
+        df_frac imag = df_from_di(s2, neg_r2);
+        dc_frac_set_df(out, real, imag);
+        di_release(&neg_r2);
+        df_release(&real);
+        df_release(&imag);
+    } else {
+        dc_frac_div_common(out, one, zero, one, c);
+    }
+
+    di_release(&zero);
+    di_release(&one);
+    out->lazy = c->lazy;
+}
+
+DC_DEF dc_complex_frac dc_frac_reciprocal(dc_complex_frac c) {
+    dc_complex_frac result = dc_frac_alloc();
+    dc_frac_reciprocal_to(result, c);
+    return result;
+}
+
+DC_DEF df_frac dc_frac_real(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_real: operand cannot be NULL");
+    return c->lazy ? dc_df_reduce(c->real) : df_retain(c->real);
+}
+
+DC_DEF df_frac dc_frac_imag(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_imag: operand cannot be NULL");
+    return c->lazy ? dc_df_reduce(c->imag) : df_retain(c->imag);
+}
+
+// For x = n/d, 2^(e-1) < |x| < 2^(e+1) with e = bits(n) - bits(d); the larger of the two
+// component estimates bounds the magnitude the same way. Only meaningful for nonzero c.
+static long dc_frac_magnitude_exponent(dc_complex_frac c) {
+    long best = LONG_MIN;
+    df_frac parts[2] = {c->real, c->imag};
+    for (int k = 0; k < 2; k++) {
+        if (di_is_zero(parts[k]->numerator)) continue;
+        long e = (long)di_bit_length(parts[k]->numerator) - (long)di_bit_length(parts[k]->denominator);
+        if (e > best) best = e;
+    }
+    return best;
+}
+
+DC_DEF int dc_frac_compare_abs(dc_complex_frac a, dc_complex_frac b) {
+    DC_ASSERT(a && "dc_frac_compare_abs: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_frac_compare_abs: second operand cannot be NULL");
+
+    bool a_zero = di_is_zero(a->real->numerator) && di_is_zero(a->imag->numerator);
+    bool b_zero = di_is_zero(b->real->numerator) && di_is_zero(b->imag->numerator);
+    if (a_zero || b_zero) return (int)!a_zero - (int)!b_zero;
+
+    // 2^(2E-2) < norm < 2^(2E+3), so exponents three apart decide the order
+    long a_exp = dc_frac_magnitude_exponent(a), b_exp = dc_frac_magnitude_exponent(b);
+    if (a_exp >= b_exp + 3) return 1;
+    if (b_exp >= a_exp + 3) return -1;
+
+    // Denominators are positive, so cross-multiplying the unreduced norms preserves the order
+    di_int a_num, a_den, b_num, b_den;
+    dc_frac_norm_parts(a, &a_num, &a_den);
+    dc_frac_norm_parts(b, &b_num, &b_den);
+    di_int lhs = di_mul(a_num, b_den), rhs = di_mul(b_num, a_den);
+    int result = di_compare(lhs, rhs);
+    di_release(&a_num);
+    di_release(&a_den);
+    di_release(&b_num);
+    di_release(&b_den);
+    di_release(&lhs);
+    di_release(&rhs);
+    return result;
+}
+
+DC_DEF bool dc_frac_eq(dc_complex_frac a, dc_complex_frac b) {
+    DC_ASSERT(a && "dc_frac_eq: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_frac_eq: second operand cannot be NULL");
+
+    return df_eq(a->real, b->real) && df_eq(a->imag, b->imag);
+}
+
+DC_DEF bool dc_frac_is_zero(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_is_zero: operand cannot be NULL");
+    return df_is_zero(c->real) && df_is_zero(c->imag);
+}
+
+DC_DEF bool dc_frac_is_real(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_is_real: operand cannot be NULL");
+    return df_is_zero(c->imag);
+}
+
+DC_DEF bool dc_frac_is_imag(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_is_imag: operand cannot be NULL");
+    return df_is_zero(c->real);
+}
+
+DC_DEF bool dc_frac_is_gaussian_int(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_is_gaussian_int: operand cannot be NULL");
+    return dc_df_is_integer(c->real, c->lazy) && dc_df_is_integer(c->imag, c->lazy);
+}
+
+DC_DEF char* dc_frac_to_string(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_to_string: operand cannot be NULL");
+
+    if (c->lazy) {
+        dc_complex_frac reduced = dc_frac_normalize(c);
+        char* result = dc_frac_to_string(reduced);
+        dc_frac_release(&reduced);
+        return result;
+    }
+
+    // Component strings are freed with free(), so keep them off the arena
+    DC_ARENA_SUSPEND();
+
+    char* real_str = df_to_string(c->real);
+    char* imag_str = df_to_string(c->imag);
+
+    size_t len = strlen(real_str) + strlen(imag_str) + 10;
+    char* result = DC_MALLOC(len);
+    DC_ASSERT(result && "dc_frac_to_string: allocation failed");
+
+    bool real_zero = df_is_zero(c->real);
+    bool imag_zero = df_is_zero(c->imag);
+    bool imag_neg = df_is_negative(c->imag);
+
+    if (real_zero && imag_zero) {
+        strcpy(result, "0");
+    } else if (imag_zero) {
+        strcpy(result, real_str);
+    } else if (real_zero) {
+        df_frac one = df_one();
+        df_frac neg_one = df_neg_one();
+        if (df_cmp(c->imag, one) == 0) {
+            strcpy(result, "i");
+        } else if (df_cmp(c->imag, neg_one) == 0) {
+            strcpy(result, "-i");
+        } else {
+            sprintf(result, "%si", imag_str);
+        }
+        df_release(&one);
+        df_release(&neg_one);
+    } else {
+        df_frac one = df_one();
+        df_frac neg_one = df_neg_one();
+        if (df_cmp(c->imag, one) == 0) {
+            sprintf(result, "%s+i", real_str);
+        } else if (df_cmp(c->imag, neg_one) == 0) {
+            sprintf(result, "%s-i", real_str);
+        } else if (imag_neg) {
+            sprintf(result, "%s%si", real_str, imag_str);
+        } else {
+            sprintf(result, "%s+%si", real_str, imag_str);
+        }
+        df_release(&one);
+        df_release(&neg_one);
+    }
+
+    free(real_str);
+    free(imag_str);
+    DC_ARENA_RESUME();
+
+    return result;
+}
+
+// ============================================================================
+// COMMON-DENOMINATOR RATIONAL IMPLEMENTATION
+// ============================================================================
+
+// Node for an already canonical (real + imag i)/den; takes ownership of the integers
+static dc_complex_cfrac dc_cfrac_alloc(di_int real, di_int imag, di_int den) {
+    dc_complex_cfrac result = DC_OBJ_MALLOC(sizeof(struct dc_complex_cfrac_internal));
+    DC_ASSERT(result && "dc_cfrac_alloc: allocation failed");
+
+    dc_refcount_init(&result->ref_count);
+    DC_STATS_LIVE(DC_STAT_LIVE_CFRAC, 1);
+    DC_TRACK_NEW(result);
+    result->real = real;
+    result->imag = imag;
+    result->den = den;
+    return result;
+}
+
+// Bring (real + imag i)/den to canonical form with one gcd(real, imag, den) and
+// build the node; takes ownership of the integers
+static dc_complex_cfrac dc_cfrac_make(di_int real, di_int imag, di_int den) {
+    DC_ASSERT(!di_is_zero(den) && "dc_cfrac: denominator cannot be zero");
+
+    if (di_is_negative(den)) {
+        di_int neg_real = di_negate(real);
+        di_int neg_imag = di_negate(imag);
+        di_int neg_den = di_negate(den);
+        di_release(&real);
+        di_release(&imag);
+        di_release(&den);
+        real = neg_real;
+        imag = neg_imag;
+        den = neg_den;
+    }
+
+    // Gaussian integers (den = 1) are already in lowest terms
+    if (!di_is_one(den)) {
+        di_int g = di_gcd(den, real);
+        if (!di_is_one(g)) {
+            di_int h = di_gcd(g, imag);
+            di_release(&g);
+            g = h;
+        }
+        if (!di_is_one(g)) {
+            di_int new_real = di_div(real, g);
+            di_int new_imag = di_div(imag, g);
+            di_int new_den = di_div(den, g);
+            di_release(&real);
+            di_release(&imag);
+            di_release(&den);
+            real = new_real;
+            imag = new_imag;
+            den = new_den;
+        }
+        di_release(&g);
+    }
+
+    return dc_cfrac_alloc(real, imag, den);
+}
+
+DC_DEF dc_complex_cfrac dc_cfrac_from_di(di_int real, di_int imag, di_int den) {
+    DC_ASSERT(real && "dc_cfrac_from_di: real part cannot be NULL");
+    DC_ASSERT(imag && "dc_cfrac_from_di: imaginary part cannot be NULL");
+    DC_ASSERT(den && !di_is_zero(den) && "dc_cfrac_from_di: denominator cannot be zero");
+
+    return dc_cfrac_make(di_retain(real), di_retain(imag), di_retain(den));
+}
+
+DC_DEF dc_complex_cfrac dc_cfrac_from_ints(int64_t real, int64_t imag, int64_t den) {
+    DC_ASSERT(den != 0 && "dc_cfrac_from_ints: denominator cannot be zero");
+
+    return dc_cfrac_make(di_from_int64(real), di_from_int64(imag), di_from_int64(den));
+}
+
+DC_DEF dc_complex_cfrac dc_cfrac_retain(dc_complex_cfrac c) {
+    DC_ASSERT(c && "dc_cfrac_retain: cannot retain NULL");
+    dc_refcount_retain(&c->ref_count);
+    return c;
+}
+
+static void dc_cfrac_destroy(dc_complex_cfrac c) {
+    di_release(&c->real);
+    di_release(&c->imag);
+    di_release(&c->den);
+    DC_TRACK_FORGET(c);
+    DC_OBJ_FREE(c);
+    DC_STATS_LIVE(DC_STAT_LIVE_CFRAC, -1);
+}
+
+DC_DEF void dc_cfrac_release(dc_complex_cfrac* c) {
+    if (!c || !*c) return;
+
+    if (dc_refcount_release(&(*c)->ref_count, DC_KIND_CFRAC)) dc_cfrac_destroy(*c);
+    *c = NULL;
+}
+
+DC_DEF dc_complex_cfrac dc_cfrac_make_immortal(dc_complex_cfrac c) {
+    DC_ASSERT(c && "dc_cfrac_make_immortal: value cannot be NULL");
+#if DC_ARENA
+    DC_ASSERT(!dc_arena_contains(c) && "dc_cfrac_make_immortal: arena values cannot be immortal");
+#endif
+    dc_refcount_make_immortal(&c->ref_count);
+    DC_TRACK_FORGET(c);
+    return c;
+}
+
+DC_DEF bool dc_cfrac_is_immortal(dc_complex_cfrac c) {
+    DC_ASSERT(c && "dc_cfrac_is_immortal: value cannot be NULL");
+    return dc_refcount_is_immortal(&c->ref_count);
+}
+
+// a ± b over a shared denominator; only cross-multiplies when the denominators differ
+static dc_complex_cfrac dc_cfrac_add_sub(dc_complex_cfrac a, dc_complex_cfrac b, bool subtract) {
+    di_int (*op)(di_int, di_int) = subtract ? di_sub : di_add;
+    if (di_eq(a->den, b->den)) {
+        return dc_cfrac_make(op(a->real, b->real), op(a->imag, b->imag), di_retain(a->den));
+    }
+
+    di_int pf = di_mul(a->real, b->den);
+    di_int rd = di_mul(b->real, a->den);
+    di_int qf = di_mul(a->imag, b->den);
+    di_int sd = di_mul(b->imag, a->den);
+    dc_complex_cfrac result = dc_cfrac_make(op(pf, rd), op(qf, sd), di_mul(a->den, b->den));
+    di_release(&pf);
+    di_release(&rd);
+    di_release(&qf);
+    di_release(&sd);
+    return result;
+}
+
+DC_DEF dc_complex_cfrac dc_cfrac_add(dc_complex_cfrac a, dc_complex_cfrac b) {
+    DC_ASSERT(a && "dc_cfrac_add: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_cfrac_add: second operand cannot be NULL");
+    return dc_cfrac_add_sub(a, b, false);
+}
+
+DC_DEF dc_complex_cfrac dc_cfrac_sub(dc_complex_cfrac a, dc_complex_cfrac b) {
+    DC_ASSERT(a && "dc_cfrac_sub: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_cfrac_sub: second operand cannot be NULL");
+    return dc_cfrac_add_sub(a, b, true);
+}
+
+// Gaussian integer product of numerators, dispatched like dc_int_mul
+static void dc_cfrac_mul_numerators(di_int p, di_int q, di_int r, di_int s, di_int* real, di_int* imag) {
+    size_t a_limbs = di_limb_count(p) > di_limb_count(q) ? di_limb_count(p) : di_limb_count(q);
+    size_t b_limbs = di_limb_count(r) > di_limb_count(s) ? di_limb_count(r) : di_limb_count(s);
+    if (a_limbs >= DC_GAUSS_MUL_THRESHOLD && b_limbs >= DC_GAUSS_MUL_THRESHOLD) {
+        dc_int_mul_gauss(p, q, r, s, real, imag);
+    } else {
+        dc_int_mul_schoolbook(p, q, r, s, real, imag);
+    }
+}
+
+DC_DEF dc_complex_cfrac dc_cfrac_mul(dc_complex_cfrac a, dc_complex_cfrac b) {
+    DC_ASSERT(a && "dc_cfrac_mul: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_cfrac_mul: second operand cannot be NULL");
+
+    di_int real, imag;
+    dc_cfrac_mul_numerators(a->real, a->imag, b->real, b->imag, &real, &imag);
+    return dc_cfrac_make(real, imag, di_mul(a->den, b->den));
+}
+
+DC_DEF dc_complex_cfrac dc_cfrac_div(dc_complex_cfrac a, dc_complex_cfrac b) {
+    DC_ASSERT(a && "dc_cfrac_div: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_cfrac_div: second operand cannot be NULL");
+    DC_ASSERT(!dc_cfrac_is_zero(b) && "dc_cfrac_div: division by zero");
+
+    // (p+qi)/d / ((r+si)/f) = (p+qi)(r-si) f / (d (r² + s²))
+    di_int neg_s = di_negate(b->imag);
+    di_int real, imag;
+    dc_cfrac_mul_numerators(a->real, a->imag, b->real, neg_s, &real, &imag);
+
+    di_int r2 = di_mul(b->real, b->real);
+    di_int s2 = di_mul(b->imag, b->imag);
+    di_int norm = di_add(r2, s2);
+    di_int den = di_mul(a->den, norm);
+
+    if (!di_is_one(b->den)) {
+        di_int scaled_real = di_mul(real, b->den);
+        di_int scaled_imag = di_mul(imag, b->den);
+        di_release(&real);
+        di_release(&imag);
+        real = scaled_real;
+        imag = scaled_imag;
+    }
+
+    di_release(&neg_s);
+    di_release(&r2);
+    di_release(&s2);
+    di_release(&norm);
+
+    return dc_cfrac_make(real, imag, den);
+}
+
+DC_DEF dc_complex_cfrac dc_cfrac_negate(dc_complex_cfrac c) {
+    DC_ASSERT(c && "dc_cfrac_negate: operand cannot be NULL");
+    return dc_cfrac_alloc(di_negate(c->real), di_negate(c->imag), di_retain(c->den));
+}
+
+DC_DEF dc_complex_cfrac dc_cfrac_conj(dc_complex_cfrac c) {
+    DC_ASSERT(c && "dc_cfrac_conj: operand cannot be NULL");
+    return dc_cfrac_alloc(di_retain(c->real), di_negate(c->imag), di_retain(c->den));
+}
+
+DC_DEF df_frac dc_cfrac_norm(dc_complex_cfrac c) {
+    DC_ASSERT(c && "dc_cfrac_norm: operand cannot be NULL");
+
+    di_int a2 = di_mul(c->real, c->real);
+    di_int b2 = di_mul(c->imag, c->imag);
+    di_int num = di_add(a2, b2);
+    di_int den = di_mul(c->den, c->den);
+    df_frac result = df_from_di(num, den);
+
+    di_release(&a2);
+    di_release(&b2);
+    di_release(&num);
+    di_release(&den);
+    return result;
+}
+
+DC_DEF dc_complex_int dc_cfrac_numerator(dc_complex_cfrac c) {
+    DC_ASSERT(c && "dc_cfrac_numerator: operand cannot be NULL");
+    return dc_int_from_di(c->real, c->imag);
+}
+
+DC_DEF di_int dc_cfrac_denominator(dc_complex_cfrac c) {
+    DC_ASSERT(c && "dc_cfrac_denominator: operand cannot be NULL");
+    return di_retain(c->den);
+}
+
+DC_DEF bool dc_cfrac_eq(dc_complex_cfrac a, dc_complex_cfrac b) {
+    DC_ASSERT(a && "dc_cfrac_eq: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_cfrac_eq: second operand cannot be NULL");
+
+    // Canonical form makes equality structural
+    return di_eq(a->den, b->den) && di_eq(a->real, b->real) && di_eq(a->imag, b->imag);
+}
+
+DC_DEF bool dc_cfrac_is_zero(dc_complex_cfrac c) {
+    DC_ASSERT(c && "dc_cfrac_is_zero: operand cannot be NULL");
+    return di_is_zero(c->real) && di_is_zero(c->imag);
+}
+
+DC_DEF dc_complex_cfrac dc_frac_to_cfrac(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_to_cfrac: operand cannot be NULL");
+
+    // Over lcm(d1, d2) with reduced components the result is already canonical
+    df_frac real = dc_frac_real(c);
+    df_frac imag = dc_frac_imag(c);
+    di_int den, real_num, imag_num;
+    if (di_eq(real->denominator, imag->denominator)) {
+        den = di_retain(real->denominator);
+        real_num = di_retain(real->numerator);
+        imag_num = di_retain(imag->numerator);
+    } else {
+        den = di_lcm(real->denominator, imag->denominator);
+        di_int real_scale = di_div(den, real->denominator);
+        di_int imag_scale = di_div(den, imag->denominator);
+        real_num = di_mul(real->numerator, real_scale);
+        imag_num = di_mul(imag->numerator, imag_scale);
+        di_release(&real_scale);
+        di_release(&imag_scale);
+    }
+
+    df_release(&real);
+    df_release(&imag);
+    return dc_cfrac_alloc(real_num, imag_num, den);
+}
+
+DC_DEF dc_complex_frac dc_cfrac_to_frac(dc_complex_cfrac c) {
+    DC_ASSERT(c && "dc_cfrac_to_frac: operand cannot be NULL");
+
+    df_frac real = df_from_di(c->real, c->den);
+    df_frac imag = df_from_di(c->imag, c->den);
+    dc_complex_frac result = dc_frac_from_df(real, imag);
+    df_release(&real);
+    df_release(&imag);
+    return result;
+}
+
+DC_DEF char* dc_cfrac_to_string(dc_complex_cfrac c) {
+    DC_ASSERT(c && "dc_cfrac_to_string: operand cannot be NULL");
+
+    dc_complex_int num = dc_cfrac_numerator(c);
+    char* num_str = dc_int_to_string(num);
+    dc_int_release(&num);
+    if (di_is_one(c->den)) return num_str;
+
+    // Component strings are freed with free(), so keep them off the arena
+    DC_ARENA_SUSPEND();
+    char* den_str = di_to_string(c->den, 10);
+    size_t len = strlen(num_str) + strlen(den_str) + 4;
+    char* result = DC_MALLOC(len);
+    DC_ASSERT(result && "dc_cfrac_to_string: allocation failed");
+
+    // Parenthesize only when both components are present
+    if (!di_is_zero(c->real) && !di_is_zero(c->imag)) {
+        snprintf(result, len, "(%s)/%s", num_str, den_str);
+    } else {
+        snprintf(result, len, "%s/%s", num_str, den_str);
+    }
+
+    free(num_str);
+    free(den_str);
+    DC_ARENA_RESUME();
+
+    return result;
+}
+
+// ============================================================================
+// DOUBLE COMPLEX IMPLEMENTATION
+// ============================================================================
+
+#if DC_POOL_DOUBLE
+// Pool nodes double as freelist links while unused
+typedef union dc_double_pool_node {
+    union dc_double_pool_node* next;
+    struct dc_complex_double_internal value;
+} dc_double_pool_node;
+
+typedef struct dc_double_pool_slab {
+    struct dc_double_pool_slab* next;
+    dc_double_pool_node nodes[DC_POOL_SLAB_NODES];
+} dc_double_pool_slab;
+
+static DC_THREAD_LOCAL dc_double_pool_node* dc_double_pool_free_list = NULL;
+static DC_THREAD_LOCAL dc_double_pool_slab* dc_double_pool_slabs = NULL;
+static DC_THREAD_LOCAL dc_pool_stats dc_double_pool_counters;
+
+// Free nodes and slabs handed back by dc_double_pool_detach(); slabs are only kept reachable
+static _Atomic(dc_double_pool_node*) dc_double_pool_orphans = NULL;
+static _Atomic(dc_double_pool_slab*) dc_double_pool_retired = NULL;
+
+static void dc_double_pool_refill(void) {
+    // Take every orphaned node at once; swapping the whole list out avoids ABA on the head
+    dc_double_pool_node* orphans = atomic_exchange_explicit(&dc_double_pool_orphans, NULL, memory_order_acquire);
+    if (orphans) {
+        dc_double_pool_free_list = orphans;
+        return;
+    }
+
+    dc_double_pool_slab* slab = DC_MALLOC(sizeof(dc_double_pool_slab));
+    DC_ASSERT(slab && "dc_double_pool_refill: allocation failed");
+
+    slab->next = dc_double_pool_slabs;
+    dc_double_pool_slabs = slab;
+
+    for (size_t i = 0; i < DC_POOL_SLAB_NODES - 1; i++) {
+        slab->nodes[i].next = &slab->nodes[i + 1];
+    }
+    slab->nodes[DC_POOL_SLAB_NODES - 1].next = dc_double_pool_free_list;
+    dc_double_pool_free_list = &slab->nodes[0];
+
+    dc_double_pool_counters.slabs++;
+}
+
+DC_DEF void dc_double_pool_stats(dc_pool_stats* stats) {
+    DC_ASSERT(stats && "dc_double_pool_stats: stats cannot be NULL");
+
+    *stats = dc_double_pool_counters;
+    size_t total = stats->hits + stats->misses;
+    stats->hit_rate = total ? (double)stats->hits / (double)total : 0.0;
+}
+
+DC_DEF void dc_double_pool_detach(void) {
+    dc_double_pool_node* nodes = dc_double_pool_free_list;
+    if (nodes) {
+        dc_double_pool_node* tail = nodes;
+        while (tail->next) tail = tail->next;
+        tail->next = atomic_load_explicit(&dc_double_pool_orphans, memory_order_relaxed);
+        while (!atomic_compare_exchange_weak_explicit(&dc_double_pool_orphans, &tail->next, nodes,
+                                                      memory_order_release, memory_order_relaxed)) {
+        }
+    }
+
+    dc_double_pool_slab* slabs = dc_double_pool_slabs;
+    if (slabs) {
+        dc_double_pool_slab* tail = slabs;
+        while (tail->next) tail = tail->next;
+        tail->next = atomic_load_explicit(&dc_double_pool_retired, memory_order_relaxed);
+        while (!atomic_compare_exchange_weak_explicit(&dc_double_pool_retired, &tail->next, slabs,
+                                                      memory_order_release, memory_order_relaxed)) {
+        }
+    }
+
+    dc_double_pool_free_list = NULL;
+    dc_double_pool_slabs = NULL;
+}
+#endif
+
+// Allocate an uninitialized node with reference count 1
+static dc_complex_double dc_double_alloc(void) {
+    DC_STATS_LIVE(DC_STAT_LIVE_DOUBLE, 1);
+#if DC_ARENA
+    if (dc_arena_active()) {
+        dc_complex_double result = dc_arena_bump(sizeof(struct dc_complex_double_internal));
+        dc_refcount_init(&result->ref_count);
+        DC_TRACK_NEW(result);
+        return result;
+    }
+#endif
+
+#if DC_POOL_DOUBLE
+    if (dc_double_pool_free_list) {
+        dc_double_pool_counters.hits++;
+    } else {
+        dc_double_pool_refill();
+        dc_double_pool_counters.misses++;
+    }
+
+    dc_double_pool_node* node = dc_double_pool_free_list;
+    dc_double_pool_free_list = node->next;
+    dc_complex_double result = &node->value;
+#else
+    dc_complex_double result = DC_OBJ_MALLOC(sizeof(struct dc_complex_double_internal));
+    DC_ASSERT(result && "dc_double_alloc: allocation failed");
+#endif
+
+    dc_refcount_init(&result->ref_count);
+    DC_TRACK_NEW(result);
+    return result;
+}
+
+static void dc_double_free(dc_complex_double c) {
+    DC_STATS_LIVE(DC_STAT_LIVE_DOUBLE, -1);
+    DC_TRACK_FORGET(c);
+#if DC_ARENA
+    if (dc_arena_contains(c)) return;
+#endif
+
+#if DC_POOL_DOUBLE
+    dc_double_pool_node* node = (dc_double_pool_node*)c;
+    node->next = dc_double_pool_free_list;
+    dc_double_pool_free_list = node;
+    dc_double_pool_counters.releases++;
+#else
+    DC_OBJ_FREE(c);
+#endif
+}
+
+DC_DEF dc_complex_double dc_double_from_doubles(double real, double imag) {
+    dc_complex_double result = dc_double_alloc();
+    result->value = dcv_double_from_doubles(real, imag);
+
+    return result;
+}
+
+DC_DEF dc_complex_double dc_double_from_polar(double magnitude, double angle) {
+    dc_complex_double result = dc_double_alloc();
+    result->value = dcv_double_from_polar(magnitude, angle);
+
+    return result;
+}
+
+DC_DEF dc_complex_double dc_double_from_value(double complex value) {
+    dc_complex_double result = dc_double_alloc();
+    result->value = value;
+
+    return result;
+}
+
+DC_DEF dc_complex_double dc_double_zero(void) {
+    return &dc_double_zero_constant;
+}
+
+DC_DEF dc_complex_double dc_double_one(void) {
+    return &dc_double_one_constant;
+}
+
+DC_DEF dc_complex_double dc_double_i(void) {
+    return &dc_double_i_constant;
+}
+
+DC_DEF dc_complex_double dc_double_neg_one(void) {
+    return &dc_double_neg_one_constant;
+}
+
+DC_DEF dc_complex_double dc_double_neg_i(void) {
+    return &dc_double_neg_i_constant;
+}
+
+DC_DEF dc_complex_double dc_double_retain(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_retain: cannot retain NULL");
+    dc_refcount_retain(&c->ref_count);
+    return c;
+}
+
+DC_DEF void dc_double_release(dc_complex_double* c) {
+    if (!c || !*c) return;
+
+    if (dc_refcount_release(&(*c)->ref_count, DC_KIND_DOUBLE)) dc_double_free(*c);
+    *c = NULL;
+}
+
+DC_DEF dc_complex_double dc_double_make_immortal(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_make_immortal: value cannot be NULL");
+#if DC_ARENA
+    DC_ASSERT(!dc_arena_contains(c) && "dc_double_make_immortal: arena values cannot be immortal");
+#endif
+    dc_refcount_make_immortal(&c->ref_count);
+    DC_TRACK_FORGET(c);
+    return c;
+}
+
+DC_DEF bool dc_double_is_immortal(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_is_immortal: value cannot be NULL");
+    return dc_refcount_is_immortal(&c->ref_count);
+}
+
+DC_DEF dc_complex_double dc_double_copy(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_copy: cannot copy NULL");
+    return dc_double_from_value(c->value);
+}
+
+DC_DEF dc_complex_double dc_double_add(dc_complex_double a, dc_complex_double b) {
+    DC_ASSERT(a && "dc_double_add: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_double_add: second operand cannot be NULL");
+
+    dc_complex_double result = dc_double_alloc();
+    result->value = dcv_double_add(a->value, b->value);
+
+    return result;
+}
+
+DC_DEF dc_complex_double dc_double_sub(dc_complex_double a, dc_complex_double b) {
+    DC_ASSERT(a && "dc_double_sub: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_double_sub: second operand cannot be NULL");
+
+    dc_complex_double result = dc_double_alloc();
+    result->value = dcv_double_sub(a->value, b->value);
+
+    return result;
+}
+
+DC_DEF dc_complex_double dc_double_mul(dc_complex_double a, dc_complex_double b) {
+    DC_ASSERT(a && "dc_double_mul: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_double_mul: second operand cannot be NULL");
+
+    dc_complex_double result = dc_double_alloc();
+    result->value = dcv_double_mul(a->value, b->value);
+
+    return result;
+}
+
+DC_DEF dc_complex_double dc_double_div(dc_complex_double a, dc_complex_double b) {
+    DC_ASSERT(a && "dc_double_div: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_double_div: second operand cannot be NULL");
+    DC_ASSERT(!dc_double_is_zero(b) && "dc_double_div: division by zero");
+
+    dc_complex_double result = dc_double_alloc();
+    result->value = dcv_double_div(a->value, b->value);
+
+    return result;
+}
+
+DC_DEF dc_complex_double dc_double_negate(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_negate: operand cannot be NULL");
+
+    dc_complex_double result = dc_double_alloc();
+    result->value = dcv_double_negate(c->value);
+
+    return result;
+}
+
+DC_DEF dc_complex_double dc_double_conj(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_conj: operand cannot be NULL");
+
+    dc_complex_double result = dc_double_alloc();
+    result->value = dcv_double_conj(c->value);
+
+    return result;
+}
+
+DC_DEF dc_complex_double dc_double_exp(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_exp: operand cannot be NULL");
+
+    dc_complex_double result = dc_double_alloc();
+    result->value = dcv_double_exp(c->value);
+
+    return result;
+}
+
+DC_DEF dc_complex_double dc_double_log(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_log: operand cannot be NULL");
+    DC_ASSERT(!dc_double_is_zero(c) && "dc_double_log: log of zero");
+
+    dc_complex_double result = dc_double_alloc();
+    result->value = dcv_double_log(c->value);
+
+    return result;
+}
+
+DC_DEF dc_complex_double dc_double_pow(dc_complex_double a, dc_complex_double b) {
+    DC_ASSERT(a && "dc_double_pow: base cannot be NULL");
+    DC_ASSERT(b && "dc_double_pow: exponent cannot be NULL");
+
+    dc_complex_double result = dc_double_alloc();
+    result->value = dcv_double_pow(a->value, b->value);
+
+    return result;
+}
+
+DC_DEF dc_complex_double dc_double_sqrt(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_sqrt: operand cannot be NULL");
+
+    dc_complex_double result = dc_double_alloc();
+    result->value = dcv_double_sqrt(c->value);
+
+    return result;
+}
+
+DC_DEF dc_complex_double dc_double_sin(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_sin: operand cannot be NULL");
+
+    dc_complex_double result = dc_double_alloc();
+    result->value = dcv_double_sin(c->value);
+
+    return result;
+}
+
+DC_DEF dc_complex_double dc_double_cos(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_cos: operand cannot be NULL");
+
+    dc_complex_double result = dc_double_alloc();
+    result->value = dcv_double_cos(c->value);
+
+    return result;
+}
+
+DC_DEF dc_complex_double dc_double_tan(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_tan: operand cannot be NULL");
+
+    dc_complex_double result = dc_double_alloc();
+    result->value = dcv_double_tan(c->value);
+
+    return result;
+}
+
+DC_DEF dc_complex_double dc_double_sinh(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_sinh: operand cannot be NULL");
+
+    dc_complex_double result = dc_double_alloc();
+    result->value = dcv_double_sinh(c->value);
+
+    return result;
+}
+
+DC_DEF dc_complex_double dc_double_cosh(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_cosh: operand cannot be NULL");
+
+    dc_complex_double result = dc_double_alloc();
+    result->value = dcv_double_cosh(c->value);
+
+    return result;
+}
+
+DC_DEF dc_complex_double dc_double_tanh(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_tanh: operand cannot be NULL");
+
+    dc_complex_double result = dc_double_alloc();
+    result->value = dcv_double_tanh(c->value);
+
+    return result;
+}
+
+DC_DEF double dc_double_real(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_real: operand cannot be NULL");
+    return dcv_double_real(c->value);
+}
+
+DC_DEF double dc_double_imag(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_imag: operand cannot be NULL");
+    return dcv_double_imag(c->value);
+}
+
+DC_DEF double complex dc_double_value(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_value: operand cannot be NULL");
+    return c->value;
+}
+
+DC_DEF double dc_double_abs(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_abs: operand cannot be NULL");
+    return dcv_double_abs(c->value);
+}
+
+DC_DEF double dc_double_arg(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_arg: operand cannot be NULL");
+    return dcv_double_arg(c->value);
+}
+
+DC_DEF bool dc_double_eq(dc_complex_double a, dc_complex_double b) {
+    DC_ASSERT(a && "dc_double_eq: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_double_eq: second operand cannot be NULL");
+
+    return dcv_double_eq(a->value, b->value);
+}
+
+DC_DEF bool dc_double_is_zero(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_is_zero: operand cannot be NULL");
+    return dcv_double_is_zero(c->value);
+}
+
+DC_DEF bool dc_double_is_real(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_is_real: operand cannot be NULL");
+    return dcv_double_is_real(c->value);
+}
+
+DC_DEF bool dc_double_is_imag(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_is_imag: operand cannot be NULL");
+    return dcv_double_is_imag(c->value);
+}
+
+DC_DEF bool dc_double_is_nan(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_is_nan: operand cannot be NULL");
+    return dcv_double_is_nan(c->value);
+}
+
+DC_DEF bool dc_double_is_inf(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_is_inf: operand cannot be NULL");
+    return dcv_double_is_inf(c->value);
+}
+
+DC_DEF char* dc_double_to_string(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_to_string: operand cannot be NULL");
+
+    char* result = DC_MALLOC(256);
+    DC_ASSERT(result && "dc_double_to_string: allocation failed");
+
+    double real = creal(c->value);
+    double imag = cimag(c->value);
+
+    if (real == 0.0 && imag == 0.0) {
+        strcpy(result, "0");
+    } else if (imag == 0.0) {
+        sprintf(result, "%g", real);
+    } else if (real == 0.0) {
+        if (imag == 1.0) {
+            strcpy(result, "i");
+        } else if (imag == -1.0) {
+            strcpy(result, "-i");
+        } else {
+            sprintf(result, "%gi", imag);
+        }
+    } else {
+        if (imag == 1.0) {
+            sprintf(result, "%g+i", real);
+        } else if (imag == -1.0) {
+            sprintf(result, "%g-i", real);
+        } else if (imag < 0) {
+            sprintf(result, "%g%gi", real, imag);
+        } else {
+            sprintf(result, "%g+%gi", real, imag);
+        }
+    }
+
+    return result;
+}
+
+// ============================================================================
+// IN-PLACE ARITHMETIC IMPLEMENTATION
+// ============================================================================
+
+// A uniquely owned node can be overwritten; immortal constants never reach count 1
+static bool dc_int_is_reusable(dc_complex_int c) {
+    if (!c || !dc_refcount_is_unique(&c->ref_count)) return false;
+#if DC_ARENA
+    // A heap node must not pick up digits from an active arena
+    if (dc_arena_active() && !dc_arena_contains(c)) return false;
+#endif
+    return true;
+}
+
+// Replace the contents of a reusable node with a computed result
+static void dc_int_assign(dc_complex_int dst, const struct dc_complex_int_internal* value) {
+    if (!dst->is_small) {
+        di_release(&dst->big.real);
+        di_release(&dst->big.imag);
+    }
+    dst->is_small = value->is_small;
+    if (value->is_small) {
+        dst->small.real = value->small.real;
+        dst->small.imag = value->small.imag;
+    } else {
+        dst->big.real = value->big.real;
+        dst->big.imag = value->big.imag;
+    }
+}
+
+static void dc_int_binary_into(dc_complex_int* dst, dc_complex_int a, dc_complex_int b,
+                               void (*kernel)(dc_complex_int, dc_complex_int, dc_complex_int)) {
+    if (dc_int_is_reusable(*dst)) {
+        // Compute first: dst may alias an operand
+        struct dc_complex_int_internal value;
+        kernel(&value, a, b);
+        dc_int_assign(*dst, &value);
+        return;
+    }
+
+    dc_complex_int result = dc_int_alloc();
+    kernel(result, a, b);
+    dc_int_release(dst);
+    *dst = result;
+}
+
+static void dc_int_unary_into(dc_complex_int* dst, dc_complex_int c,
+                              void (*kernel)(dc_complex_int, dc_complex_int)) {
+    if (dc_int_is_reusable(*dst)) {
+        struct dc_complex_int_internal value;
+        kernel(&value, c);
+        dc_int_assign(*dst, &value);
+        return;
+    }
+
+    dc_complex_int result = dc_int_alloc();
+    kernel(result, c);
+    dc_int_release(dst);
+    *dst = result;
+}
+
+static bool dc_frac_is_reusable(dc_complex_frac c) {
+    if (!c || !dc_refcount_is_unique(&c->ref_count)) return false;
+#if DC_ARENA
+    if (dc_arena_active() && !dc_arena_contains(c)) return false;
+#endif
+    return true;
+}
+
+static void dc_frac_assign(dc_complex_frac dst, const struct dc_complex_frac_internal* value) {
+    df_release(&dst->real);
+    df_release(&dst->imag);
+    dst->lazy = value->lazy;
+    dst->real = value->real;
+    dst->imag = value->imag;
+}
+
+static void dc_frac_binary_into(dc_complex_frac* dst, dc_complex_frac a, dc_complex_frac b,
+                                void (*kernel)(dc_complex_frac, dc_complex_frac, dc_complex_frac)) {
+    if (dc_frac_is_reusable(*dst)) {
+        struct dc_complex_frac_internal value;
+        kernel(&value, a, b);
+        dc_frac_assign(*dst, &value);
+        return;
+    }
+
+    dc_complex_frac result = dc_frac_alloc();
+    kernel(result, a, b);
+    dc_frac_release(dst);
+    *dst = result;
+}
+
+static void dc_frac_unary_into(dc_complex_frac* dst, dc_complex_frac c,
+                               void (*kernel)(dc_complex_frac, dc_complex_frac)) {
+    if (dc_frac_is_reusable(*dst)) {
+        struct dc_complex_frac_internal value;
+        kernel(&value, c);
+        dc_frac_assign(*dst, &value);
+        return;
+    }
+
+    dc_complex_frac result = dc_frac_alloc();
+    kernel(result, c);
+    dc_frac_release(dst);
+    *dst = result;
+}
+
+// Doubles carry no components, so any uniquely owned node can be overwritten
+static void dc_double_store(dc_complex_double* dst, double complex value) {
+    if (*dst && dc_refcount_is_unique(&(*dst)->ref_count)) {
+        (*dst)->value = value;
+        return;
+    }
+
+    dc_double_release(dst);
+    *dst = dc_double_from_value(value);
+}
+
+DC_DEF void dc_int_add_into(dc_complex_int* dst, dc_complex_int a, dc_complex_int b) {
+    DC_ASSERT(dst && "dc_int_add_into: destination cannot be NULL");
+    dc_int_binary_into(dst, a, b, dc_int_add_to);
+}
+
+DC_DEF void dc_int_sub_into(dc_complex_int* dst, dc_complex_int a, dc_complex_int b) {
+    DC_ASSERT(dst && "dc_int_sub_into: destination cannot be NULL");
+    dc_int_binary_into(dst, a, b, dc_int_sub_to);
+}
+
+DC_DEF void dc_int_mul_into(dc_complex_int* dst, dc_complex_int a, dc_complex_int b) {
+    DC_ASSERT(dst && "dc_int_mul_into: destination cannot be NULL");
+    dc_int_binary_into(dst, a, b, dc_int_mul_to);
+}
+
+DC_DEF void dc_int_div_into(dc_complex_frac* dst, dc_complex_int a, dc_complex_int b) {
+    DC_ASSERT(dst && "dc_int_div_into: destination cannot be NULL");
+    DC_ASSERT(a && "dc_int_div_into: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_int_div_into: second operand cannot be NULL");
+
+    dc_complex_frac af = dc_int_to_frac(a);
+    dc_complex_frac bf = dc_int_to_frac(b);
+    dc_frac_div_into(dst, af, bf);
+
+    dc_frac_release(&af);
+    dc_frac_release(&bf);
+}
+
+DC_DEF void dc_int_negate_into(dc_complex_int* dst, dc_complex_int c) {
+    DC_ASSERT(dst && "dc_int_negate_into: destination cannot be NULL");
+    dc_int_unary_into(dst, c, dc_int_negate_to);
+}
+
+DC_DEF void dc_int_conj_into(dc_complex_int* dst, dc_complex_int c) {
+    DC_ASSERT(dst && "dc_int_conj_into: destination cannot be NULL");
+    dc_int_unary_into(dst, c, dc_int_conj_to);
+}
+
+DC_DEF dc_complex_int dc_int_add_steal(dc_complex_int a, dc_complex_int b) {
+    DC_ASSERT(a && "dc_int_add_steal: first operand cannot be NULL");
+    dc_int_add_into(&a, a, b);
+    return a;
+}
+
+DC_DEF dc_complex_int dc_int_sub_steal(dc_complex_int a, dc_complex_int b) {
+    DC_ASSERT(a && "dc_int_sub_steal: first operand cannot be NULL");
+    dc_int_sub_into(&a, a, b);
+    return a;
+}
+
+DC_DEF dc_complex_int dc_int_mul_steal(dc_complex_int a, dc_complex_int b) {
+    DC_ASSERT(a && "dc_int_mul_steal: first operand cannot be NULL");
+    dc_int_mul_into(&a, a, b);
+    return a;
+}
+
+DC_DEF dc_complex_int dc_int_negate_steal(dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_negate_steal: operand cannot be NULL");
+    dc_int_negate_into(&c, c);
+    return c;
+}
+
+DC_DEF dc_complex_int dc_int_conj_steal(dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_conj_steal: operand cannot be NULL");
+    dc_int_conj_into(&c, c);
+    return c;
+}
+
+DC_DEF void dc_frac_add_into(dc_complex_frac* dst, dc_complex_frac a, dc_complex_frac b) {
+    DC_ASSERT(dst && "dc_frac_add_into: destination cannot be NULL");
+    dc_frac_binary_into(dst, a, b, dc_frac_add_to);
+}
+
+DC_DEF void dc_frac_sub_into(dc_complex_frac* dst, dc_complex_frac a, dc_complex_frac b) {
+    DC_ASSERT(dst && "dc_frac_sub_into: destination cannot be NULL");
+    dc_frac_binary_into(dst, a, b, dc_frac_sub_to);
+}
+
+DC_DEF void dc_frac_mul_into(dc_complex_frac* dst, dc_complex_frac a, dc_complex_frac b) {
+    DC_ASSERT(dst && "dc_frac_mul_into: destination cannot be NULL");
+    dc_frac_binary_into(dst, a, b, dc_frac_mul_to);
+}
+
+DC_DEF void dc_frac_div_into(dc_complex_frac* dst, dc_complex_frac a, dc_complex_frac b) {
+    DC_ASSERT(dst && "dc_frac_div_into: destination cannot be NULL");
+    dc_frac_binary_into(dst, a, b, dc_frac_div_to);
+}
+
+DC_DEF void dc_frac_negate_into(dc_complex_frac* dst, dc_complex_frac c) {
+    DC_ASSERT(dst && "dc_frac_negate_into: destination cannot be NULL");
+    dc_frac_unary_into(dst, c, dc_frac_negate_to);
+}
+
+DC_DEF void dc_frac_conj_into(dc_complex_frac* dst, dc_complex_frac c) {
+    DC_ASSERT(dst && "dc_frac_conj_into: destination cannot be NULL");
+    dc_frac_unary_into(dst, c, dc_frac_conj_to);
+}
+
+DC_DEF void dc_frac_reciprocal_into(dc_complex_frac* dst, dc_complex_frac c) {
+    DC_ASSERT(dst && "dc_frac_reciprocal_into: destination cannot be NULL");
+    dc_frac_unary_into(dst, c, dc_frac_reciprocal_to);
+}
+
+DC_DEF dc_complex_frac dc_frac_add_steal(dc_complex_frac a, dc_complex_frac b) {
+    DC_ASSERT(a && "dc_frac_add_steal: first operand cannot be NULL");
+    dc_frac_add_into(&a, a, b);
+    return a;
+}
+
+DC_DEF dc_complex_frac dc_frac_sub_steal(dc_complex_frac a, dc_complex_frac b) {
+    DC_ASSERT(a && "dc_frac_sub_steal: first operand cannot be NULL");
+    dc_frac_sub_into(&a, a, b);
+    return a;
+}
+
+DC_DEF dc_complex_frac dc_frac_mul_steal(dc_complex_frac a, dc_complex_frac b) {
+    DC_ASSERT(a && "dc_frac_mul_steal: first operand cannot be NULL");
+    dc_frac_mul_into(&a, a, b);
+    return a;
+}
+
+DC_DEF dc_complex_frac dc_frac_div_steal(dc_complex_frac a, dc_complex_frac b) {
+    DC_ASSERT(a && "dc_frac_div_steal: first operand cannot be NULL");
+    dc_frac_div_into(&a, a, b);
+    return a;
+}
+
+DC_DEF dc_complex_frac dc_frac_negate_steal(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_negate_steal: operand cannot be NULL");
+    dc_frac_negate_into(&c, c);
+    return c;
+}
+
+DC_DEF dc_complex_frac dc_frac_conj_steal(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_conj_steal: operand cannot be NULL");
+    dc_frac_conj_into(&c, c);
+    return c;
+}
+
+DC_DEF dc_complex_frac dc_frac_reciprocal_steal(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_reciprocal_steal: operand cannot be NULL");
+    dc_frac_reciprocal_into(&c, c);
+    return c;
+}
+
+// ----------------------------------------------------------------------------
+// Powers
+// ----------------------------------------------------------------------------
+
+// Left-to-right square-and-multiply. The accumulator is uniquely owned after the first
+// step, so the in-place kernels reuse its node instead of allocating one per step.
+DC_DEF dc_complex_int dc_int_pow(dc_complex_int c, uint64_t exp) {
+    DC_ASSERT(c && "dc_int_pow: base cannot be NULL");
+    if (exp == 0) return dc_int_one();
+
+    int bit = 63;
+    while (!((exp >> bit) & 1)) bit--;
+    dc_complex_int result = dc_int_retain(c);
+    while (bit-- > 0) {
+        dc_int_unary_into(&result, result, dc_int_square_to);
+        if ((exp >> bit) & 1) dc_int_binary_into(&result, result, c, dc_int_mul_to);
+    }
+    return result;
+}
+
+DC_DEF dc_complex_frac dc_frac_pow(dc_complex_frac c, int64_t exp) {
+    DC_ASSERT(c && "dc_frac_pow: base cannot be NULL");
+    DC_ASSERT((exp >= 0 || !dc_frac_is_zero(c)) && "dc_frac_pow: negative power of zero");
+    if (exp == 0) return dc_frac_one();
+
+    // |INT64_MIN| does not fit int64_t, so the magnitude is taken in uint64_t
+    uint64_t magnitude = exp < 0 ? 0 - (uint64_t)exp : (uint64_t)exp;
+    dc_complex_frac base = exp < 0 ? dc_frac_reciprocal(c) : dc_frac_retain(c);
+
+    int bit = 63;
+    while (!((magnitude >> bit) & 1)) bit--;
+    dc_complex_frac result = dc_frac_retain(base);
+    while (bit-- > 0) {
+        dc_frac_unary_into(&result, result, dc_frac_square_to);
+        if ((magnitude >> bit) & 1) dc_frac_binary_into(&result, result, base, dc_frac_mul_to);
+    }
+    dc_frac_release(&base);
+    return result;
+}
+
+/*
+ * Reduction modulo a fixed Gaussian modulus m without division. The quotient
+ * x conj(m) / N(m) is estimated per component as trunc(t mu / 2^k) with
+ * mu = floor(2^k / N(m)); the estimate is off by at most one, so remainders
+ * stay within a small multiple of |m| and are made exact once at the end.
+ * di_int division is bit-serial, so this keeps it out of the powering loop.
+ */
+typedef struct {
+    dc_gauss m;
+    dc_gauss m_conj;
+    di_int mu;
+    size_t k;
+} dc_gauss_barrett;
+
+static void dc_gauss_barrett_init(dc_gauss_barrett* b, dc_complex_int modulus) {
+    b->m = dc_gauss_of(modulus);
+    b->m_conj.real = di_retain(b->m.real);
+    b->m_conj.imag = di_negate(b->m.imag);
+    di_int norm = dc_int_norm(modulus);
+    // Inputs are products of two reduced values, |t| < 2^(2 bits(N) + 8)
+    b->k = 2 * di_bit_length(norm) + 8;
+    di_int one = di_one();
+    di_int power = di_shift_left(one, b->k);
+    b->mu = di_div(power, norm);
+    di_release(&norm);
+    di_release(&one);
+    di_release(&power);
+}
+
+static void dc_gauss_barrett_release(dc_gauss_barrett* b) {
+    dc_gauss_release(&b->m);
+    dc_gauss_release(&b->m_conj);
+    di_release(&b->mu);
+}
+
+// trunc(t / N(m)), possibly one too small in magnitude
+static di_int dc_gauss_barrett_quotient(di_int t, const dc_gauss_barrett* b) {
+    di_int magnitude = di_abs(t);
+    di_int scaled = di_mul(magnitude, b->mu);
+    di_int q = di_shift_right(scaled, b->k);
+    if (di_is_negative(t)) {
+        di_int negated = di_negate(q);
+        di_release(&q);
+        q = negated;
+    }
+    di_release(&magnitude);
+    di_release(&scaled);
+    return q;
+}
+
+static void dc_gauss_barrett_reduce(dc_gauss* x, const dc_gauss_barrett* b) {
+    dc_gauss t = dc_gauss_mul(*x, b->m_conj);
+    dc_gauss q = {dc_gauss_barrett_quotient(t.real, b), dc_gauss_barrett_quotient(t.imag, b)};
+    dc_gauss r = dc_gauss_sub_mul(*x, q, b->m);
+    dc_gauss_release(x);
+    *x = r;
+    dc_gauss_release(&t);
+    dc_gauss_release(&q);
+}
+
+DC_DEF dc_complex_int dc_int_powmod(dc_complex_int base, di_int exp, dc_complex_int modulus) {
+    DC_ASSERT(base && "dc_int_powmod: base cannot be NULL");
+    DC_ASSERT(exp && "dc_int_powmod: exponent cannot be NULL");
+    DC_ASSERT(modulus && "dc_int_powmod: modulus cannot be NULL");
+    DC_ASSERT(!di_is_negative(exp) && "dc_int_powmod: exponent cannot be negative");
+    DC_ASSERT(!dc_int_is_zero(modulus) && "dc_int_powmod: modulus cannot be zero");
+
+    dc_gauss_barrett barrett;
+    dc_gauss_barrett_init(&barrett, modulus);
+    dc_gauss b = dc_gauss_of(base);
+    dc_gauss_barrett_reduce(&b, &barrett);
+
+    size_t len = dc_di_limb_len(exp);
+    uint32_t* bits = DC_MALLOC(len * sizeof(uint32_t));
+    DC_ASSERT(bits && "dc_int_powmod: allocation failed");
+    dc_di_to_limbs(exp, bits, len);
+
+    dc_gauss acc = dc_gauss_from_ints(1, 0);
+    for (size_t bit = 32 * len; bit-- > 0;) {
+        dc_gauss squared = dc_gauss_square(acc);
+        dc_gauss_release(&acc);
+        acc = squared;
+        dc_gauss_barrett_reduce(&acc, &barrett);
+        if ((bits[bit / 32] >> (bit % 32)) & 1) {
+            dc_gauss product = dc_gauss_mul(acc, b);
+            dc_gauss_release(&acc);
+            acc = product;
+            dc_gauss_barrett_reduce(&acc, &barrett);
+        }
+    }
+    DC_FREE(bits);
+    dc_gauss_release(&b);
+    dc_gauss_barrett_release(&barrett);
+
+    // Exact nearest remainder, as dc_int_divmod returns it
+    dc_complex_int value = dc_gauss_finish(&acc);
+    dc_complex_int quotient, remainder;
+    dc_int_divmod(value, modulus, &quotient, &remainder);
+    dc_int_release(&value);
+    dc_int_release(&quotient);
+    return remainder;
+}
+
+DC_DEF void dc_double_add_into(dc_complex_double* dst, dc_complex_double a, dc_complex_double b) {
+    DC_ASSERT(dst && "dc_double_add_into: destination cannot be NULL");
+    DC_ASSERT(a && "dc_double_add_into: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_double_add_into: second operand cannot be NULL");
+    dc_double_store(dst, dcv_double_add(a->value, b->value));
+}
+
+DC_DEF void dc_double_sub_into(dc_complex_double* dst, dc_complex_double a, dc_complex_double b) {
+    DC_ASSERT(dst && "dc_double_sub_into: destination cannot be NULL");
+    DC_ASSERT(a && "dc_double_sub_into: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_double_sub_into: second operand cannot be NULL");
+    dc_double_store(dst, dcv_double_sub(a->value, b->value));
+}
+
+DC_DEF void dc_double_mul_into(dc_complex_double* dst, dc_complex_double a, dc_complex_double b) {
+    DC_ASSERT(dst && "dc_double_mul_into: destination cannot be NULL");
+    DC_ASSERT(a && "dc_double_mul_into: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_double_mul_into: second operand cannot be NULL");
+    dc_double_store(dst, dcv_double_mul(a->value, b->value));
+}
+
+DC_DEF void dc_double_div_into(dc_complex_double* dst, dc_complex_double a, dc_complex_double b) {
+    DC_ASSERT(dst && "dc_double_div_into: destination cannot be NULL");
+    DC_ASSERT(a && "dc_double_div_into: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_double_div_into: second operand cannot be NULL");
+    dc_double_store(dst, dcv_double_div(a->value, b->value));
+}
+
+DC_DEF void dc_double_negate_into(dc_complex_double* dst, dc_complex_double c) {
+    DC_ASSERT(dst && "dc_double_negate_into: destination cannot be NULL");
+    DC_ASSERT(c && "dc_double_negate_into: operand cannot be NULL");
+    dc_double_store(dst, dcv_double_negate(c->value));
+}
+
+DC_DEF void dc_double_conj_into(dc_complex_double* dst, dc_complex_double c) {
+    DC_ASSERT(dst && "dc_double_conj_into: destination cannot be NULL");
+    DC_ASSERT(c && "dc_double_conj_into: operand cannot be NULL");
+    dc_double_store(dst, dcv_double_conj(c->value));
+}
+
+DC_DEF dc_complex_double dc_double_add_steal(dc_complex_double a, dc_complex_double b) {
+    DC_ASSERT(a && "dc_double_add_steal: first operand cannot be NULL");
+    dc_double_add_into(&a, a, b);
+    return a;
+}
+
+DC_DEF dc_complex_double dc_double_sub_steal(dc_complex_double a, dc_complex_double b) {
+    DC_ASSERT(a && "dc_double_sub_steal: first operand cannot be NULL");
+    dc_double_sub_into(&a, a, b);
+    return a;
+}
+
+DC_DEF dc_complex_double dc_double_mul_steal(dc_complex_double a, dc_complex_double b) {
+    DC_ASSERT(a && "dc_double_mul_steal: first operand cannot be NULL");
+    dc_double_mul_into(&a, a, b);
+    return a;
+}
+
+DC_DEF dc_complex_double dc_double_div_steal(dc_complex_double a, dc_complex_double b) {
+    DC_ASSERT(a && "dc_double_div_steal: first operand cannot be NULL");
+    dc_double_div_into(&a, a, b);
+    return a;
+}
+
+DC_DEF dc_complex_double dc_double_negate_steal(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_negate_steal: operand cannot be NULL");
+    dc_double_negate_into(&c, c);
+    return c;
+}
+
+DC_DEF dc_complex_double dc_double_conj_steal(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_conj_steal: operand cannot be NULL");
+    dc_double_conj_into(&c, c);
+    return c;
+}
+
+// ============================================================================
+// DOUBLE COMPLEX ARRAY IMPLEMENTATION
+// ============================================================================
+
+#if DC_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if DC_SIMD && (defined(__GNUC__) || defined(__clang__))
+#define DC_SIMD_VECTOR 1
+#else
+#define DC_SIMD_VECTOR 0
+#endif
+
+#if DC_SIMD_VECTOR && (defined(__x86_64__) || defined(__i386__))
+#define DC_SIMD_X86 1
+#else
+#define DC_SIMD_X86 0
+#endif
+
+#if DC_SIMD_VECTOR
+
+typedef double dc_v2d __attribute__((vector_size(16)));
+typedef double dc_v4d __attribute__((vector_size(32)));
+typedef double dc_v8d __attribute__((vector_size(64)));
+typedef int64_t dc_v4i __attribute__((vector_size(32)));
+
+// Kernels rely on exact products and sums, and AVX-512F implies FMA on GCC
+#if defined(__clang__)
+#define DC_NO_CONTRACT
+#else
+#define DC_NO_CONTRACT __attribute__((optimize("fp-contract=off")))
+#endif
+
+#define DC_VLOAD(v, p) __builtin_memcpy(&(v), (p), sizeof(v))
+#define DC_VSTORE(p, v) __builtin_memcpy((p), &(v), sizeof(v))
+
+#endif // DC_SIMD_VECTOR
+
+// Build a complex value from its parts without the NaN that real + imag * I gives for infinite imag
+static inline dcv_double dc_double_make(double real, double imag) {
+    dcv_double result;
+    ((double*)&result)[0] = real;
+    ((double*)&result)[1] = imag;
+    return result;
+}
+
+static size_t dc_double_array_stride(size_t length) {
+    size_t per_line = DC_DOUBLE_ARRAY_ALIGN / sizeof(double);
+    return (length + per_line - 1) / per_line * per_line;
+}
+
+// Allocate an uninitialized array with reference count 1
+static dc_double_array dc_double_array_alloc(size_t length) {
+    dc_double_array result = DC_MALLOC(sizeof(struct dc_double_array_internal));
+    DC_ASSERT(result && "dc_double_array_alloc: allocation failed");
+
+    size_t stride = dc_double_array_stride(length);
+    DC_ASSERT(stride <= (SIZE_MAX - DC_DOUBLE_ARRAY_ALIGN) / (2 * sizeof(double)) &&
+              "dc_double_array_alloc: length too large");
+
+    result->block = DC_MALLOC(2 * stride * sizeof(double) + DC_DOUBLE_ARRAY_ALIGN);
+    DC_ASSERT(result->block && "dc_double_array_alloc: allocation failed");
+
+    uintptr_t base = ((uintptr_t)result->block + DC_DOUBLE_ARRAY_ALIGN - 1) &
+                     ~(uintptr_t)(DC_DOUBLE_ARRAY_ALIGN - 1);
+    DC_ATOMIC_STORE(&result->ref_count, 1);
+    result->length = length;
+    result->real = (double*)base;
+    result->imag = result->real + stride;
+    result->mapped = 0;
+    DC_STATS_LIVE(DC_STAT_LIVE_ARRAY, 1);
+
+    return result;
+}
+
+// Free the element storage: a heap block, or the file view of dc_double_array_map()
+static void dc_double_array_free_block(dc_double_array a) {
+#if DC_MMAP
+    if (a->mapped) {
+        munmap(a->block, a->mapped);
+        return;
+    }
+#endif
+    DC_FREE(a->block);
+}
+
+// ---------------------------------------------------------------------------
+// Kernels: each vector kernel handles whole registers and returns the number
+// of elements processed; the caller finishes the tail with the scalar loop.
+// ---------------------------------------------------------------------------
+
+static void dc_array_add_scalar(double* out_re, double* out_im, const double* a_re, const double* a_im,
+                                const double* b_re, const double* b_im, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out_re[i] = a_re[i] + b_re[i];
+        out_im[i] = a_im[i] + b_im[i];
+    }
+}
+
+static void dc_array_sub_scalar(double* out_re, double* out_im, const double* a_re, const double* a_im,
+                                const double* b_re, const double* b_im, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out_re[i] = a_re[i] - b_re[i];
+        out_im[i] = a_im[i] - b_im[i];
+    }
+}
+
+static void dc_array_mul_scalar(double* out_re, double* out_im, const double* a_re, const double* a_im,
+                                const double* b_re, const double* b_im, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        dcv_double z = dcv_double_mul(dc_double_make(a_re[i], a_im[i]), dc_double_make(b_re[i], b_im[i]));
+        out_re[i] = creal(z);
+        out_im[i] = cimag(z);
+    }
+}
+
+static void dc_array_conj_scalar(double* out_re, double* out_im, const double* a_re, const double* a_im,
+                                 size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out_re[i] = a_re[i];
+        out_im[i] = -a_im[i];
+    }
+}
+
+#if DC_SIMD_X86
+
+// Pin a vector of products in its register so it is rounded before the sums, since clang has no
+// per-function fp-contract switch and would otherwise be free to fuse them
+#define DC_VROUNDED(v) __asm__("" : "+v"(v))
+
+// Instantiate the vector kernels for one instruction set and register type
+#define DC_ARRAY_DEFINE_KERNELS(isa, suffix, V)                                                                        \
+    __attribute__((target(isa))) DC_NO_CONTRACT static size_t dc_array_add_##suffix(                                   \
+        double* out_re, double* out_im, const double* a_re, const double* a_im, const double* b_re,                    \
+        const double* b_im, size_t n) {                                                                                \
+        const size_t width = sizeof(V) / sizeof(double);                                                               \
+        size_t i = 0;                                                                                                  \
+        for (; i + width <= n; i += width) {                                                                           \
+            V ar, ai, br, bi;                                                                                          \
+            DC_VLOAD(ar, a_re + i);                                                                                    \
+            DC_VLOAD(ai, a_im + i);                                                                                    \
+            DC_VLOAD(br, b_re + i);                                                                                    \
+            DC_VLOAD(bi, b_im + i);                                                                                    \
+            V re = ar + br, im = ai + bi;                                                                              \
+            DC_VSTORE(out_re + i, re);                                                                                 \
+            DC_VSTORE(out_im + i, im);                                                                                 \
+        }                                                                                                              \
+        return i;                                                                                                      \
+    }                                                                                                                  \
+                                                                                                                       \
+    __attribute__((target(isa))) DC_NO_CONTRACT static size_t dc_array_sub_##suffix(                                   \
+        double* out_re, double* out_im, const double* a_re, const double* a_im, const double* b_re,                    \
+        const double* b_im, size_t n) {                                                                                \
+        const size_t width = sizeof(V) / sizeof(double);                                                               \
+        size_t i = 0;                                                                                                  \
+        for (; i + width <= n; i += width) {                                                                           \
+            V ar, ai, br, bi;                                                                                          \
+            DC_VLOAD(ar, a_re + i);                                                                                    \
+            DC_VLOAD(ai, a_im + i);                                                                                    \
+            DC_VLOAD(br, b_re + i);                                                                                    \
+            DC_VLOAD(bi, b_im + i);                                                                                    \
+            V re = ar - br, im = ai - bi;                                                                              \
+            DC_VSTORE(out_re + i, re);                                                                                 \
+            DC_VSTORE(out_im + i, im);                                                                                 \
+        }                                                                                                              \
+        return i;                                                                                                      \
+    }                                                                                                                  \
+                                                                                                                       \
+    __attribute__((target(isa))) DC_NO_CONTRACT static size_t dc_array_mul_##suffix(                                   \
+        double* out_re, double* out_im, const double* a_re, const double* a_im, const double* b_re,                    \
+        const double* b_im, size_t n) {                                                                                \
+        const size_t width = sizeof(V) / sizeof(double);                                                               \
+        size_t i = 0;                                                                                                  \
+        for (; i + width <= n; i += width) {                                                                           \
+            V ar, ai, br, bi;                                                                                          \
+            DC_VLOAD(ar, a_re + i);                                                                                    \
+            DC_VLOAD(ai, a_im + i);                                                                                    \
+            DC_VLOAD(br, b_re + i);                                                                                    \
+            DC_VLOAD(bi, b_im + i);                                                                                    \
+            V ac = ar * br, bd = ai * bi, ad = ar * bi, bc = ai * br;                                                  \
+            DC_VROUNDED(ac);                                                                                           \
+            DC_VROUNDED(bd);                                                                                           \
+            DC_VROUNDED(ad);                                                                                           \
+            DC_VROUNDED(bc);                                                                                           \
+            V re = ac - bd, im = ad + bc;                                                                              \
+            /* NaN+NaNi lanes need C99 Annex G infinity recovery */                                                    \
+            for (size_t j = 0; j < width; j++) {                                                                       \
+                if (re[j] != re[j] && im[j] != im[j]) {                                                                \
+                    dcv_double z = dcv_double_mul(dc_double_make(ar[j], ai[j]), dc_double_make(br[j], bi[j]));         \
+                    re[j] = creal(z);                                                                                  \
+                    im[j] = cimag(z);                                                                                  \
+                }                                                                                                      \
+            }                                                                                                          \
+            DC_VSTORE(out_re + i, re);                                                                                 \
+            DC_VSTORE(out_im + i, im);                                                                                 \
+        }                                                                                                              \
+        return i;                                                                                                      \
+    }                                                                                                                  \
+                                                                                                                       \
+    __attribute__((target(isa))) DC_NO_CONTRACT static size_t dc_array_conj_##suffix(                                  \
+        double* out_re, double* out_im, const double* a_re, const double* a_im, size_t n) {                            \
+        const size_t width = sizeof(V) / sizeof(double);                                                               \
+        size_t i = 0;                                                                                                  \
+        for (; i + width <= n; i += width) {                                                                           \
+            V ar, ai;                                                                                                  \
+            DC_VLOAD(ar, a_re + i);                                                                                    \
+            DC_VLOAD(ai, a_im + i);                                                                                    \
+            V im = -ai;                                                                                                \
+            DC_VSTORE(out_re + i, ar);                                                                                 \
+            DC_VSTORE(out_im + i, im);                                                                                 \
+        }                                                                                                              \
+        return i;                                                                                                      \
+    }
+
+DC_ARRAY_DEFINE_KERNELS("sse2", sse2, dc_v2d)
+DC_ARRAY_DEFINE_KERNELS("avx2", avx2, dc_v4d)
+DC_ARRAY_DEFINE_KERNELS("avx512f", avx512, dc_v8d)
+
+#endif // DC_SIMD_X86
+
+// ---------------------------------------------------------------------------
+// Transcendental kernels. Each block of four elements is evaluated with the
+// branch-free polynomial kernels below; lanes outside a kernel's documented
+// domain (non-finite values, overflow/underflow ranges, arguments needing
+// Payne-Hanek reduction) are recomputed with the C99 function, so special
+// values follow Annex G exactly.
+// ---------------------------------------------------------------------------
+
+static void dc_array_exp_scalar(double* out_re, double* out_im, const double* a_re, const double* a_im, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        dcv_double z = dcv_double_exp(dc_double_make(a_re[i], a_im[i]));
+        out_re[i] = creal(z);
+        out_im[i] = cimag(z);
+    }
+}
+
+static void dc_array_log_scalar(double* out_re, double* out_im, const double* a_re, const double* a_im, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        dcv_double z = dcv_double_log(dc_double_make(a_re[i], a_im[i]));
+        out_re[i] = creal(z);
+        out_im[i] = cimag(z);
+    }
+}
+
+static void dc_array_sin_scalar(double* out_re, double* out_im, const double* a_re, const double* a_im, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        dcv_double z = dcv_double_sin(dc_double_make(a_re[i], a_im[i]));
+        out_re[i] = creal(z);
+        out_im[i] = cimag(z);
+    }
+}
+
+static void dc_array_cos_scalar(double* out_re, double* out_im, const double* a_re, const double* a_im, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        dcv_double z = dcv_double_cos(dc_double_make(a_re[i], a_im[i]));
+        out_re[i] = creal(z);
+        out_im[i] = cimag(z);
+    }
+}
 
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->real = di_from_int64(real);
-    result->imag = di_from_int64(imag);
+static void dc_array_sqrt_scalar(double* out_re, double* out_im, const double* a_re, const double* a_im, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        dcv_double z = dcv_double_sqrt(dc_double_make(a_re[i], a_im[i]));
+        out_re[i] = creal(z);
+        out_im[i] = cimag(z);
+    }
+}
 
-    return result;
+#if DC_SIMD_VECTOR
+
+// Vector helpers take pointers so no vector type crosses a function ABI boundary
+#define DC_VBITS(v) ((dc_v4i)(v))
+#define DC_VDBL(v) ((dc_v4d)(v))
+#define DC_VSEL(mask, a, b) DC_VDBL((DC_VBITS(a) & (mask)) | (DC_VBITS(b) & ~(mask)))
+#define DC_VABS(v) DC_VDBL(DC_VBITS(v) & INT64_MAX)
+#define DC_VSIGN(v) (DC_VBITS(v) & INT64_MIN)
+#define DC_VCMP(a, op, b) ((dc_v4i)((a) op (b)))
+
+// Round to nearest integer-valued double (|x| < 2^51)
+#define DC_VROUND_MAGIC 0x1.8p52
+
+// Correctly rounded square root of each lane
+#if defined(__clang__) && defined(__has_builtin)
+#if __has_builtin(__builtin_elementwise_sqrt)
+#define DC_VSQRT(dst, src) ((dst) = __builtin_elementwise_sqrt(src))
+#endif
+#elif !defined(__clang__) && defined(__SSE2__)
+#define DC_VSQRT(dst, src)                                                                   \
+    do {                                                                                     \
+        dc_v2d dc_vsqrt_lo = {(src)[0], (src)[1]}, dc_vsqrt_hi = {(src)[2], (src)[3]};       \
+        dc_vsqrt_lo = __builtin_ia32_sqrtpd(dc_vsqrt_lo);                                    \
+        dc_vsqrt_hi = __builtin_ia32_sqrtpd(dc_vsqrt_hi);                                    \
+        (dst) = (dc_v4d){dc_vsqrt_lo[0], dc_vsqrt_lo[1], dc_vsqrt_hi[0], dc_vsqrt_hi[1]};    \
+    } while (0)
+#endif
+#ifndef DC_VSQRT
+#define DC_VSQRT(dst, src)                                                                   \
+    for (int dc_vsqrt_lane = 0; dc_vsqrt_lane < 4; dc_vsqrt_lane++) {                        \
+        (dst)[dc_vsqrt_lane] = sqrt((src)[dc_vsqrt_lane]);                                   \
+    }
+#endif
+
+// exp(x) for |x| <= 708: Cody-Waite reduction by ln 2, degree-13 Taylor kernel (<= 1.5 ulp)
+DC_INLINE void dc_vm_exp(dc_v4d* result, const dc_v4d* x) {
+    const double ln2_hi = 6.93147180369123816490e-01;
+    const double ln2_lo = 1.90821492927058770002e-10;
+
+    dc_v4d t = *x * 1.44269504088896338700e+00 + DC_VROUND_MAGIC;
+    dc_v4d n = t - DC_VROUND_MAGIC;
+    dc_v4d r = (*x - n * ln2_hi) - n * ln2_lo;
+
+    dc_v4d p = (dc_v4d){0} + 1.0 / 6227020800.0;
+    p = p * r + 1.0 / 479001600.0;
+    p = p * r + 1.0 / 39916800.0;
+    p = p * r + 1.0 / 3628800.0;
+    p = p * r + 1.0 / 362880.0;
+    p = p * r + 1.0 / 40320.0;
+    p = p * r + 1.0 / 5040.0;
+    p = p * r + 1.0 / 720.0;
+    p = p * r + 1.0 / 120.0;
+    p = p * r + 1.0 / 24.0;
+    p = p * r + 1.0 / 6.0;
+    p = p * r + 0.5;
+    p = r + (r * r) * p;
+
+    // The low bits of t hold n; build 2^n directly in the exponent field
+    dc_v4i k = DC_VBITS(t) - DC_VBITS((dc_v4d){0} + DC_VROUND_MAGIC);
+    dc_v4d scale = DC_VDBL((k + 1023) << 52);
+    *result = (1.0 + p) * scale;
 }
 
-DC_DEF dc_complex_int dc_int_from_di(di_int real, di_int imag) {
-    DC_ASSERT(real && "dc_int_from_di: real part cannot be NULL");
-    DC_ASSERT(imag && "dc_int_from_di: imaginary part cannot be NULL");
+// log(x) for positive normal finite x: fdlibm reduction to [sqrt(2)/2, sqrt(2)) (< 1 ulp)
+DC_INLINE void dc_vm_log(dc_v4d* result, const dc_v4d* x) {
+    const double ln2_hi = 6.93147180369123816490e-01;
+    const double ln2_lo = 1.90821492927058770002e-10;
+
+    dc_v4i bits = DC_VBITS(*x);
+    dc_v4i e = (bits >> 52) - 1023;
+    dc_v4d m = DC_VDBL((bits & 0x000fffffffffffffLL) | 0x3ff0000000000000LL);
+    dc_v4i big = DC_VCMP(m, >, 1.41421356237309504880);
+    m = DC_VSEL(big, m * 0.5, m);
+    e = e - big;
+    dc_v4d k = __builtin_convertvector(e, dc_v4d);
+
+    dc_v4d f = m - 1.0;
+    dc_v4d s = f / (2.0 + f);
+    dc_v4d z = s * s;
+    dc_v4d w = z * z;
+    dc_v4d t1 = w * (3.999999999940941908e-01 + w * (2.222219843214978396e-01 + w * 1.531383769920937332e-01));
+    dc_v4d t2 = z * (6.666666666666735130e-01 +
+                     w * (2.857142874366239149e-01 + w * (1.818357216161805012e-01 + w * 1.479819860511658591e-01)));
+    dc_v4d rr = t2 + t1;
+    dc_v4d hfsq = 0.5 * f * f;
+    *result = k * ln2_hi - ((hfsq - (s * (hfsq + rr) + k * ln2_lo)) - f);
+}
 
-    dc_complex_int result = DC_MALLOC(sizeof(struct dc_complex_int_internal));
-    DC_ASSERT(result && "dc_int_from_di: allocation failed");
+// log1p(d) for d in [-0.5, 1] via log(1 + d) * d / ((1 + d) - 1) (<= 2 ulp)
+DC_INLINE void dc_vm_log1p(dc_v4d* result, const dc_v4d* d) {
+    dc_v4d u = 1.0 + *d;
+    dc_v4d log_u;
+    dc_vm_log(&log_u, &u);
+    dc_v4d v = u - 1.0;
+    dc_v4i exact = DC_VCMP(v, ==, 0.0);
+    dc_v4d safe_v = DC_VSEL(exact, *d, v);
+    *result = DC_VSEL(exact, *d, log_u * (*d / safe_v));
+}
 
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->real = di_retain(real);
-    result->imag = di_retain(imag);
+// sin(x) and cos(x) for |x| <= 2^20: three-part Cody-Waite reduction by pi/2 kept as a
+// double-double, fdlibm kernels on [-pi/4, pi/4] (<= 1 ulp)
+DC_INLINE void dc_vm_sincos(dc_v4d* sin_result, dc_v4d* cos_result, const dc_v4d* x) {
+    const double pio2_1 = 1.57079632673412561417e+00;
+    const double pio2_2 = 6.07710050630396597660e-11;
+    const double pio2_3 = 2.02226624871116645580e-21;
+    const double pio2_3t = 8.47842766036889956997e-32;
+
+    dc_v4d t = *x * 6.36619772367581382433e-01 + DC_VROUND_MAGIC;
+    dc_v4d n = t - DC_VROUND_MAGIC;
+    dc_v4i q = DC_VBITS(t) - DC_VBITS((dc_v4d){0} + DC_VROUND_MAGIC);
+
+    // Each n * pio2_k is exact for |n| < 2^20, and r1 is exact by Sterbenz
+    dc_v4d r1 = *x - n * pio2_1;
+    dc_v4d w2 = n * pio2_2;
+    dc_v4d r2 = r1 - w2;
+    dc_v4d bb = r2 - r1;
+    dc_v4d e2 = (r1 - (r2 - bb)) - (w2 + bb);
+    dc_v4d lo = (e2 - n * pio2_3) - n * pio2_3t;
+    dc_v4d hi = r2 + lo;
+    lo = (r2 - hi) + lo;
+
+    dc_v4d z = hi * hi;
+    dc_v4d v = z * hi;
+    dc_v4d sr = 8.33333333332248946124e-03 +
+                z * (-1.98412698298579493134e-04 +
+                     z * (2.75573137070700676789e-06 + z * (-2.50507602534068634195e-08 + z * 1.58969099521155010221e-10)));
+    dc_v4d s = hi - ((z * (0.5 * lo - v * sr) - lo) - v * -1.66666666666666324348e-01);
+
+    dc_v4d w = z * z;
+    dc_v4d cr = z * (4.16666666666666019037e-02 + z * (-1.38888888888741095749e-03 + z * 2.48015872894767294178e-05)) +
+                w * w * (-2.75573143513906633035e-07 + z * (2.08757232129817482790e-09 + z * -1.13596475577881948265e-11));
+    dc_v4d hz = 0.5 * z;
+    dc_v4d one_hz = 1.0 - hz;
+    dc_v4d c = one_hz + (((1.0 - one_hz) - hz) + (z * cr - hi * lo));
+
+    // Quadrant q: sin = [s, c, -s, -c], cos = [c, -s, -c, s]
+    dc_v4i odd = -(q & 1);
+    dc_v4d sin_v = DC_VSEL(odd, c, s);
+    dc_v4d cos_v = DC_VSEL(odd, s, c);
+    *sin_result = DC_VDBL(DC_VBITS(sin_v) ^ (-((q >> 1) & 1) & INT64_MIN));
+    *cos_result = DC_VDBL(DC_VBITS(cos_v) ^ (-(((q + 1) >> 1) & 1) & INT64_MIN));
+}
 
-    return result;
+// sinh(y) and cosh(y) for |y| <= 708: Taylor series below 1, exponentials above (<= 2.5 ulp)
+DC_INLINE void dc_vm_sinhcosh(dc_v4d* sinh_result, dc_v4d* cosh_result, const dc_v4d* y) {
+    dc_v4d ay = DC_VABS(*y);
+    dc_v4d e;
+    dc_vm_exp(&e, &ay);
+    dc_v4d half_e = 0.5 * e;
+    dc_v4d half_inv = 0.5 / e;
+    *cosh_result = half_e + half_inv;
+
+    dc_v4d z = ay * ay;
+    dc_v4d p = (dc_v4d){0} + 1.0 / 121645100408832000.0;
+    p = p * z + 1.0 / 355687428096000.0;
+    p = p * z + 1.0 / 1307674368000.0;
+    p = p * z + 1.0 / 6227020800.0;
+    p = p * z + 1.0 / 39916800.0;
+    p = p * z + 1.0 / 362880.0;
+    p = p * z + 1.0 / 5040.0;
+    p = p * z + 1.0 / 120.0;
+    p = p * z + 1.0 / 6.0;
+    dc_v4d small = ay + ay * (z * p);
+
+    dc_v4d sh = DC_VSEL(DC_VCMP(ay, <, 1.0), small, half_e - half_inv);
+    *sinh_result = DC_VDBL(DC_VBITS(sh) | DC_VSIGN(*y));
 }
 
-DC_DEF dc_complex_int dc_int_zero(void) {
-    if (!dc_int_zero_singleton) {
-        dc_int_zero_singleton = dc_int_from_ints(0, 0);
-        DC_ATOMIC_STORE(&dc_int_zero_singleton->ref_count, SIZE_MAX/2);
+// atan2(y, x) for finite arguments not both zero: fdlibm atan on [0, 1] (<= 2 ulp)
+DC_INLINE void dc_vm_atan2(dc_v4d* result, const dc_v4d* y, const dc_v4d* x) {
+    const double pi_hi = 3.1415926535897931160e+00;
+    const double pi_lo = 1.2246467991473531772e-16;
+    const double pio2_hi = 1.5707963267948965580e+00;
+    const double pio2_lo = 6.1232339957367658860e-17;
+
+    dc_v4d ax = DC_VABS(*x);
+    dc_v4d ay = DC_VABS(*y);
+    dc_v4i swap = DC_VCMP(ay, >, ax);
+    dc_v4d a = DC_VSEL(swap, ax, ay) / DC_VSEL(swap, ay, ax);
+
+    dc_v4i mid = DC_VCMP(a, >=, 0.4375);
+    dc_v4i high = DC_VCMP(a, >=, 0.6875);
+    dc_v4d t = DC_VSEL(high, (a - 1.0) / (a + 1.0), DC_VSEL(mid, (2.0 * a - 1.0) / (2.0 + a), a));
+    dc_v4d base_hi = DC_VSEL(high, (dc_v4d){0} + 7.85398163397448278999e-01,
+                             DC_VSEL(mid, (dc_v4d){0} + 4.63647609000806093515e-01, (dc_v4d){0}));
+    dc_v4d base_lo = DC_VSEL(high, (dc_v4d){0} + 3.06161699786838301793e-17,
+                             DC_VSEL(mid, (dc_v4d){0} + 2.26987774529616870924e-17, (dc_v4d){0}));
+
+    dc_v4d z = t * t;
+    dc_v4d w = z * z;
+    dc_v4d s1 = z * (3.33333333333329318027e-01 +
+                     w * (1.42857142725034663711e-01 +
+                          w * (9.09088713343650656196e-02 +
+                               w * (6.66107313738753120669e-02 +
+                                    w * (4.97687799461593236017e-02 + w * 1.62858201153657823623e-02)))));
+    dc_v4d s2 = w * (-1.99999999998764832476e-01 +
+                     w * (-1.11111104054623557880e-01 +
+                          w * (-7.69187620504482999495e-02 +
+                               w * (-5.83357013379057348645e-02 + w * -3.65315727442169155270e-02))));
+    dc_v4i reduced = mid | high;
+    dc_v4d theta = DC_VSEL(reduced, base_hi - ((t * (s1 + s2) - base_lo) - t), t - t * (s1 + s2));
+
+    theta = DC_VSEL(swap, (pio2_hi - theta) + pio2_lo, theta);
+    theta = DC_VSEL(DC_VCMP(*x, <, 0.0), (pi_hi - theta) + pi_lo, theta);
+    *result = DC_VDBL(DC_VBITS(theta) | DC_VSIGN(*y));
+}
+
+// Recompute lanes outside the vector domain with the C99 function
+#define DC_VM_FIXUP(fn, ok, re, im, xr, xi)                                                \
+    if (((ok)[0] & (ok)[1] & (ok)[2] & (ok)[3]) != -1) {                                   \
+        for (int lane = 0; lane < 4; lane++) {                                             \
+            if (!(ok)[lane]) {                                                             \
+                dcv_double fixed = fn(dc_double_make((xr)[lane], (xi)[lane]));             \
+                (re)[lane] = creal(fixed);                                                 \
+                (im)[lane] = cimag(fixed);                                                 \
+            }                                                                              \
+        }                                                                                  \
     }
-    return dc_int_retain(dc_int_zero_singleton);
+
+// exp(x + iy) = e^x (cos y + i sin y)
+DC_INLINE void dc_vm_exp_block(double* out_re, double* out_im, const double* a_re, const double* a_im) {
+    dc_v4d x, y, ex, s, c;
+    DC_VLOAD(x, a_re);
+    DC_VLOAD(y, a_im);
+    dc_v4i ok = DC_VCMP(DC_VABS(x), <=, 708.0) & DC_VCMP(DC_VABS(y), <=, 0x1p20);
+
+    dc_v4d xs = DC_VSEL(ok, x, (dc_v4d){0});
+    dc_v4d ys = DC_VSEL(ok, y, (dc_v4d){0});
+    dc_vm_exp(&ex, &xs);
+    dc_vm_sincos(&s, &c, &ys);
+    dc_v4d re = ex * c;
+    dc_v4d im = ex * s;
+
+    DC_VM_FIXUP(dcv_double_exp, ok, re, im, x, y);
+    DC_VSTORE(out_re, re);
+    DC_VSTORE(out_im, im);
 }
 
-DC_DEF dc_complex_int dc_int_one(void) {
-    if (!dc_int_one_singleton) {
-        dc_int_one_singleton = dc_int_from_ints(1, 0);
-        DC_ATOMIC_STORE(&dc_int_one_singleton->ref_count, SIZE_MAX/2);
+// log(z) = log|z| + i atan2(y, x), with log|z| = log1p(x^2 + y^2 - 1) / 2 near the unit
+// circle (exact products and sums) and log(max) + log1p((min/max)^2) / 2 elsewhere
+DC_INLINE void dc_vm_log_block(double* out_re, double* out_im, const double* a_re, const double* a_im) {
+    const double split = 134217729.0; // 2^27 + 1
+
+    dc_v4d x, y;
+    DC_VLOAD(x, a_re);
+    DC_VLOAD(y, a_im);
+    dc_v4d ax = DC_VABS(x);
+    dc_v4d ay = DC_VABS(y);
+    dc_v4d mx = DC_VSEL(DC_VCMP(ax, >=, ay), ax, ay);
+    dc_v4d mn = DC_VSEL(DC_VCMP(ax, >=, ay), ay, ax);
+    dc_v4i ok = DC_VCMP(mx, >=, 0x1p-1022) & DC_VCMP(mx, <=, 0x1.fffffffffffffp1023);
+    mx = DC_VSEL(ok, mx, (dc_v4d){0} + 1.0);
+    mn = DC_VSEL(ok, mn, (dc_v4d){0});
+
+    // Dekker products: mx^2 = px + ex, mn^2 = py + ey exactly
+    dc_v4d px = mx * mx;
+    dc_v4d py = mn * mn;
+    dc_v4d cx = split * mx;
+    dc_v4d xh = cx - (cx - mx);
+    dc_v4d xl = mx - xh;
+    dc_v4d ex = ((xh * xh - px) + 2.0 * xh * xl) + xl * xl;
+    dc_v4d cy = split * mn;
+    dc_v4d yh = cy - (cy - mn);
+    dc_v4d yl = mn - yh;
+    dc_v4d ey = ((yh * yh - py) + 2.0 * yh * yl) + yl * yl;
+
+    // d = px + py - 1 with two exact TwoSums
+    dc_v4d s1 = px - 1.0;
+    dc_v4d b1 = s1 - px;
+    dc_v4d e1 = (px - (s1 - b1)) - (1.0 + b1);
+    dc_v4d s2 = s1 + py;
+    dc_v4d b2 = s2 - s1;
+    dc_v4d e2 = (s1 - (s2 - b2)) + (py - b2);
+    dc_v4d d = s2 + (((e1 + e2) + ex) + ey);
+
+    dc_v4d near = px + py;
+    dc_v4i circle = DC_VCMP(near, >=, 0.5) & DC_VCMP(near, <=, 2.0);
+    // Too close to |z| = 1 for the error terms to be resolved
+    ok &= ~(circle & DC_VCMP(DC_VABS(d), <, 0x1p-30));
+
+    dc_v4d ratio = mn / mx;
+    dc_v4d r2 = ratio * ratio;
+    dc_v4d arg = DC_VSEL(circle, d, r2);
+    dc_v4d l1p, lmx;
+    dc_vm_log1p(&l1p, &arg);
+    dc_vm_log(&lmx, &mx);
+    dc_v4d re = DC_VSEL(circle, 0.5 * l1p, lmx + 0.5 * l1p);
+
+    dc_v4d xs = DC_VSEL(ok, x, (dc_v4d){0} + 1.0);
+    dc_v4d ys = DC_VSEL(ok, y, (dc_v4d){0});
+    dc_v4d im;
+    dc_vm_atan2(&im, &ys, &xs);
+
+    DC_VM_FIXUP(dcv_double_log, ok, re, im, x, y);
+    DC_VSTORE(out_re, re);
+    DC_VSTORE(out_im, im);
+}
+
+// sin(x + iy) = sin x cosh y + i cos x sinh y
+DC_INLINE void dc_vm_sin_block(double* out_re, double* out_im, const double* a_re, const double* a_im) {
+    dc_v4d x, y, s, c, sh, ch;
+    DC_VLOAD(x, a_re);
+    DC_VLOAD(y, a_im);
+    dc_v4i ok = DC_VCMP(DC_VABS(x), <=, 0x1p20) & DC_VCMP(DC_VABS(y), <=, 708.0);
+
+    dc_v4d xs = DC_VSEL(ok, x, (dc_v4d){0});
+    dc_v4d ys = DC_VSEL(ok, y, (dc_v4d){0});
+    dc_vm_sincos(&s, &c, &xs);
+    dc_vm_sinhcosh(&sh, &ch, &ys);
+    dc_v4d re = s * ch;
+    dc_v4d im = c * sh;
+
+    DC_VM_FIXUP(dcv_double_sin, ok, re, im, x, y);
+    DC_VSTORE(out_re, re);
+    DC_VSTORE(out_im, im);
+}
+
+// cos(x + iy) = cos x cosh y - i sin x sinh y
+DC_INLINE void dc_vm_cos_block(double* out_re, double* out_im, const double* a_re, const double* a_im) {
+    dc_v4d x, y, s, c, sh, ch;
+    DC_VLOAD(x, a_re);
+    DC_VLOAD(y, a_im);
+    dc_v4i ok = DC_VCMP(DC_VABS(x), <=, 0x1p20) & DC_VCMP(DC_VABS(y), <=, 708.0);
+
+    dc_v4d xs = DC_VSEL(ok, x, (dc_v4d){0});
+    dc_v4d ys = DC_VSEL(ok, y, (dc_v4d){0});
+    dc_vm_sincos(&s, &c, &xs);
+    dc_vm_sinhcosh(&sh, &ch, &ys);
+    dc_v4d re = c * ch;
+    dc_v4d im = -(s * sh);
+
+    DC_VM_FIXUP(dcv_double_cos, ok, re, im, x, y);
+    DC_VSTORE(out_re, re);
+    DC_VSTORE(out_im, im);
+}
+
+// Kahan's csqrt: t = sqrt((|x| + |z|) / 2), then the other part is |y| / (2t)
+DC_INLINE void dc_vm_sqrt_block(double* out_re, double* out_im, const double* a_re, const double* a_im) {
+    dc_v4d x, y;
+    DC_VLOAD(x, a_re);
+    DC_VLOAD(y, a_im);
+    dc_v4d ax = DC_VABS(x);
+    dc_v4d ay = DC_VABS(y);
+    dc_v4d mx = DC_VSEL(DC_VCMP(ax, >=, ay), ax, ay);
+    dc_v4i ok = DC_VCMP(mx, >=, 0x1p-510) & DC_VCMP(mx, <=, 0x1p510);
+
+    dc_v4d xs = DC_VSEL(ok, ax, (dc_v4d){0} + 1.0);
+    dc_v4d ys = DC_VSEL(ok, ay, (dc_v4d){0});
+    dc_v4d sum = xs * xs + ys * ys;
+    dc_v4d r, t;
+    DC_VSQRT(r, sum);
+    dc_v4d h = 0.5 * (xs + r);
+    DC_VSQRT(t, h);
+    dc_v4d other = ys / (2.0 * t);
+
+    dc_v4i neg = DC_VCMP(x, <, 0.0);
+    dc_v4d re = DC_VSEL(neg, other, t);
+    dc_v4d im = DC_VSEL(neg, t, other);
+    im = DC_VDBL(DC_VBITS(im) | DC_VSIGN(y));
+
+    DC_VM_FIXUP(dcv_double_sqrt, ok, re, im, x, y);
+    DC_VSTORE(out_re, re);
+    DC_VSTORE(out_im, im);
+}
+
+// Instantiate the block loop for one target; returns the number of elements done
+#define DC_VM_DEFINE_LOOP(op, suffix, target_attr)                                                                \
+    target_attr DC_NO_CONTRACT static size_t dc_array_##op##_##suffix(double* out_re, double* out_im,             \
+                                                                      const double* a_re, const double* a_im,     \
+                                                                      size_t n) {                                 \
+        size_t i = 0;                                                                                             \
+        for (; i + 4 <= n; i += 4) {                                                                              \
+            dc_vm_##op##_block(out_re + i, out_im + i, a_re + i, a_im + i);                                       \
+        }                                                                                                         \
+        return i;                                                                                                 \
     }
-    return dc_int_retain(dc_int_one_singleton);
+
+#define DC_VM_NO_TARGET
+
+DC_VM_DEFINE_LOOP(exp, vec, DC_VM_NO_TARGET)
+DC_VM_DEFINE_LOOP(log, vec, DC_VM_NO_TARGET)
+DC_VM_DEFINE_LOOP(sin, vec, DC_VM_NO_TARGET)
+DC_VM_DEFINE_LOOP(cos, vec, DC_VM_NO_TARGET)
+DC_VM_DEFINE_LOOP(sqrt, vec, DC_VM_NO_TARGET)
+
+#if DC_SIMD_X86
+DC_VM_DEFINE_LOOP(exp, avx2, __attribute__((target("avx2"))))
+DC_VM_DEFINE_LOOP(log, avx2, __attribute__((target("avx2"))))
+DC_VM_DEFINE_LOOP(sin, avx2, __attribute__((target("avx2"))))
+DC_VM_DEFINE_LOOP(cos, avx2, __attribute__((target("avx2"))))
+DC_VM_DEFINE_LOOP(sqrt, avx2, __attribute__((target("avx2"))))
+#endif
+
+#endif // DC_SIMD_VECTOR
+
+typedef enum { DC_SIMD_SCALAR, DC_SIMD_SSE2, DC_SIMD_AVX2, DC_SIMD_AVX512 } dc_simd_isa;
+
+static dc_simd_isa dc_simd_detect(void) {
+#if DC_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return DC_SIMD_AVX512;
+    if (__builtin_cpu_supports("avx2")) return DC_SIMD_AVX2;
+    if (__builtin_cpu_supports("sse2")) return DC_SIMD_SSE2;
+#endif
+    return DC_SIMD_SCALAR;
 }
 
-DC_DEF dc_complex_int dc_int_i(void) {
-    if (!dc_int_i_singleton) {
-        dc_int_i_singleton = dc_int_from_ints(0, 1);
-        DC_ATOMIC_STORE(&dc_int_i_singleton->ref_count, SIZE_MAX/2);
+// Run the widest supported vector kernel; evaluates to the number of elements done
+#if DC_SIMD_X86
+#define DC_ARRAY_VECTOR(isa, op, ...)                                  \
+    ((isa) == DC_SIMD_AVX512 ? dc_array_##op##_avx512(__VA_ARGS__)     \
+     : (isa) == DC_SIMD_AVX2 ? dc_array_##op##_avx2(__VA_ARGS__)       \
+     : (isa) == DC_SIMD_SSE2 ? dc_array_##op##_sse2(__VA_ARGS__)       \
+                             : (size_t)0)
+#else
+#define DC_ARRAY_VECTOR(isa, op, ...) ((void)(isa), (size_t)0)
+#endif
+
+// Transcendental kernels share one 4-lane implementation: AVX2 encoding when available
+#if DC_SIMD_X86
+#define DC_ARRAY_VMATH(isa, op, ...) \
+    ((isa) >= DC_SIMD_AVX2 ? dc_array_##op##_avx2(__VA_ARGS__) : dc_array_##op##_vec(__VA_ARGS__))
+#elif DC_SIMD_VECTOR
+#define DC_ARRAY_VMATH(isa, op, ...) ((void)(isa), dc_array_##op##_vec(__VA_ARGS__))
+#else
+#define DC_ARRAY_VMATH(isa, op, ...) ((void)(isa), (size_t)0)
+#endif
+
+typedef enum { DC_ARRAY_EXP, DC_ARRAY_LOG, DC_ARRAY_SIN, DC_ARRAY_COS, DC_ARRAY_SQRT } dc_array_fn;
+
+static void dc_array_unary(dc_double_array dst, dc_double_array a, dc_array_fn fn) {
+    double* out_re = dst->real;
+    double* out_im = dst->imag;
+    const double* a_re = a->real;
+    const double* a_im = a->imag;
+    size_t n = dst->length;
+    dc_simd_isa isa = dc_simd_detect();
+    size_t i = 0;
+
+    switch (fn) {
+        case DC_ARRAY_EXP:
+            i = DC_ARRAY_VMATH(isa, exp, out_re, out_im, a_re, a_im, n);
+            dc_array_exp_scalar(out_re + i, out_im + i, a_re + i, a_im + i, n - i);
+            break;
+        case DC_ARRAY_LOG:
+            i = DC_ARRAY_VMATH(isa, log, out_re, out_im, a_re, a_im, n);
+            dc_array_log_scalar(out_re + i, out_im + i, a_re + i, a_im + i, n - i);
+            break;
+        case DC_ARRAY_SIN:
+            i = DC_ARRAY_VMATH(isa, sin, out_re, out_im, a_re, a_im, n);
+            dc_array_sin_scalar(out_re + i, out_im + i, a_re + i, a_im + i, n - i);
+            break;
+        case DC_ARRAY_COS:
+            i = DC_ARRAY_VMATH(isa, cos, out_re, out_im, a_re, a_im, n);
+            dc_array_cos_scalar(out_re + i, out_im + i, a_re + i, a_im + i, n - i);
+            break;
+        case DC_ARRAY_SQRT:
+            i = DC_ARRAY_VMATH(isa, sqrt, out_re, out_im, a_re, a_im, n);
+            dc_array_sqrt_scalar(out_re + i, out_im + i, a_re + i, a_im + i, n - i);
+            break;
     }
-    return dc_int_retain(dc_int_i_singleton);
 }
 
-DC_DEF dc_complex_int dc_int_neg_one(void) {
-    if (!dc_int_neg_one_singleton) {
-        dc_int_neg_one_singleton = dc_int_from_ints(-1, 0);
-        DC_ATOMIC_STORE(&dc_int_neg_one_singleton->ref_count, SIZE_MAX/2);
+typedef enum { DC_ARRAY_ADD, DC_ARRAY_SUB, DC_ARRAY_MUL, DC_ARRAY_DIV } dc_array_op;
+
+static void dc_array_binary(dc_double_array dst, dc_double_array a, dc_double_array b, dc_array_op op) {
+    double* out_re = dst->real;
+    double* out_im = dst->imag;
+    const double* a_re = a->real;
+    const double* a_im = a->imag;
+    const double* b_re = b->real;
+    const double* b_im = b->imag;
+    size_t n = dst->length;
+    dc_simd_isa isa = dc_simd_detect();
+    size_t i = 0;
+
+    switch (op) {
+        case DC_ARRAY_ADD:
+            i = DC_ARRAY_VECTOR(isa, add, out_re, out_im, a_re, a_im, b_re, b_im, n);
+            dc_array_add_scalar(out_re + i, out_im + i, a_re + i, a_im + i, b_re + i, b_im + i, n - i);
+            break;
+        case DC_ARRAY_SUB:
+            i = DC_ARRAY_VECTOR(isa, sub, out_re, out_im, a_re, a_im, b_re, b_im, n);
+            dc_array_sub_scalar(out_re + i, out_im + i, a_re + i, a_im + i, b_re + i, b_im + i, n - i);
+            break;
+        case DC_ARRAY_MUL:
+            i = DC_ARRAY_VECTOR(isa, mul, out_re, out_im, a_re, a_im, b_re, b_im, n);
+            dc_array_mul_scalar(out_re + i, out_im + i, a_re + i, a_im + i, b_re + i, b_im + i, n - i);
+            break;
+        case DC_ARRAY_DIV:
+            // libgcc and compiler-rt divide with different scaling, so match the scalar path exactly
+            for (; i < n; i++) {
+                dcv_double z = dcv_double_div(dc_double_make(a_re[i], a_im[i]), dc_double_make(b_re[i], b_im[i]));
+                out_re[i] = creal(z);
+                out_im[i] = cimag(z);
+            }
+            break;
     }
-    return dc_int_retain(dc_int_neg_one_singleton);
 }
 
-DC_DEF dc_complex_int dc_int_neg_i(void) {
-    if (!dc_int_neg_i_singleton) {
-        dc_int_neg_i_singleton = dc_int_from_ints(0, -1);
-        DC_ATOMIC_STORE(&dc_int_neg_i_singleton->ref_count, SIZE_MAX/2);
+DC_DEF const char* dc_double_array_simd_level(void) {
+    switch (dc_simd_detect()) {
+        case DC_SIMD_AVX512: return "avx512f";
+        case DC_SIMD_AVX2: return "avx2";
+        case DC_SIMD_SSE2: return "sse2";
+        default: return DC_SIMD_VECTOR ? "vector" : "scalar";
     }
-    return dc_int_retain(dc_int_neg_i_singleton);
 }
 
-DC_DEF dc_complex_int dc_int_retain(dc_complex_int c) {
-    DC_ASSERT(c && "dc_int_retain: cannot retain NULL");
-    DC_ATOMIC_FETCH_ADD(&c->ref_count, 1);
-    return c;
+DC_DEF dc_double_array dc_double_array_new(size_t length) {
+    dc_double_array result = dc_double_array_alloc(length);
+    memset(result->real, 0, length * sizeof(double));
+    memset(result->imag, 0, length * sizeof(double));
+
+    return result;
 }
 
-DC_DEF void dc_int_release(dc_complex_int* c) {
-    if (!c || !*c) return;
+DC_DEF dc_double_array dc_double_array_from_values(const double complex* values, size_t length) {
+    DC_ASSERT((values || length == 0) && "dc_double_array_from_values: values cannot be NULL");
 
-    size_t old_count = DC_ATOMIC_FETCH_SUB(&(*c)->ref_count, 1);
-    if (old_count == 1) {
-        // Don't free singletons
-        if (*c == dc_int_zero_singleton || *c == dc_int_one_singleton ||
-            *c == dc_int_i_singleton || *c == dc_int_neg_one_singleton ||
-            *c == dc_int_neg_i_singleton) {
-            *c = NULL;
-            return;
-        }
+    dc_double_array result = dc_double_array_alloc(length);
+    for (size_t i = 0; i < length; i++) {
+        result->real[i] = creal(values[i]);
+        result->imag[i] = cimag(values[i]);
+    }
+
+    return result;
+}
+
+DC_DEF dc_double_array dc_double_array_from_parts(const double* real, const double* imag, size_t length) {
+    DC_ASSERT((real || length == 0) && "dc_double_array_from_parts: real parts cannot be NULL");
+    DC_ASSERT((imag || length == 0) && "dc_double_array_from_parts: imaginary parts cannot be NULL");
 
-        di_release(&(*c)->real);
-        di_release(&(*c)->imag);
-        DC_FREE(*c);
+    dc_double_array result = dc_double_array_alloc(length);
+    if (length > 0) {
+        memcpy(result->real, real, length * sizeof(double));
+        memcpy(result->imag, imag, length * sizeof(double));
     }
-    *c = NULL;
+
+    return result;
 }
 
-DC_DEF dc_complex_int dc_int_copy(dc_complex_int c) {
-    DC_ASSERT(c && "dc_int_copy: cannot copy NULL");
-    return dc_int_from_di(c->real, c->imag);
+DC_DEF dc_double_array dc_double_array_retain(dc_double_array a) {
+    DC_ASSERT(a && "dc_double_array_retain: cannot retain NULL");
+    DC_ATOMIC_FETCH_ADD(&a->ref_count, 1);
+    return a;
 }
 
-DC_DEF dc_complex_int dc_int_add(dc_complex_int a, dc_complex_int b) {
-    DC_ASSERT(a && "dc_int_add: first operand cannot be NULL");
-    DC_ASSERT(b && "dc_int_add: second operand cannot be NULL");
+DC_DEF void dc_double_array_release(dc_double_array* a) {
+    if (!a || !*a) return;
 
-    di_int real = di_add(a->real, b->real);
-    di_int imag = di_add(a->imag, b->imag);
-    dc_complex_int result = dc_int_from_di(real, imag);
-    di_release(&real);
-    di_release(&imag);
+    size_t old_count = DC_ATOMIC_FETCH_SUB(&(*a)->ref_count, 1);
+    if (old_count == 1) {
+        dc_double_array_free_block(*a);
+        DC_FREE(*a);
+        DC_STATS_LIVE(DC_STAT_LIVE_ARRAY, -1);
+    }
+    *a = NULL;
+}
 
-    return result;
+DC_DEF dc_double_array dc_double_array_copy(dc_double_array a) {
+    DC_ASSERT(a && "dc_double_array_copy: cannot copy NULL");
+    return dc_double_array_from_parts(a->real, a->imag, a->length);
 }
 
-DC_DEF dc_complex_int dc_int_sub(dc_complex_int a, dc_complex_int b) {
-    DC_ASSERT(a && "dc_int_sub: first operand cannot be NULL");
-    DC_ASSERT(b && "dc_int_sub: second operand cannot be NULL");
+DC_DEF size_t dc_double_array_length(dc_double_array a) {
+    DC_ASSERT(a && "dc_double_array_length: operand cannot be NULL");
+    return a->length;
+}
 
-    di_int real = di_sub(a->real, b->real);
-    di_int imag = di_sub(a->imag, b->imag);
-    dc_complex_int result = dc_int_from_di(real, imag);
-    di_release(&real);
-    di_release(&imag);
+DC_DEF double* dc_double_array_real(dc_double_array a) {
+    DC_ASSERT(a && "dc_double_array_real: operand cannot be NULL");
+    return a->real;
+}
 
-    return result;
+DC_DEF double* dc_double_array_imag(dc_double_array a) {
+    DC_ASSERT(a && "dc_double_array_imag: operand cannot be NULL");
+    return a->imag;
 }
 
-DC_DEF dc_complex_int dc_int_mul(dc_complex_int a, dc_complex_int b) {
-    DC_ASSERT(a && "dc_int_mul: first operand cannot be NULL");
-    DC_ASSERT(b && "dc_int_mul: second operand cannot be NULL");
+DC_DEF double complex dc_double_array_get(dc_double_array a, size_t index) {
+    DC_ASSERT(a && "dc_double_array_get: operand cannot be NULL");
+    DC_ASSERT(index < a->length && "dc_double_array_get: index out of range");
+    return dc_double_make(a->real[index], a->imag[index]);
+}
 
-    // (a + bi) * (c + di) = (ac - bd) + (ad + bc)i
-    di_int ac = di_mul(a->real, b->real);
-    di_int bd = di_mul(a->imag, b->imag);
-    di_int ad = di_mul(a->real, b->imag);
-    di_int bc = di_mul(a->imag, b->real);
+DC_DEF void dc_double_array_set(dc_double_array a, size_t index, double complex value) {
+    DC_ASSERT(a && "dc_double_array_set: operand cannot be NULL");
+    DC_ASSERT(index < a->length && "dc_double_array_set: index out of range");
+    a->real[index] = creal(value);
+    a->imag[index] = cimag(value);
+}
 
-    di_int real = di_sub(ac, bd);
-    di_int imag = di_add(ad, bc);
+DC_DEF void dc_double_array_to_values(dc_double_array a, double complex* out) {
+    DC_ASSERT(a && "dc_double_array_to_values: operand cannot be NULL");
+    DC_ASSERT((out || a->length == 0) && "dc_double_array_to_values: output cannot be NULL");
 
-    dc_complex_int result = dc_int_from_di(real, imag);
+    for (size_t i = 0; i < a->length; i++) {
+        out[i] = dc_double_make(a->real[i], a->imag[i]);
+    }
+}
 
-    di_release(&ac);
-    di_release(&bd);
-    di_release(&ad);
-    di_release(&bc);
-    di_release(&real);
-    di_release(&imag);
+DC_DEF dc_double_array dc_double_array_add(dc_double_array a, dc_double_array b) {
+    DC_ASSERT(a && "dc_double_array_add: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_double_array_add: second operand cannot be NULL");
+    DC_ASSERT(a->length == b->length && "dc_double_array_add: length mismatch");
 
+    dc_double_array result = dc_double_array_alloc(a->length);
+    dc_array_binary(result, a, b, DC_ARRAY_ADD);
     return result;
 }
 
-DC_DEF dc_complex_frac dc_int_div(dc_complex_int a, dc_complex_int b) {
-    DC_ASSERT(a && "dc_int_div: first operand cannot be NULL");
-    DC_ASSERT(b && "dc_int_div: second operand cannot be NULL");
+DC_DEF dc_double_array dc_double_array_sub(dc_double_array a, dc_double_array b) {
+    DC_ASSERT(a && "dc_double_array_sub: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_double_array_sub: second operand cannot be NULL");
+    DC_ASSERT(a->length == b->length && "dc_double_array_sub: length mismatch");
 
-    // Convert to fractions and divide
-    dc_complex_frac af = dc_int_to_frac(a);
-    dc_complex_frac bf = dc_int_to_frac(b);
-    dc_complex_frac result = dc_frac_div(af, bf);
+    dc_double_array result = dc_double_array_alloc(a->length);
+    dc_array_binary(result, a, b, DC_ARRAY_SUB);
+    return result;
+}
 
-    dc_frac_release(&af);
-    dc_frac_release(&bf);
+DC_DEF dc_double_array dc_double_array_mul(dc_double_array a, dc_double_array b) {
+    DC_ASSERT(a && "dc_double_array_mul: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_double_array_mul: second operand cannot be NULL");
+    DC_ASSERT(a->length == b->length && "dc_double_array_mul: length mismatch");
 
+    dc_double_array result = dc_double_array_alloc(a->length);
+    dc_array_binary(result, a, b, DC_ARRAY_MUL);
     return result;
 }
 
-DC_DEF dc_complex_int dc_int_negate(dc_complex_int c) {
-    DC_ASSERT(c && "dc_int_negate: operand cannot be NULL");
+DC_DEF dc_double_array dc_double_array_div(dc_double_array a, dc_double_array b) {
+    DC_ASSERT(a && "dc_double_array_div: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_double_array_div: second operand cannot be NULL");
+    DC_ASSERT(a->length == b->length && "dc_double_array_div: length mismatch");
 
-    di_int real = di_negate(c->real);
-    di_int imag = di_negate(c->imag);
-    dc_complex_int result = dc_int_from_di(real, imag);
-    di_release(&real);
-    di_release(&imag);
+    dc_double_array result = dc_double_array_alloc(a->length);
+    dc_array_binary(result, a, b, DC_ARRAY_DIV);
+    return result;
+}
 
+DC_DEF dc_double_array dc_double_array_conj(dc_double_array a) {
+    DC_ASSERT(a && "dc_double_array_conj: operand cannot be NULL");
+
+    dc_double_array result = dc_double_array_alloc(a->length);
+    dc_double_array_conj_into(result, a);
     return result;
 }
 
-DC_DEF dc_complex_int dc_int_conj(dc_complex_int c) {
-    DC_ASSERT(c && "dc_int_conj: operand cannot be NULL");
+DC_DEF void dc_double_array_add_into(dc_double_array dst, dc_double_array a, dc_double_array b) {
+    DC_ASSERT(dst && "dc_double_array_add_into: destination cannot be NULL");
+    DC_ASSERT(a && "dc_double_array_add_into: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_double_array_add_into: second operand cannot be NULL");
+    DC_ASSERT(dst->length == a->length && a->length == b->length && "dc_double_array_add_into: length mismatch");
 
-    di_int real = di_retain(c->real);
-    di_int imag = di_negate(c->imag);
-    dc_complex_int result = dc_int_from_di(real, imag);
-    di_release(&real);
-    di_release(&imag);
+    dc_array_binary(dst, a, b, DC_ARRAY_ADD);
+}
 
-    return result;
+DC_DEF void dc_double_array_sub_into(dc_double_array dst, dc_double_array a, dc_double_array b) {
+    DC_ASSERT(dst && "dc_double_array_sub_into: destination cannot be NULL");
+    DC_ASSERT(a && "dc_double_array_sub_into: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_double_array_sub_into: second operand cannot be NULL");
+    DC_ASSERT(dst->length == a->length && a->length == b->length && "dc_double_array_sub_into: length mismatch");
+
+    dc_array_binary(dst, a, b, DC_ARRAY_SUB);
 }
 
-DC_DEF di_int dc_int_real(dc_complex_int c) {
-    DC_ASSERT(c && "dc_int_real: operand cannot be NULL");
-    return di_retain(c->real);
+DC_DEF void dc_double_array_mul_into(dc_double_array dst, dc_double_array a, dc_double_array b) {
+    DC_ASSERT(dst && "dc_double_array_mul_into: destination cannot be NULL");
+    DC_ASSERT(a && "dc_double_array_mul_into: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_double_array_mul_into: second operand cannot be NULL");
+    DC_ASSERT(dst->length == a->length && a->length == b->length && "dc_double_array_mul_into: length mismatch");
+
+    dc_array_binary(dst, a, b, DC_ARRAY_MUL);
 }
 
-DC_DEF di_int dc_int_imag(dc_complex_int c) {
-    DC_ASSERT(c && "dc_int_imag: operand cannot be NULL");
-    return di_retain(c->imag);
+DC_DEF void dc_double_array_div_into(dc_double_array dst, dc_double_array a, dc_double_array b) {
+    DC_ASSERT(dst && "dc_double_array_div_into: destination cannot be NULL");
+    DC_ASSERT(a && "dc_double_array_div_into: first operand cannot be NULL");
+    DC_ASSERT(b && "dc_double_array_div_into: second operand cannot be NULL");
+    DC_ASSERT(dst->length == a->length && a->length == b->length && "dc_double_array_div_into: length mismatch");
+
+    dc_array_binary(dst, a, b, DC_ARRAY_DIV);
 }
 
-DC_DEF bool dc_int_eq(dc_complex_int a, dc_complex_int b) {
-    DC_ASSERT(a && "dc_int_eq: first operand cannot be NULL");
-    DC_ASSERT(b && "dc_int_eq: second operand cannot be NULL");
+DC_DEF void dc_double_array_conj_into(dc_double_array dst, dc_double_array a) {
+    DC_ASSERT(dst && "dc_double_array_conj_into: destination cannot be NULL");
+    DC_ASSERT(a && "dc_double_array_conj_into: operand cannot be NULL");
+    DC_ASSERT(dst->length == a->length && "dc_double_array_conj_into: length mismatch");
 
-    return di_compare(a->real, b->real) == 0 && di_compare(a->imag, b->imag) == 0;
+    dc_simd_isa isa = dc_simd_detect();
+    size_t n = a->length;
+    size_t i = DC_ARRAY_VECTOR(isa, conj, dst->real, dst->imag, a->real, a->imag, n);
+    dc_array_conj_scalar(dst->real + i, dst->imag + i, a->real + i, a->imag + i, n - i);
 }
 
-DC_DEF bool dc_int_is_zero(dc_complex_int c) {
-    DC_ASSERT(c && "dc_int_is_zero: operand cannot be NULL");
-    return di_is_zero(c->real) && di_is_zero(c->imag);
+DC_DEF void dc_double_array_abs(dc_double_array a, double* out) {
+    DC_ASSERT(a && "dc_double_array_abs: operand cannot be NULL");
+    DC_ASSERT((out || a->length == 0) && "dc_double_array_abs: output cannot be NULL");
+
+    for (size_t i = 0; i < a->length; i++) {
+        out[i] = dcv_double_abs(dc_double_make(a->real[i], a->imag[i]));
+    }
 }
 
-DC_DEF bool dc_int_is_real(dc_complex_int c) {
-    DC_ASSERT(c && "dc_int_is_real: operand cannot be NULL");
-    return di_is_zero(c->imag);
+DC_DEF void dc_double_array_arg(dc_double_array a, double* out) {
+    DC_ASSERT(a && "dc_double_array_arg: operand cannot be NULL");
+    DC_ASSERT((out || a->length == 0) && "dc_double_array_arg: output cannot be NULL");
+
+    for (size_t i = 0; i < a->length; i++) {
+        out[i] = dcv_double_arg(dc_double_make(a->real[i], a->imag[i]));
+    }
 }
 
-DC_DEF bool dc_int_is_imag(dc_complex_int c) {
-    DC_ASSERT(c && "dc_int_is_imag: operand cannot be NULL");
-    return di_is_zero(c->real);
+DC_DEF dc_double_array dc_double_array_exp(dc_double_array a) {
+    DC_ASSERT(a && "dc_double_array_exp: operand cannot be NULL");
+
+    dc_double_array result = dc_double_array_alloc(a->length);
+    dc_array_unary(result, a, DC_ARRAY_EXP);
+    return result;
 }
 
-DC_DEF char* dc_int_to_string(dc_complex_int c) {
-    DC_ASSERT(c && "dc_int_to_string: operand cannot be NULL");
+DC_DEF void dc_double_array_exp_into(dc_double_array dst, dc_double_array a) {
+    DC_ASSERT(dst && "dc_double_array_exp_into: destination cannot be NULL");
+    DC_ASSERT(a && "dc_double_array_exp_into: operand cannot be NULL");
+    DC_ASSERT(dst->length == a->length && "dc_double_array_exp_into: length mismatch");
 
-    char* real_str = di_to_string(c->real, 10);
-    char* imag_str = di_to_string(c->imag, 10);
+    dc_array_unary(dst, a, DC_ARRAY_EXP);
+}
 
-    size_t len = strlen(real_str) + strlen(imag_str) + 10;
-    char* result = DC_MALLOC(len);
-    DC_ASSERT(result && "dc_int_to_string: allocation failed");
+DC_DEF dc_double_array dc_double_array_log(dc_double_array a) {
+    DC_ASSERT(a && "dc_double_array_log: operand cannot be NULL");
 
-    bool real_zero = di_is_zero(c->real);
-    bool imag_zero = di_is_zero(c->imag);
-    bool imag_neg = di_is_negative(c->imag);
+    dc_double_array result = dc_double_array_alloc(a->length);
+    dc_array_unary(result, a, DC_ARRAY_LOG);
+    return result;
+}
 
-    if (real_zero && imag_zero) {
-        strcpy(result, "0");
-    } else if (imag_zero) {
-        strcpy(result, real_str);
-    } else if (real_zero) {
-        if (strcmp(imag_str, "1") == 0) {
-            strcpy(result, "i");
-        } else if (strcmp(imag_str, "-1") == 0) {
-            strcpy(result, "-i");
-        } else {
-            sprintf(result, "%si", imag_str);
-        }
-    } else {
-        if (strcmp(imag_str, "1") == 0) {
-            sprintf(result, "%s+i", real_str);
-        } else if (strcmp(imag_str, "-1") == 0) {
-            sprintf(result, "%s-i", real_str);
-        } else if (imag_neg) {
-            sprintf(result, "%s%si", real_str, imag_str);
-        } else {
-            sprintf(result, "%s+%si", real_str, imag_str);
-        }
-    }
+DC_DEF void dc_double_array_log_into(dc_double_array dst, dc_double_array a) {
+    DC_ASSERT(dst && "dc_double_array_log_into: destination cannot be NULL");
+    DC_ASSERT(a && "dc_double_array_log_into: operand cannot be NULL");
+    DC_ASSERT(dst->length == a->length && "dc_double_array_log_into: length mismatch");
 
-    free(real_str);
-    free(imag_str);
+    dc_array_unary(dst, a, DC_ARRAY_LOG);
+}
 
+DC_DEF dc_double_array dc_double_array_sin(dc_double_array a) {
+    DC_ASSERT(a && "dc_double_array_sin: operand cannot be NULL");
+
+    dc_double_array result = dc_double_array_alloc(a->length);
+    dc_array_unary(result, a, DC_ARRAY_SIN);
     return result;
 }
 
-// ============================================================================
-// FRACTION COMPLEX IMPLEMENTATION
-// ============================================================================
+DC_DEF void dc_double_array_sin_into(dc_double_array dst, dc_double_array a) {
+    DC_ASSERT(dst && "dc_double_array_sin_into: destination cannot be NULL");
+    DC_ASSERT(a && "dc_double_array_sin_into: operand cannot be NULL");
+    DC_ASSERT(dst->length == a->length && "dc_double_array_sin_into: length mismatch");
 
-DC_DEF dc_complex_frac dc_frac_from_ints(int64_t real_num, int64_t real_den,
-                                          int64_t imag_num, int64_t imag_den) {
-    df_frac real = df_from_ints(real_num, real_den);
-    df_frac imag = df_from_ints(imag_num, imag_den);
-    dc_complex_frac result = dc_frac_from_df(real, imag);
-    df_release(&real);
-    df_release(&imag);
+    dc_array_unary(dst, a, DC_ARRAY_SIN);
+}
+
+DC_DEF dc_double_array dc_double_array_cos(dc_double_array a) {
+    DC_ASSERT(a && "dc_double_array_cos: operand cannot be NULL");
+
+    dc_double_array result = dc_double_array_alloc(a->length);
+    dc_array_unary(result, a, DC_ARRAY_COS);
     return result;
 }
 
-DC_DEF dc_complex_frac dc_frac_from_df(df_frac real, df_frac imag) {
-    DC_ASSERT(real && "dc_frac_from_df: real part cannot be NULL");
-    DC_ASSERT(imag && "dc_frac_from_df: imaginary part cannot be NULL");
+DC_DEF void dc_double_array_cos_into(dc_double_array dst, dc_double_array a) {
+    DC_ASSERT(dst && "dc_double_array_cos_into: destination cannot be NULL");
+    DC_ASSERT(a && "dc_double_array_cos_into: operand cannot be NULL");
+    DC_ASSERT(dst->length == a->length && "dc_double_array_cos_into: length mismatch");
 
-    dc_complex_frac result = DC_MALLOC(sizeof(struct dc_complex_frac_internal));
-    DC_ASSERT(result && "dc_frac_from_df: allocation failed");
+    dc_array_unary(dst, a, DC_ARRAY_COS);
+}
 
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->real = df_retain(real);
-    result->imag = df_retain(imag);
+DC_DEF dc_double_array dc_double_array_sqrt(dc_double_array a) {
+    DC_ASSERT(a && "dc_double_array_sqrt: operand cannot be NULL");
 
+    dc_double_array result = dc_double_array_alloc(a->length);
+    dc_array_unary(result, a, DC_ARRAY_SQRT);
     return result;
 }
 
-DC_DEF dc_complex_frac dc_frac_zero(void) {
-    if (!dc_frac_zero_singleton) {
-        dc_frac_zero_singleton = dc_frac_from_ints(0, 1, 0, 1);
-        DC_ATOMIC_STORE(&dc_frac_zero_singleton->ref_count, SIZE_MAX/2);
-    }
-    return dc_frac_retain(dc_frac_zero_singleton);
+DC_DEF void dc_double_array_sqrt_into(dc_double_array dst, dc_double_array a) {
+    DC_ASSERT(dst && "dc_double_array_sqrt_into: destination cannot be NULL");
+    DC_ASSERT(a && "dc_double_array_sqrt_into: operand cannot be NULL");
+    DC_ASSERT(dst->length == a->length && "dc_double_array_sqrt_into: length mismatch");
+
+    dc_array_unary(dst, a, DC_ARRAY_SQRT);
 }
 
-DC_DEF dc_complex_frac dc_frac_one(void) {
-    if (!dc_frac_one_singleton) {
-        dc_frac_one_singleton = dc_frac_from_ints(1, 1, 0, 1);
-        DC_ATOMIC_STORE(&dc_frac_one_singleton->ref_count, SIZE_MAX/2);
+// ============================================================================
+// FAST FOURIER TRANSFORM IMPLEMENTATION
+// ============================================================================
+
+#define DC_FFT_TWO_PI 6.28318530717958647692528676655900577
+
+static DC_THREAD_LOCAL struct dc_fft_plan_internal* dc_fft_plan_cache = NULL;
+
+// Split n into radix-4 stages, at most one radix-2 stage, then radix-3 and radix-5 stages
+static bool dc_fft_factor(size_t n, uint8_t* radices, size_t* count) {
+    static const uint8_t order[] = {4, 2, 3, 5};
+    *count = 0;
+    for (size_t i = 0; i < sizeof(order); i++) {
+        while (n % order[i] == 0 && n > 1) {
+            radices[(*count)++] = order[i];
+            n /= order[i];
+            if (order[i] == 2) break;
+        }
     }
-    return dc_frac_retain(dc_frac_one_singleton);
+    return n == 1;
 }
 
-DC_DEF dc_complex_frac dc_frac_i(void) {
-    if (!dc_frac_i_singleton) {
-        dc_frac_i_singleton = dc_frac_from_ints(0, 1, 1, 1);
-        DC_ATOMIC_STORE(&dc_frac_i_singleton->ref_count, SIZE_MAX/2);
+// e^(-2 pi i k/n), folded into [0, pi] so large k lose no accuracy
+static void dc_fft_root(size_t k, size_t n, double* re, double* im) {
+    k %= n;
+    bool upper = k > n - k;
+    if (upper) k = n - k;
+    double angle = DC_FFT_TWO_PI * (double)k / (double)n;
+    *re = cos(angle);
+    *im = upper ? sin(angle) : -sin(angle);
+}
+
+// Plans for real-input transforms borrow the parent's scratch space, so with_work is false for them
+static struct dc_fft_plan_internal* dc_fft_plan_create(size_t n, bool with_work) {
+    struct dc_fft_plan_internal* plan = DC_MALLOC(sizeof(struct dc_fft_plan_internal));
+    DC_ASSERT(plan && "dc_fft_plan_new: allocation failed");
+    DC_STATS_LIVE(DC_STAT_LIVE_FFT_PLAN, 1);
+
+    bool supported = dc_fft_factor(n, plan->radices, &plan->stage_count);
+    DC_ASSERT(supported && "dc_fft_plan_new: size must be a positive product of 2, 3 and 5");
+    (void)supported;
+
+    size_t twiddles = 0;
+    for (size_t k = 0, len = n; k < plan->stage_count; k++) {
+        len /= plan->radices[k];
+        twiddles += (size_t)(plan->radices[k] - 1) * len;
+    }
+    bool real_even = with_work && n % 2 == 0;
+    size_t real_twiddles = real_even ? n / 2 + 1 : 0;
+    size_t work = with_work ? 4 * n : 0;
+    DC_ASSERT(n <= SIZE_MAX / 8 / sizeof(double) && "dc_fft_plan_new: size too large");
+
+    plan->block = DC_MALLOC((2 * twiddles + 2 * real_twiddles + work + 1) * sizeof(double));
+    DC_ASSERT(plan->block && "dc_fft_plan_new: allocation failed");
+    DC_ATOMIC_STORE(&plan->ref_count, 1);
+    plan->size = n;
+    plan->twiddle_re = plan->block;
+    plan->twiddle_im = plan->twiddle_re + twiddles;
+    plan->real_re = plan->twiddle_im + twiddles;
+    plan->real_im = plan->real_re + real_twiddles;
+    plan->work = with_work ? plan->real_im + real_twiddles : NULL;
+    plan->half = real_even ? dc_fft_plan_create(n / 2, false) : NULL;
+    plan->next = NULL;
+
+    // Stage twiddles: w[pp][t - 1] = e^(-2 pi i pp t / len) for the stage's current length
+    size_t offset = 0;
+    for (size_t k = 0, len = n; k < plan->stage_count; k++) {
+        size_t p = plan->radices[k], m = len / p;
+        for (size_t pp = 0; pp < m; pp++) {
+            for (size_t t = 1; t < p; t++) {
+                dc_fft_root(pp * t * (n / len), n, &plan->twiddle_re[offset], &plan->twiddle_im[offset]);
+                offset++;
+            }
+        }
+        len = m;
     }
-    return dc_frac_retain(dc_frac_i_singleton);
+    for (size_t k = 0; k < real_twiddles; k++) {
+        dc_fft_root(k, n, &plan->real_re[k], &plan->real_im[k]);
+    }
+
+    return plan;
 }
 
-DC_DEF dc_complex_frac dc_frac_neg_one(void) {
-    if (!dc_frac_neg_one_singleton) {
-        dc_frac_neg_one_singleton = dc_frac_from_ints(-1, 1, 0, 1);
-        DC_ATOMIC_STORE(&dc_frac_neg_one_singleton->ref_count, SIZE_MAX/2);
+static void dc_fft_plan_free(struct dc_fft_plan_internal* plan) {
+    if (plan->half) dc_fft_plan_free(plan->half);
+    DC_FREE(plan->block);
+    DC_FREE(plan);
+    DC_STATS_LIVE(DC_STAT_LIVE_FFT_PLAN, -1);
+}
+
+// ---------------------------------------------------------------------------
+// Stockham stages: with stride s and m = len / p, input element (q, pp, r)
+// sits at q + s * (pp + r * m) and output element (q, pp, t) at
+// q + s * (p * pp + t). The inner loop over q is contiguous.
+// ---------------------------------------------------------------------------
+
+#define DC_FFT_TWIDDLE(out_re, out_im, q, xr, xi, wr, wi)                                                         \
+    do {                                                                                                          \
+        (out_re)[q] = (xr) * (wr) - (xi) * (wi);                                                                  \
+        (out_im)[q] = (xr) * (wi) + (xi) * (wr);                                                                  \
+    } while (0)
+
+static void dc_fft_radix2(size_t s, size_t m, const double* tw_re, const double* tw_im, const double* x_re,
+                          const double* x_im, double* y_re, double* y_im) {
+    for (size_t pp = 0; pp < m; pp++) {
+        const double w1r = tw_re[pp], w1i = tw_im[pp];
+        const double *a0r = x_re + s * pp, *a0i = x_im + s * pp;
+        const double *a1r = a0r + s * m, *a1i = a0i + s * m;
+        double *b0r = y_re + s * 2 * pp, *b0i = y_im + s * 2 * pp;
+        double *b1r = b0r + s, *b1i = b0i + s;
+        for (size_t q = 0; q < s; q++) {
+            double dr = a0r[q] - a1r[q], di = a0i[q] - a1i[q];
+            b0r[q] = a0r[q] + a1r[q];
+            b0i[q] = a0i[q] + a1i[q];
+            DC_FFT_TWIDDLE(b1r, b1i, q, dr, di, w1r, w1i);
+        }
     }
-    return dc_frac_retain(dc_frac_neg_one_singleton);
 }
 
-DC_DEF dc_complex_frac dc_frac_neg_i(void) {
-    if (!dc_frac_neg_i_singleton) {
-        dc_frac_neg_i_singleton = dc_frac_from_ints(0, 1, -1, 1);
-        DC_ATOMIC_STORE(&dc_frac_neg_i_singleton->ref_count, SIZE_MAX/2);
+static void dc_fft_radix3(size_t s, size_t m, const double* tw_re, const double* tw_im, const double* x_re,
+                          const double* x_im, double* y_re, double* y_im) {
+    const double c = -0.5, h = 0.86602540378443864676372317075293618;
+    for (size_t pp = 0; pp < m; pp++) {
+        const double w1r = tw_re[2 * pp], w1i = tw_im[2 * pp];
+        const double w2r = tw_re[2 * pp + 1], w2i = tw_im[2 * pp + 1];
+        const double *a0r = x_re + s * pp, *a0i = x_im + s * pp;
+        const double *a1r = a0r + s * m, *a1i = a0i + s * m;
+        const double *a2r = a1r + s * m, *a2i = a1i + s * m;
+        double *b0r = y_re + s * 3 * pp, *b0i = y_im + s * 3 * pp;
+        double *b1r = b0r + s, *b1i = b0i + s;
+        double *b2r = b1r + s, *b2i = b1i + s;
+        for (size_t q = 0; q < s; q++) {
+            double ur = a1r[q] + a2r[q], ui = a1i[q] + a2i[q];
+            double vr = h * (a1r[q] - a2r[q]), vi = h * (a1i[q] - a2i[q]);
+            double er = a0r[q] + c * ur, ei = a0i[q] + c * ui;
+            b0r[q] = a0r[q] + ur;
+            b0i[q] = a0i[q] + ui;
+            DC_FFT_TWIDDLE(b1r, b1i, q, er + vi, ei - vr, w1r, w1i);
+            DC_FFT_TWIDDLE(b2r, b2i, q, er - vi, ei + vr, w2r, w2i);
+        }
     }
-    return dc_frac_retain(dc_frac_neg_i_singleton);
 }
 
-DC_DEF dc_complex_frac dc_frac_retain(dc_complex_frac c) {
-    DC_ASSERT(c && "dc_frac_retain: cannot retain NULL");
-    DC_ATOMIC_FETCH_ADD(&c->ref_count, 1);
-    return c;
+static void dc_fft_radix4(size_t s, size_t m, const double* tw_re, const double* tw_im, const double* x_re,
+                          const double* x_im, double* y_re, double* y_im) {
+    for (size_t pp = 0; pp < m; pp++) {
+        const double w1r = tw_re[3 * pp], w1i = tw_im[3 * pp];
+        const double w2r = tw_re[3 * pp + 1], w2i = tw_im[3 * pp + 1];
+        const double w3r = tw_re[3 * pp + 2], w3i = tw_im[3 * pp + 2];
+        const double *a0r = x_re + s * pp, *a0i = x_im + s * pp;
+        const double *a1r = a0r + s * m, *a1i = a0i + s * m;
+        const double *a2r = a1r + s * m, *a2i = a1i + s * m;
+        const double *a3r = a2r + s * m, *a3i = a2i + s * m;
+        double *b0r = y_re + s * 4 * pp, *b0i = y_im + s * 4 * pp;
+        double *b1r = b0r + s, *b1i = b0i + s;
+        double *b2r = b1r + s, *b2i = b1i + s;
+        double *b3r = b2r + s, *b3i = b2i + s;
+        for (size_t q = 0; q < s; q++) {
+            double t0r = a0r[q] + a2r[q], t0i = a0i[q] + a2i[q];
+            double t1r = a0r[q] - a2r[q], t1i = a0i[q] - a2i[q];
+            double t2r = a1r[q] + a3r[q], t2i = a1i[q] + a3i[q];
+            double t3r = a1r[q] - a3r[q], t3i = a1i[q] - a3i[q];
+            b0r[q] = t0r + t2r;
+            b0i[q] = t0i + t2i;
+            DC_FFT_TWIDDLE(b1r, b1i, q, t1r + t3i, t1i - t3r, w1r, w1i);
+            DC_FFT_TWIDDLE(b2r, b2i, q, t0r - t2r, t0i - t2i, w2r, w2i);
+            DC_FFT_TWIDDLE(b3r, b3i, q, t1r - t3i, t1i + t3r, w3r, w3i);
+        }
+    }
 }
 
-DC_DEF void dc_frac_release(dc_complex_frac* c) {
-    if (!c || !*c) return;
+static void dc_fft_radix5(size_t s, size_t m, const double* tw_re, const double* tw_im, const double* x_re,
+                          const double* x_im, double* y_re, double* y_im) {
+    const double c1 = 0.30901699437494742410229341718281906, c2 = -0.80901699437494742410229341718281906;
+    const double s1 = 0.95105651629515357211643933337938214, s2 = 0.58778525229247312916870595463907277;
+    for (size_t pp = 0; pp < m; pp++) {
+        const double* wr = tw_re + 4 * pp;
+        const double* wi = tw_im + 4 * pp;
+        const double *a0r = x_re + s * pp, *a0i = x_im + s * pp;
+        const double *a1r = a0r + s * m, *a1i = a0i + s * m;
+        const double *a2r = a1r + s * m, *a2i = a1i + s * m;
+        const double *a3r = a2r + s * m, *a3i = a2i + s * m;
+        const double *a4r = a3r + s * m, *a4i = a3i + s * m;
+        double *b0r = y_re + s * 5 * pp, *b0i = y_im + s * 5 * pp;
+        double *b1r = b0r + s, *b1i = b0i + s;
+        double *b2r = b1r + s, *b2i = b1i + s;
+        double *b3r = b2r + s, *b3i = b2i + s;
+        double *b4r = b3r + s, *b4i = b3i + s;
+        for (size_t q = 0; q < s; q++) {
+            double u1r = a1r[q] + a4r[q], u1i = a1i[q] + a4i[q];
+            double v1r = a1r[q] - a4r[q], v1i = a1i[q] - a4i[q];
+            double u2r = a2r[q] + a3r[q], u2i = a2i[q] + a3i[q];
+            double v2r = a2r[q] - a3r[q], v2i = a2i[q] - a3i[q];
+            double e1r = a0r[q] + c1 * u1r + c2 * u2r, e1i = a0i[q] + c1 * u1i + c2 * u2i;
+            double e2r = a0r[q] + c2 * u1r + c1 * u2r, e2i = a0i[q] + c2 * u1i + c1 * u2i;
+            double f1r = s1 * v1r + s2 * v2r, f1i = s1 * v1i + s2 * v2i;
+            double f2r = s2 * v1r - s1 * v2r, f2i = s2 * v1i - s1 * v2i;
+            b0r[q] = a0r[q] + u1r + u2r;
+            b0i[q] = a0i[q] + u1i + u2i;
+            DC_FFT_TWIDDLE(b1r, b1i, q, e1r + f1i, e1i - f1r, wr[0], wi[0]);
+            DC_FFT_TWIDDLE(b2r, b2i, q, e2r + f2i, e2i - f2r, wr[1], wi[1]);
+            DC_FFT_TWIDDLE(b3r, b3i, q, e2r - f2i, e2i + f2r, wr[2], wi[2]);
+            DC_FFT_TWIDDLE(b4r, b4i, q, e1r - f1i, e1i + f1r, wr[3], wi[3]);
+        }
+    }
+}
 
-    size_t old_count = DC_ATOMIC_FETCH_SUB(&(*c)->ref_count, 1);
-    if (old_count == 1) {
-        // Don't free singletons
-        if (*c == dc_frac_zero_singleton || *c == dc_frac_one_singleton ||
-            *c == dc_frac_i_singleton || *c == dc_frac_neg_one_singleton ||
-            *c == dc_frac_neg_i_singleton) {
-            *c = NULL;
-            return;
+// Forward transform of re/im in place, ping-ponging through the work buffers
+static void dc_fft_run(const struct dc_fft_plan_internal* plan, double* re, double* im, double* work_re,
+                       double* work_im) {
+    const double* tw_re = plan->twiddle_re;
+    const double* tw_im = plan->twiddle_im;
+    double *x_re = re, *x_im = im, *y_re = work_re, *y_im = work_im;
+    size_t s = 1, len = plan->size;
+
+    for (size_t k = 0; k < plan->stage_count; k++) {
+        size_t p = plan->radices[k], m = len / p;
+        switch (p) {
+            case 2:
+                dc_fft_radix2(s, m, tw_re, tw_im, x_re, x_im, y_re, y_im);
+                break;
+            case 3:
+                dc_fft_radix3(s, m, tw_re, tw_im, x_re, x_im, y_re, y_im);
+                break;
+            case 4:
+                dc_fft_radix4(s, m, tw_re, tw_im, x_re, x_im, y_re, y_im);
+                break;
+            default:
+                dc_fft_radix5(s, m, tw_re, tw_im, x_re, x_im, y_re, y_im);
+                break;
         }
+        tw_re += (p - 1) * m;
+        tw_im += (p - 1) * m;
+
+        double* t = x_re;
+        x_re = y_re;
+        y_re = t;
+        t = x_im;
+        x_im = y_im;
+        y_im = t;
+        s *= p;
+        len = m;
+    }
 
-        df_release(&(*c)->real);
-        df_release(&(*c)->imag);
-        DC_FREE(*c);
+    if (x_re != re) {
+        memcpy(re, x_re, plan->size * sizeof(double));
+        memcpy(im, x_im, plan->size * sizeof(double));
     }
-    *c = NULL;
 }
 
-DC_DEF dc_complex_frac dc_frac_copy(dc_complex_frac c) {
-    DC_ASSERT(c && "dc_frac_copy: cannot copy NULL");
-    return dc_frac_from_df(c->real, c->imag);
+// Inverse as conj(forward(conj(x))) / n
+static void dc_fft_run_inverse(const struct dc_fft_plan_internal* plan, double* re, double* im, double* work_re,
+                               double* work_im) {
+    size_t n = plan->size;
+    double scale = 1.0 / (double)n;
+    for (size_t i = 0; i < n; i++) im[i] = -im[i];
+    dc_fft_run(plan, re, im, work_re, work_im);
+    for (size_t i = 0; i < n; i++) {
+        re[i] *= scale;
+        im[i] *= -scale;
+    }
 }
 
-DC_DEF dc_complex_frac dc_frac_add(dc_complex_frac a, dc_complex_frac b) {
-    DC_ASSERT(a && "dc_frac_add: first operand cannot be NULL");
-    DC_ASSERT(b && "dc_frac_add: second operand cannot be NULL");
+DC_DEF bool dc_fft_size_supported(size_t n) {
+    if (n == 0) return false;
+    static const size_t primes[] = {2, 3, 5};
+    for (size_t i = 0; i < 3; i++) {
+        while (n % primes[i] == 0) n /= primes[i];
+    }
+    return n == 1;
+}
+
+DC_DEF dc_fft_plan dc_fft_plan_new(size_t n) {
+    DC_ASSERT(dc_fft_size_supported(n) && "dc_fft_plan_new: size must be a positive product of 2, 3 and 5");
+
+    for (struct dc_fft_plan_internal* plan = dc_fft_plan_cache; plan; plan = plan->next) {
+        if (plan->size == n) return dc_fft_plan_retain(plan);
+    }
+
+    // The cache keeps one reference for itself
+    struct dc_fft_plan_internal* plan = dc_fft_plan_create(n, true);
+    plan->next = dc_fft_plan_cache;
+    dc_fft_plan_cache = plan;
+    return dc_fft_plan_retain(plan);
+}
+
+DC_DEF dc_fft_plan dc_fft_plan_retain(dc_fft_plan plan) {
+    DC_ASSERT(plan && "dc_fft_plan_retain: cannot retain NULL");
+    DC_ATOMIC_FETCH_ADD(&plan->ref_count, 1);
+    return plan;
+}
 
-    df_frac real = df_add(a->real, b->real);
-    df_frac imag = df_add(a->imag, b->imag);
-    dc_complex_frac result = dc_frac_from_df(real, imag);
-    df_release(&real);
-    df_release(&imag);
+DC_DEF void dc_fft_plan_release(dc_fft_plan* plan) {
+    if (!plan || !*plan) return;
 
-    return result;
+    size_t old_count = DC_ATOMIC_FETCH_SUB(&(*plan)->ref_count, 1);
+    if (old_count == 1) {
+        dc_fft_plan_free(*plan);
+    }
+    *plan = NULL;
 }
 
-DC_DEF dc_complex_frac dc_frac_sub(dc_complex_frac a, dc_complex_frac b) {
-    DC_ASSERT(a && "dc_frac_sub: first operand cannot be NULL");
-    DC_ASSERT(b && "dc_frac_sub: second operand cannot be NULL");
+DC_DEF size_t dc_fft_plan_size(dc_fft_plan plan) {
+    DC_ASSERT(plan && "dc_fft_plan_size: plan cannot be NULL");
+    return plan->size;
+}
 
-    df_frac real = df_sub(a->real, b->real);
-    df_frac imag = df_sub(a->imag, b->imag);
-    dc_complex_frac result = dc_frac_from_df(real, imag);
-    df_release(&real);
-    df_release(&imag);
+DC_DEF void dc_fft_plan_cache_clear(void) {
+    struct dc_fft_plan_internal* plan = dc_fft_plan_cache;
+    dc_fft_plan_cache = NULL;
+    while (plan) {
+        struct dc_fft_plan_internal* next = plan->next;
+        plan->next = NULL;
+        dc_fft_plan_release(&plan);
+        plan = next;
+    }
+}
 
-    return result;
+DC_DEF void dc_fft_forward(dc_fft_plan plan, double* real, double* imag) {
+    DC_ASSERT(plan && "dc_fft_forward: plan cannot be NULL");
+    DC_ASSERT(real && imag && "dc_fft_forward: buffers cannot be NULL");
+
+    dc_fft_run(plan, real, imag, plan->work, plan->work + plan->size);
 }
 
-DC_DEF dc_complex_frac dc_frac_mul(dc_complex_frac a, dc_complex_frac b) {
-    DC_ASSERT(a && "dc_frac_mul: first operand cannot be NULL");
-    DC_ASSERT(b && "dc_frac_mul: second operand cannot be NULL");
+DC_DEF void dc_fft_inverse(dc_fft_plan plan, double* real, double* imag) {
+    DC_ASSERT(plan && "dc_fft_inverse: plan cannot be NULL");
+    DC_ASSERT(real && imag && "dc_fft_inverse: buffers cannot be NULL");
 
-    // (a + bi) * (c + di) = (ac - bd) + (ad + bc)i
-    df_frac ac = df_mul(a->real, b->real);
-    df_frac bd = df_mul(a->imag, b->imag);
-    df_frac ad = df_mul(a->real, b->imag);
-    df_frac bc = df_mul(a->imag, b->real);
+    dc_fft_run_inverse(plan, real, imag, plan->work, plan->work + plan->size);
+}
 
-    df_frac real = df_sub(ac, bd);
-    df_frac imag = df_add(ad, bc);
+DC_DEF void dc_fft_forward_values(dc_fft_plan plan, double complex* values) {
+    DC_ASSERT(plan && "dc_fft_forward_values: plan cannot be NULL");
+    DC_ASSERT(values && "dc_fft_forward_values: values cannot be NULL");
 
-    dc_complex_frac result = dc_frac_from_df(real, imag);
+    size_t n = plan->size;
+    double* re = plan->work;
+    double* im = re + n;
+    for (size_t i = 0; i < n; i++) {
+        re[i] = ((const double*)&values[i])[0];
+        im[i] = ((const double*)&values[i])[1];
+    }
+    dc_fft_run(plan, re, im, im + n, im + 2 * n);
+    for (size_t i = 0; i < n; i++) values[i] = dc_double_make(re[i], im[i]);
+}
 
-    df_release(&ac);
-    df_release(&bd);
-    df_release(&ad);
-    df_release(&bc);
-    df_release(&real);
-    df_release(&imag);
+DC_DEF void dc_fft_inverse_values(dc_fft_plan plan, double complex* values) {
+    DC_ASSERT(plan && "dc_fft_inverse_values: plan cannot be NULL");
+    DC_ASSERT(values && "dc_fft_inverse_values: values cannot be NULL");
 
-    return result;
+    size_t n = plan->size;
+    double* re = plan->work;
+    double* im = re + n;
+    for (size_t i = 0; i < n; i++) {
+        re[i] = ((const double*)&values[i])[0];
+        im[i] = ((const double*)&values[i])[1];
+    }
+    dc_fft_run_inverse(plan, re, im, im + n, im + 2 * n);
+    for (size_t i = 0; i < n; i++) values[i] = dc_double_make(re[i], im[i]);
 }
 
-DC_DEF dc_complex_frac dc_frac_div(dc_complex_frac a, dc_complex_frac b) {
-    DC_ASSERT(a && "dc_frac_div: first operand cannot be NULL");
-    DC_ASSERT(b && "dc_frac_div: second operand cannot be NULL");
-    DC_ASSERT(!dc_frac_is_zero(b) && "dc_frac_div: division by zero");
+DC_DEF void dc_fft_real_forward(dc_fft_plan plan, const double* input, double* out_real, double* out_imag) {
+    DC_ASSERT(plan && "dc_fft_real_forward: plan cannot be NULL");
+    DC_ASSERT(input && out_real && out_imag && "dc_fft_real_forward: buffers cannot be NULL");
 
-    // (a + bi) / (c + di) = ((ac + bd) / (c² + d²)) + ((bc - ad) / (c² + d²))i
-    df_frac c2 = df_mul(b->real, b->real);
-    df_frac d2 = df_mul(b->imag, b->imag);
-    df_frac denom = df_add(c2, d2);
+    size_t n = plan->size;
+    double* re = plan->work;
+    double* im = re + n;
 
-    df_frac ac = df_mul(a->real, b->real);
-    df_frac bd = df_mul(a->imag, b->imag);
-    df_frac bc = df_mul(a->imag, b->real);
-    df_frac ad = df_mul(a->real, b->imag);
+    if (!plan->half) {
+        // Odd sizes: full complex transform of the zero-extended input
+        for (size_t i = 0; i < n; i++) {
+            re[i] = input[i];
+            im[i] = 0.0;
+        }
+        dc_fft_run(plan, re, im, im + n, im + 2 * n);
+        memcpy(out_real, re, (n / 2 + 1) * sizeof(double));
+        memcpy(out_imag, im, (n / 2 + 1) * sizeof(double));
+        return;
+    }
 
-    df_frac real_num = df_add(ac, bd);
-    df_frac imag_num = df_sub(bc, ad);
+    // Pack even/odd samples as z[k] = x[2k] + i x[2k+1] and transform at half length
+    size_t h = n / 2;
+    for (size_t k = 0; k < h; k++) {
+        re[k] = input[2 * k];
+        im[k] = input[2 * k + 1];
+    }
+    dc_fft_run(plan->half, re, im, im + n, im + 2 * n);
+
+    // X[k] = E[k] + w^k O[k] with E = (Z[k] + conj Z[h-k]) / 2 and O = (Z[k] - conj Z[h-k]) / 2i
+    for (size_t k = 0; k <= h; k++) {
+        size_t j = k == 0 ? 0 : h - k;
+        size_t i = k == h ? 0 : k;
+        double even_re = 0.5 * (re[i] + re[j]), even_im = 0.5 * (im[i] - im[j]);
+        double odd_re = 0.5 * (im[i] + im[j]), odd_im = -0.5 * (re[i] - re[j]);
+        out_real[k] = even_re + odd_re * plan->real_re[k] - odd_im * plan->real_im[k];
+        out_imag[k] = even_im + odd_re * plan->real_im[k] + odd_im * plan->real_re[k];
+    }
+}
 
-    df_frac real = df_div(real_num, denom);
-    df_frac imag = df_div(imag_num, denom);
+DC_DEF void dc_fft_real_inverse(dc_fft_plan plan, const double* in_real, const double* in_imag, double* output) {
+    DC_ASSERT(plan && "dc_fft_real_inverse: plan cannot be NULL");
+    DC_ASSERT(in_real && in_imag && output && "dc_fft_real_inverse: buffers cannot be NULL");
+
+    size_t n = plan->size;
+    double* re = plan->work;
+    double* im = re + n;
+
+    if (!plan->half) {
+        // Odd sizes: rebuild the Hermitian spectrum and run a full inverse
+        re[0] = in_real[0];
+        im[0] = 0.0;
+        for (size_t k = 1; k <= n / 2; k++) {
+            re[k] = re[n - k] = in_real[k];
+            im[k] = in_imag[k];
+            im[n - k] = -in_imag[k];
+        }
+        dc_fft_run_inverse(plan, re, im, im + n, im + 2 * n);
+        memcpy(output, re, n * sizeof(double));
+        return;
+    }
 
-    dc_complex_frac result = dc_frac_from_df(real, imag);
+    // Z[k] = E[k] + i O[k] with E = (X[k] + conj X[h-k]) / 2 and O = (X[k] - conj X[h-k]) conj(w^k) / 2
+    size_t h = n / 2;
+    for (size_t k = 0; k < h; k++) {
+        double xr = in_real[k], xi = k == 0 ? 0.0 : in_imag[k];
+        double yr = in_real[h - k], yi = k == 0 ? 0.0 : -in_imag[h - k];
+        double even_re = 0.5 * (xr + yr), even_im = 0.5 * (xi + yi);
+        double dr = 0.5 * (xr - yr), di = 0.5 * (xi - yi);
+        double odd_re = dr * plan->real_re[k] + di * plan->real_im[k];
+        double odd_im = di * plan->real_re[k] - dr * plan->real_im[k];
+        re[k] = even_re - odd_im;
+        im[k] = even_im + odd_re;
+    }
+    dc_fft_run_inverse(plan->half, re, im, im + n, im + 2 * n);
+    for (size_t k = 0; k < h; k++) {
+        output[2 * k] = re[k];
+        output[2 * k + 1] = im[k];
+    }
+}
 
-    df_release(&c2);
-    df_release(&d2);
-    df_release(&denom);
-    df_release(&ac);
-    df_release(&bd);
-    df_release(&bc);
-    df_release(&ad);
-    df_release(&real_num);
-    df_release(&imag_num);
-    df_release(&real);
-    df_release(&imag);
+DC_DEF dc_double_array dc_double_array_fft(dc_double_array a) {
+    DC_ASSERT(a && "dc_double_array_fft: operand cannot be NULL");
 
+    dc_double_array result = dc_double_array_alloc(a->length);
+    dc_double_array_fft_into(result, a);
     return result;
 }
 
-DC_DEF dc_complex_frac dc_frac_negate(dc_complex_frac c) {
-    DC_ASSERT(c && "dc_frac_negate: operand cannot be NULL");
-
-    df_frac real = df_negate(c->real);
-    df_frac imag = df_negate(c->imag);
-    dc_complex_frac result = dc_frac_from_df(real, imag);
-    df_release(&real);
-    df_release(&imag);
+DC_DEF dc_double_array dc_double_array_ifft(dc_double_array a) {
+    DC_ASSERT(a && "dc_double_array_ifft: operand cannot be NULL");
 
+    dc_double_array result = dc_double_array_alloc(a->length);
+    dc_double_array_ifft_into(result, a);
     return result;
 }
 
-DC_DEF dc_complex_frac dc_frac_conj(dc_complex_frac c) {
-    DC_ASSERT(c && "dc_frac_conj: operand cannot be NULL");
+DC_DEF void dc_double_array_fft_into(dc_double_array dst, dc_double_array a) {
+    DC_ASSERT(dst && "dc_double_array_fft_into: destination cannot be NULL");
+    DC_ASSERT(a && "dc_double_array_fft_into: operand cannot be NULL");
+    DC_ASSERT(dst->length == a->length && "dc_double_array_fft_into: length mismatch");
+    if (a->length == 0) return;
 
-    df_frac real = df_retain(c->real);
-    df_frac imag = df_negate(c->imag);
-    dc_complex_frac result = dc_frac_from_df(real, imag);
-    df_release(&real);
-    df_release(&imag);
+    dc_fft_plan plan = dc_fft_plan_new(a->length);
+    if (dst != a) {
+        memcpy(dst->real, a->real, a->length * sizeof(double));
+        memcpy(dst->imag, a->imag, a->length * sizeof(double));
+    }
+    dc_fft_forward(plan, dst->real, dst->imag);
+    dc_fft_plan_release(&plan);
+}
 
-    return result;
+DC_DEF void dc_double_array_ifft_into(dc_double_array dst, dc_double_array a) {
+    DC_ASSERT(dst && "dc_double_array_ifft_into: destination cannot be NULL");
+    DC_ASSERT(a && "dc_double_array_ifft_into: operand cannot be NULL");
+    DC_ASSERT(dst->length == a->length && "dc_double_array_ifft_into: length mismatch");
+    if (a->length == 0) return;
+
+    dc_fft_plan plan = dc_fft_plan_new(a->length);
+    if (dst != a) {
+        memcpy(dst->real, a->real, a->length * sizeof(double));
+        memcpy(dst->imag, a->imag, a->length * sizeof(double));
+    }
+    dc_fft_inverse(plan, dst->real, dst->imag);
+    dc_fft_plan_release(&plan);
 }
 
-DC_DEF dc_complex_frac dc_frac_reciprocal(dc_complex_frac c) {
-    DC_ASSERT(c && "dc_frac_reciprocal: operand cannot be NULL");
-    DC_ASSERT(!dc_frac_is_zero(c) && "dc_frac_reciprocal: division by zero");
+// ============================================================================
+// GAUSSIAN INTEGER POLYNOMIAL IMPLEMENTATION
+// ============================================================================
 
-    df_frac one = df_one();
-    df_frac zero = df_zero();
-    dc_complex_frac num = dc_frac_from_df(one, zero);
-    dc_complex_frac result = dc_frac_div(num, c);
+// A prime p = c * 2^k + 1 below 2^31 with Montgomery constants for R = 2^32
+typedef struct dc_ntt_prime {
+    uint32_t p;
+    uint32_t neg_inv;  // -p^-1 mod 2^32
+    uint32_t r2;       // R^2 mod p
+} dc_ntt_prime;
+
+// Sign and base-2^32 magnitude digits of one coefficient component
+typedef struct dc_poly_part {
+    size_t offset;
+    size_t count;
+    bool negative;
+} dc_poly_part;
+
+static uint32_t dc_ntt_pow(uint64_t base, uint64_t exp, uint32_t p) {
+    uint64_t result = 1;
+    base %= p;
+    while (exp) {
+        if (exp & 1) result = result * base % p;
+        base = base * base % p;
+        exp >>= 1;
+    }
+    return (uint32_t)result;
+}
 
-    df_release(&one);
-    df_release(&zero);
-    dc_frac_release(&num);
+// Deterministic Miller-Rabin: bases 2, 7 and 61 cover every n < 2^32
+static bool dc_ntt_is_prime(uint32_t n) {
+    if (n < 2) return false;
+    static const uint32_t bases[] = {2, 7, 61};
+    uint32_t d = n - 1;
+    int shifts = 0;
+    while ((d & 1) == 0) {
+        d >>= 1;
+        shifts++;
+    }
+    for (size_t i = 0; i < 3; i++) {
+        if (bases[i] % n == 0) continue;
+        uint64_t x = dc_ntt_pow(bases[i], d, n);
+        if (x == 1 || x == n - 1) continue;
+        bool composite = true;
+        for (int r = 1; r < shifts && composite; r++) {
+            x = x * x % n;
+            if (x == n - 1) composite = false;
+        }
+        if (composite) return false;
+    }
+    return true;
+}
 
-    return result;
+static void dc_ntt_prime_init(dc_ntt_prime* m, uint32_t p) {
+    uint32_t inv = p;  // Newton iteration doubles the correct low bits each step
+    for (int i = 0; i < 5; i++) inv *= 2 - p * inv;
+    m->p = p;
+    m->neg_inv = 0u - inv;
+    uint64_t r = ((uint64_t)1 << 32) % p;
+    m->r2 = (uint32_t)(r * r % p);
 }
 
-DC_DEF df_frac dc_frac_real(dc_complex_frac c) {
-    DC_ASSERT(c && "dc_frac_real: operand cannot be NULL");
-    return df_retain(c->real);
+static inline uint32_t dc_ntt_mul(uint32_t a, uint32_t b, const dc_ntt_prime* m) {
+    uint64_t t = (uint64_t)a * b;
+    uint32_t q = (uint32_t)t * m->neg_inv;
+    uint64_t u = (t + (uint64_t)q * m->p) >> 32;
+    return (uint32_t)(u >= m->p ? u - m->p : u);
 }
 
-DC_DEF df_frac dc_frac_imag(dc_complex_frac c) {
-    DC_ASSERT(c && "dc_frac_imag: operand cannot be NULL");
-    return df_retain(c->imag);
+static inline uint32_t dc_ntt_add(uint32_t a, uint32_t b, uint32_t p) {
+    uint32_t s = a + b;
+    return s >= p ? s - p : s;
 }
 
-DC_DEF bool dc_frac_eq(dc_complex_frac a, dc_complex_frac b) {
-    DC_ASSERT(a && "dc_frac_eq: first operand cannot be NULL");
-    DC_ASSERT(b && "dc_frac_eq: second operand cannot be NULL");
+static inline uint32_t dc_ntt_sub(uint32_t a, uint32_t b, uint32_t p) {
+    return a >= b ? a - b : a + p - b;
+}
 
-    return df_eq(a->real, b->real) && df_eq(a->imag, b->imag);
+// Decimation in frequency: natural order in, bit-reversed order out
+static void dc_ntt_forward(uint32_t* a, size_t n, const uint32_t* roots, const dc_ntt_prime* m) {
+    for (size_t len = n; len >= 2; len >>= 1) {
+        size_t half = len / 2, step = n / len;
+        for (size_t start = 0; start < n; start += len) {
+            for (size_t j = 0; j < half; j++) {
+                uint32_t u = a[start + j], v = a[start + j + half];
+                a[start + j] = dc_ntt_add(u, v, m->p);
+                a[start + j + half] = dc_ntt_mul(dc_ntt_sub(u, v, m->p), roots[j * step], m);
+            }
+        }
+    }
 }
 
-DC_DEF bool dc_frac_is_zero(dc_complex_frac c) {
-    DC_ASSERT(c && "dc_frac_is_zero: operand cannot be NULL");
-    return df_is_zero(c->real) && df_is_zero(c->imag);
+// Decimation in time: bit-reversed order in, natural order out, unscaled
+static void dc_ntt_inverse(uint32_t* a, size_t n, const uint32_t* roots, const dc_ntt_prime* m) {
+    for (size_t len = 2; len <= n; len <<= 1) {
+        size_t half = len / 2, step = n / len;
+        for (size_t start = 0; start < n; start += len) {
+            for (size_t j = 0; j < half; j++) {
+                uint32_t u = a[start + j], v = dc_ntt_mul(a[start + j + half], roots[j * step], m);
+                a[start + j] = dc_ntt_add(u, v, m->p);
+                a[start + j + half] = dc_ntt_sub(u, v, m->p);
+            }
+        }
+    }
 }
 
-DC_DEF bool dc_frac_is_real(dc_complex_frac c) {
-    DC_ASSERT(c && "dc_frac_is_real: operand cannot be NULL");
-    return df_is_zero(c->imag);
+static size_t dc_poly_part_bits(dc_complex_int c, bool imag) {
+    if (c->is_small) {
+        int64_t v = imag ? c->small.imag : c->small.real;
+        uint64_t magnitude = v < 0 ? 0 - (uint64_t)v : (uint64_t)v;
+        size_t bits = 0;
+        while (magnitude) {
+            bits++;
+            magnitude >>= 1;
+        }
+        return bits;
+    }
+    di_int magnitude = di_abs(imag ? c->big.imag : c->big.real);
+    size_t bits = di_bit_length(magnitude);
+    di_release(&magnitude);
+    return bits;
 }
 
-DC_DEF bool dc_frac_is_imag(dc_complex_frac c) {
-    DC_ASSERT(c && "dc_frac_is_imag: operand cannot be NULL");
-    return df_is_zero(c->real);
+// Store the digits of one component at pool + *used
+static void dc_poly_split(dc_complex_int c, bool imag, dc_poly_part* part, uint32_t* pool, size_t* used) {
+    part->offset = *used;
+    part->count = 0;
+
+    if (c->is_small) {
+        int64_t v = imag ? c->small.imag : c->small.real;
+        uint64_t magnitude = v < 0 ? 0 - (uint64_t)v : (uint64_t)v;
+        part->negative = v < 0;
+        while (magnitude) {
+            pool[part->offset + part->count++] = (uint32_t)magnitude;
+            magnitude >>= 32;
+        }
+    } else {
+        di_int value = imag ? c->big.imag : c->big.real;
+        di_int mask = di_from_uint32(UINT32_MAX);
+        di_int rest = di_abs(value);
+        part->negative = di_is_negative(value);
+        while (!di_is_zero(rest)) {
+            di_int low = di_and(rest, mask);
+            di_int next = di_shift_right(rest, 32);
+            uint32_t digit = 0;
+            di_to_uint32(low, &digit);
+            pool[part->offset + part->count++] = digit;
+            di_release(&low);
+            di_release(&rest);
+            rest = next;
+        }
+        di_release(&rest);
+        di_release(&mask);
+    }
+    *used += part->count;
 }
 
-DC_DEF bool dc_frac_is_gaussian_int(dc_complex_frac c) {
-    DC_ASSERT(c && "dc_frac_is_gaussian_int: operand cannot be NULL");
-    return df_is_integer(c->real) && df_is_integer(c->imag);
+// Component residue in Montgomery form
+static uint32_t dc_poly_residue(const dc_poly_part* part, const uint32_t* pool, const dc_ntt_prime* m) {
+    uint64_t r = 0;
+    for (size_t k = part->count; k-- > 0;) {
+        r = ((r << 32) | pool[part->offset + k]) % m->p;
+    }
+    if (part->negative && r != 0) r = m->p - r;
+    return dc_ntt_mul((uint32_t)r, m->r2, m);
 }
 
-DC_DEF char* dc_frac_to_string(dc_complex_frac c) {
-    DC_ASSERT(c && "dc_frac_to_string: operand cannot be NULL");
+static void dc_poly_mul_schoolbook(dc_complex_int* result, const dc_complex_int* a, size_t a_len,
+                                   const dc_complex_int* b, size_t b_len) {
+    for (size_t k = 0; k < a_len + b_len - 1; k++) result[k] = dc_int_zero();
+    for (size_t i = 0; i < a_len; i++) {
+        for (size_t j = 0; j < b_len; j++) {
+            dc_complex_int term = dc_int_mul(a[i], b[j]);
+            dc_int_add_into(&result[i + j], result[i + j], term);
+            dc_int_release(&term);
+        }
+    }
+}
 
-    char* real_str = df_to_string(c->real);
-    char* imag_str = df_to_string(c->imag);
+// Load the residues of re + unit * im and re - unit * im, zero-padded to n
+static void dc_poly_load(uint32_t* plus, uint32_t* minus, size_t n, const dc_poly_part* parts, size_t len,
+                         const uint32_t* pool, uint32_t unit, const dc_ntt_prime* m) {
+    for (size_t k = 0; k < len; k++) {
+        uint32_t re = dc_poly_residue(&parts[2 * k], pool, m);
+        uint32_t im = dc_ntt_mul(dc_poly_residue(&parts[2 * k + 1], pool, m), unit, m);
+        plus[k] = dc_ntt_add(re, im, m->p);
+        minus[k] = dc_ntt_sub(re, im, m->p);
+    }
+    memset(plus + len, 0, (n - len) * sizeof(uint32_t));
+    memset(minus + len, 0, (n - len) * sizeof(uint32_t));
+}
 
-    size_t len = strlen(real_str) + strlen(imag_str) + 10;
-    char* result = DC_MALLOC(len);
-    DC_ASSERT(result && "dc_frac_to_string: allocation failed");
+DC_DEF void dc_int_poly_mul(dc_complex_int* result, const dc_complex_int* a, size_t a_len, const dc_complex_int* b,
+                            size_t b_len) {
+    DC_ASSERT((a || a_len == 0) && "dc_int_poly_mul: a cannot be NULL");
+    DC_ASSERT((b || b_len == 0) && "dc_int_poly_mul: b cannot be NULL");
+    if (a_len == 0 || b_len == 0) return;
+    DC_ASSERT(result && "dc_int_poly_mul: result cannot be NULL");
+
+    size_t out_len = a_len + b_len - 1;
+    size_t shorter = a_len < b_len ? a_len : b_len;
+    if (shorter < DC_POLY_NTT_THRESHOLD) {
+        dc_poly_mul_schoolbook(result, a, a_len, b, b_len);
+        return;
+    }
 
-    bool real_zero = df_is_zero(c->real);
-    bool imag_zero = df_is_zero(c->imag);
-    bool imag_neg = df_is_negative(c->imag);
+    // |Re|, |Im| of every product coefficient stay below 2^bound
+    size_t a_bits = 0, b_bits = 0, bound = 2;
+    for (size_t k = 0; k < a_len; k++) {
+        for (int part = 0; part < 2; part++) {
+            size_t bits = dc_poly_part_bits(a[k], part);
+            if (bits > a_bits) a_bits = bits;
+        }
+    }
+    for (size_t k = 0; k < b_len; k++) {
+        for (int part = 0; part < 2; part++) {
+            size_t bits = dc_poly_part_bits(b[k], part);
+            if (bits > b_bits) b_bits = bits;
+        }
+    }
+    while (((size_t)1 << (bound - 1)) < shorter) bound++;
+    bound += a_bits + b_bits;
 
-    if (real_zero && imag_zero) {
-        strcpy(result, "0");
-    } else if (imag_zero) {
-        strcpy(result, real_str);
-    } else if (real_zero) {
-        df_frac one = df_one();
-        df_frac neg_one = df_neg_one();
-        if (df_cmp(c->imag, one) == 0) {
-            strcpy(result, "i");
-        } else if (df_cmp(c->imag, neg_one) == 0) {
-            strcpy(result, "-i");
-        } else {
-            sprintf(result, "%si", imag_str);
+    // Each extra prime costs a full set of transforms, so wide coefficients need longer operands to pay off
+    if ((double)shorter < DC_POLY_NTT_THRESHOLD * sqrt(1.0 + (double)bound / 64.0)) {
+        dc_poly_mul_schoolbook(result, a, a_len, b, b_len);
+        return;
+    }
+
+    size_t n = 4;
+    while (n < out_len) n <<= 1;
+
+    // Primes 1 mod n in [2^30, 2^31); their product must exceed 2^(bound + 2) for a signed CRT lift
+    size_t prime_count = 0, prime_capacity = (bound + 2) / 30 + 1;
+    dc_ntt_prime* primes = DC_MALLOC(prime_capacity * sizeof(dc_ntt_prime));
+    DC_ASSERT(primes && "dc_int_poly_mul: allocation failed");
+    for (uint64_t c = (((uint64_t)1 << 31) - 2) / n; c > 0 && 30 * prime_count < bound + 2; c--) {
+        uint64_t p = c * n + 1;
+        if (p < ((uint64_t)1 << 30)) break;
+        if (dc_ntt_is_prime((uint32_t)p)) dc_ntt_prime_init(&primes[prime_count++], (uint32_t)p);
+    }
+    if (30 * prime_count < bound + 2) {
+        // Transform too long for enough word-sized primes
+        DC_FREE(primes);
+        dc_poly_mul_schoolbook(result, a, a_len, b, b_len);
+        return;
+    }
+
+    // Split every component into base-2^32 digits once
+    size_t digits = 0;
+    dc_poly_part* parts = DC_MALLOC(2 * (a_len + b_len) * sizeof(dc_poly_part));
+    uint32_t* pool = DC_MALLOC((2 * (a_len + b_len) * ((a_bits > b_bits ? a_bits : b_bits) / 32 + 1)) *
+                               sizeof(uint32_t));
+    DC_ASSERT(parts && pool && "dc_int_poly_mul: allocation failed");
+    for (size_t k = 0; k < a_len; k++) {
+        dc_poly_split(a[k], false, &parts[2 * k], pool, &digits);
+        dc_poly_split(a[k], true, &parts[2 * k + 1], pool, &digits);
+    }
+    dc_poly_part* b_parts = parts + 2 * a_len;
+    for (size_t k = 0; k < b_len; k++) {
+        dc_poly_split(b[k], false, &b_parts[2 * k], pool, &digits);
+        dc_poly_split(b[k], true, &b_parts[2 * k + 1], pool, &digits);
+    }
+
+    // Per prime: convolve the images under sqrt(-1) and -sqrt(-1), then separate Re and Im
+    uint32_t* residues = DC_MALLOC(2 * prime_count * out_len * sizeof(uint32_t));
+    uint32_t* work = DC_MALLOC((5 * n) * sizeof(uint32_t));
+    DC_ASSERT(residues && work && "dc_int_poly_mul: allocation failed");
+    uint32_t *plus = work, *minus = work + n, *b_plus = work + 2 * n, *b_minus = work + 3 * n;
+    uint32_t *roots = work + 4 * n, *inv_roots = roots + n / 2;
+    bool square = a == b && a_len == b_len;
+
+    for (size_t i = 0; i < prime_count; i++) {
+        const dc_ntt_prime* m = &primes[i];
+        uint32_t p = m->p;
+
+        // Find a non-residue h; h^((p-1)/n) then has order exactly n
+        uint32_t h = 2;
+        while (dc_ntt_pow(h, (p - 1) / 2, p) != p - 1) h++;
+        uint32_t w = dc_ntt_pow(h, (p - 1) / n, p);
+        uint32_t w_inv = dc_ntt_pow(w, p - 2, p);
+        uint32_t unit = dc_ntt_pow(w, n / 4, p);
+        roots[0] = inv_roots[0] = dc_ntt_mul(1, m->r2, m);
+        uint32_t w_mont = dc_ntt_mul(w, m->r2, m), w_inv_mont = dc_ntt_mul(w_inv, m->r2, m);
+        for (size_t j = 1; j < n / 2; j++) {
+            roots[j] = dc_ntt_mul(roots[j - 1], w_mont, m);
+            inv_roots[j] = dc_ntt_mul(inv_roots[j - 1], w_inv_mont, m);
         }
-        df_release(&one);
-        df_release(&neg_one);
-    } else {
-        df_frac one = df_one();
-        df_frac neg_one = df_neg_one();
-        if (df_cmp(c->imag, one) == 0) {
-            sprintf(result, "%s+i", real_str);
-        } else if (df_cmp(c->imag, neg_one) == 0) {
-            sprintf(result, "%s-i", real_str);
-        } else if (imag_neg) {
-            sprintf(result, "%s%si", real_str, imag_str);
+        uint32_t unit_mont = dc_ntt_mul(unit, m->r2, m);
+
+        dc_poly_load(plus, minus, n, parts, a_len, pool, unit_mont, m);
+        dc_ntt_forward(plus, n, roots, m);
+        dc_ntt_forward(minus, n, roots, m);
+        if (square) {
+            for (size_t k = 0; k < n; k++) {
+                plus[k] = dc_ntt_mul(plus[k], plus[k], m);
+                minus[k] = dc_ntt_mul(minus[k], minus[k], m);
+            }
         } else {
-            sprintf(result, "%s+%si", real_str, imag_str);
+            dc_poly_load(b_plus, b_minus, n, b_parts, b_len, pool, unit_mont, m);
+            dc_ntt_forward(b_plus, n, roots, m);
+            dc_ntt_forward(b_minus, n, roots, m);
+            for (size_t k = 0; k < n; k++) {
+                plus[k] = dc_ntt_mul(plus[k], b_plus[k], m);
+                minus[k] = dc_ntt_mul(minus[k], b_minus[k], m);
+            }
+        }
+        dc_ntt_inverse(plus, n, inv_roots, m);
+        dc_ntt_inverse(minus, n, inv_roots, m);
+
+        // Re = (P + M) / 2n and Im = (P - M) / (2n sqrt(-1)); plain constants also leave Montgomery form
+        uint32_t two_n = (uint32_t)(2 * (uint64_t)n % p);
+        uint32_t re_scale = dc_ntt_pow(two_n, p - 2, p);
+        uint32_t im_scale = dc_ntt_pow((uint64_t)two_n * unit % p, p - 2, p);
+        uint32_t* re_out = residues + 2 * i * out_len;
+        uint32_t* im_out = re_out + out_len;
+        for (size_t k = 0; k < out_len; k++) {
+            re_out[k] = dc_ntt_mul(dc_ntt_add(plus[k], minus[k], p), re_scale, m);
+            im_out[k] = dc_ntt_mul(dc_ntt_sub(plus[k], minus[k], p), im_scale, m);
+        }
+    }
+    DC_FREE(work);
+    DC_FREE(pool);
+    DC_FREE(parts);
+
+    // Garner: mixed-radix digits with the top digit centered give the signed value directly.
+    // Inverses are kept in Montgomery form, so multiplying by them maps plain values to plain values.
+    uint32_t* inverses = DC_MALLOC((prime_count * prime_count + 2 * prime_count) * sizeof(uint32_t));
+    DC_ASSERT(inverses && "dc_int_poly_mul: allocation failed");
+    uint32_t* digit = inverses + prime_count * prime_count;
+    for (size_t i = 0; i < prime_count; i++) {
+        for (size_t j = 0; j < i; j++) {
+            uint32_t inverse = dc_ntt_pow(primes[j].p, primes[i].p - 2, primes[i].p);
+            inverses[i * prime_count + j] = dc_ntt_mul(inverse, primes[i].r2, &primes[i]);
         }
-        df_release(&one);
-        df_release(&neg_one);
     }
 
-    free(real_str);
-    free(imag_str);
+    bool fits_int64 = bound <= 63;
+    for (size_t k = 0; k < out_len; k++) {
+        int64_t small[2] = {0, 0};
+        di_int big[2] = {NULL, NULL};
+        for (size_t part = 0; part < 2; part++) {
+            for (size_t i = 0; i < prime_count; i++) {
+                uint32_t p = primes[i].p;
+                uint32_t t = residues[(2 * i + part) * out_len + k];
+                for (size_t j = 0; j < i; j++) {
+                    // Digits are below 2^31 <= 2p, so one subtraction reduces them
+                    uint32_t d = digit[j] >= p ? digit[j] - p : digit[j];
+                    t = dc_ntt_mul(dc_ntt_sub(t, d, p), inverses[i * prime_count + j], &primes[i]);
+                }
+                digit[i] = t;
+            }
+            uint32_t top_prime = primes[prime_count - 1].p;
+            int64_t top = digit[prime_count - 1];
+            if (top > (int64_t)(top_prime / 2)) top -= top_prime;
+
+            if (fits_int64) {
+                uint64_t x = (uint64_t)top;
+                for (size_t i = prime_count - 1; i-- > 0;) x = x * primes[i].p + digit[i];
+                small[part] = (int64_t)x;
+            } else {
+                di_int x = di_from_int64(top);
+                for (size_t i = prime_count - 1; i-- > 0;) {
+                    di_int scaled = di_mul_i32(x, (int32_t)primes[i].p);
+                    di_release(&x);
+                    x = di_add_i32(scaled, (int32_t)digit[i]);
+                    di_release(&scaled);
+                }
+                big[part] = x;
+            }
+        }
+        if (fits_int64) {
+            result[k] = dc_int_from_ints(small[0], small[1]);
+        } else {
+            result[k] = dc_int_from_di(big[0], big[1]);
+            di_release(&big[0]);
+            di_release(&big[1]);
+        }
+    }
 
-    return result;
+    DC_FREE(inverses);
+    DC_FREE(residues);
+    DC_FREE(primes);
 }
 
 // ============================================================================
-// DOUBLE COMPLEX IMPLEMENTATION
+// TYPE CONVERSION IMPLEMENTATION
 // ============================================================================
 
-DC_DEF dc_complex_double dc_double_from_doubles(double real, double imag) {
-    dc_complex_double result = DC_MALLOC(sizeof(struct dc_complex_double_internal));
-    DC_ASSERT(result && "dc_double_from_doubles: allocation failed");
+DC_DEF dc_complex_frac dc_int_to_frac(dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_to_frac: operand cannot be NULL");
 
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->value = real + imag * I;
+    df_frac real, imag;
+    if (c->is_small) {
+        real = df_from_ints(c->small.real, 1);
+        imag = df_from_ints(c->small.imag, 1);
+    } else {
+        di_int one = di_one();
+        real = df_from_di(c->big.real, one);
+        imag = df_from_di(c->big.imag, one);
+        di_release(&one);
+    }
+    dc_complex_frac result = dc_frac_from_df(real, imag);
+
+    df_release(&real);
+    df_release(&imag);
 
     return result;
 }
 
-DC_DEF dc_complex_double dc_double_from_polar(double magnitude, double angle) {
-    dc_complex_double result = DC_MALLOC(sizeof(struct dc_complex_double_internal));
-    DC_ASSERT(result && "dc_double_from_polar: allocation failed");
+DC_DEF dc_complex_double dc_int_to_double(dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_to_double: operand cannot be NULL");
 
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->value = magnitude * cexp(I * angle);
+    if (c->is_small) {
+        return dc_double_from_doubles((double)c->small.real, (double)c->small.imag);
+    }
 
-    return result;
-}
+    double real = di_to_double(c->big.real);
+    double imag = di_to_double(c->big.imag);
 
-DC_DEF dc_complex_double dc_double_zero(void) {
-    if (!dc_double_zero_singleton) {
-        dc_double_zero_singleton = dc_double_from_doubles(0.0, 0.0);
-        DC_ATOMIC_STORE(&dc_double_zero_singleton->ref_count, SIZE_MAX/2);
-    }
-    return dc_double_retain(dc_double_zero_singleton);
+    return dc_double_from_doubles(real, imag);
 }
 
-DC_DEF dc_complex_double dc_double_one(void) {
-    if (!dc_double_one_singleton) {
-        dc_double_one_singleton = dc_double_from_doubles(1.0, 0.0);
-        DC_ATOMIC_STORE(&dc_double_one_singleton->ref_count, SIZE_MAX/2);
-    }
-    return dc_double_retain(dc_double_one_singleton);
-}
+DC_DEF dc_complex_double dc_frac_to_double(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_to_double: operand cannot be NULL");
 
-DC_DEF dc_complex_double dc_double_i(void) {
-    if (!dc_double_i_singleton) {
-        dc_double_i_singleton = dc_double_from_doubles(0.0, 1.0);
-        DC_ATOMIC_STORE(&dc_double_i_singleton->ref_count, SIZE_MAX/2);
-    }
-    return dc_double_retain(dc_double_i_singleton);
-}
+    // Unreduced components can overflow a double even when their quotient does not
+    dc_complex_frac reduced = dc_frac_normalize(c);
+    double real = df_to_double(reduced->real);
+    double imag = df_to_double(reduced->imag);
+    dc_frac_release(&reduced);
 
-DC_DEF dc_complex_double dc_double_neg_one(void) {
-    if (!dc_double_neg_one_singleton) {
-        dc_double_neg_one_singleton = dc_double_from_doubles(-1.0, 0.0);
-        DC_ATOMIC_STORE(&dc_double_neg_one_singleton->ref_count, SIZE_MAX/2);
-    }
-    return dc_double_retain(dc_double_neg_one_singleton);
+    return dc_double_from_doubles(real, imag);
 }
 
-DC_DEF dc_complex_double dc_double_neg_i(void) {
-    if (!dc_double_neg_i_singleton) {
-        dc_double_neg_i_singleton = dc_double_from_doubles(0.0, -1.0);
-        DC_ATOMIC_STORE(&dc_double_neg_i_singleton->ref_count, SIZE_MAX/2);
-    }
-    return dc_double_retain(dc_double_neg_i_singleton);
-}
+DC_DEF dc_complex_int dc_frac_to_int(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_to_int: operand cannot be NULL");
 
-DC_DEF dc_complex_double dc_double_retain(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_retain: cannot retain NULL");
-    DC_ATOMIC_FETCH_ADD(&c->ref_count, 1);
-    return c;
+    // Convert to double and round
+    dc_complex_frac reduced = dc_frac_normalize(c);
+    double real = df_to_double(reduced->real);
+    double imag = df_to_double(reduced->imag);
+    dc_frac_release(&reduced);
+
+    int64_t real_rounded = (int64_t)round(real);
+    int64_t imag_rounded = (int64_t)round(imag);
+
+    return dc_int_from_ints(real_rounded, imag_rounded);
 }
 
-DC_DEF void dc_double_release(dc_complex_double* c) {
-    if (!c || !*c) return;
+DC_DEF dc_complex_int dc_double_to_int(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_to_int: operand cannot be NULL");
 
-    size_t old_count = DC_ATOMIC_FETCH_SUB(&(*c)->ref_count, 1);
-    if (old_count == 1) {
-        // Don't free singletons
-        if (*c == dc_double_zero_singleton || *c == dc_double_one_singleton ||
-            *c == dc_double_i_singleton || *c == dc_double_neg_one_singleton ||
-            *c == dc_double_neg_i_singleton) {
-            *c = NULL;
-            return;
-        }
+    double real = creal(c->value);
+    double imag = cimag(c->value);
 
-        DC_FREE(*c);
-    }
-    *c = NULL;
-}
+    int64_t real_rounded = (int64_t)round(real);
+    int64_t imag_rounded = (int64_t)round(imag);
 
-DC_DEF dc_complex_double dc_double_copy(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_copy: cannot copy NULL");
-    return dc_double_from_doubles(creal(c->value), cimag(c->value));
+    return dc_int_from_ints(real_rounded, imag_rounded);
 }
 
-DC_DEF dc_complex_double dc_double_add(dc_complex_double a, dc_complex_double b) {
-    DC_ASSERT(a && "dc_double_add: first operand cannot be NULL");
-    DC_ASSERT(b && "dc_double_add: second operand cannot be NULL");
+DC_DEF dc_complex_frac dc_double_to_frac(dc_complex_double c, int64_t max_denominator) {
+    DC_ASSERT(c && "dc_double_to_frac: operand cannot be NULL");
+    DC_ASSERT(max_denominator > 0 && "dc_double_to_frac: max_denominator must be positive");
+
+    double real = creal(c->value);
+    double imag = cimag(c->value);
+
+    df_frac real_frac = df_from_double(real, max_denominator);
+    df_frac imag_frac = df_from_double(imag, max_denominator);
 
-    dc_complex_double result = DC_MALLOC(sizeof(struct dc_complex_double_internal));
-    DC_ASSERT(result && "dc_double_add: allocation failed");
+    dc_complex_frac result = dc_frac_from_df(real_frac, imag_frac);
 
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->value = a->value + b->value;
+    df_release(&real_frac);
+    df_release(&imag_frac);
 
     return result;
 }
 
-DC_DEF dc_complex_double dc_double_sub(dc_complex_double a, dc_complex_double b) {
-    DC_ASSERT(a && "dc_double_sub: first operand cannot be NULL");
-    DC_ASSERT(b && "dc_double_sub: second operand cannot be NULL");
-
-    dc_complex_double result = DC_MALLOC(sizeof(struct dc_complex_double_internal));
-    DC_ASSERT(result && "dc_double_sub: allocation failed");
+// ============================================================================
+// SERIALIZATION IMPLEMENTATION
+// ============================================================================
 
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->value = a->value - b->value;
+enum { DC_SERIAL_INT = 1, DC_SERIAL_FRAC, DC_SERIAL_FRAC_LAZY, DC_SERIAL_CFRAC, DC_SERIAL_DOUBLE };
 
-    return result;
-}
+#define DC_SERIAL_TAG(kind) ((uint8_t)(DC_SERIAL_VERSION << 4 | (kind)))
 
-DC_DEF dc_complex_double dc_double_mul(dc_complex_double a, dc_complex_double b) {
-    DC_ASSERT(a && "dc_double_mul: first operand cannot be NULL");
-    DC_ASSERT(b && "dc_double_mul: second operand cannot be NULL");
+// Limb arrays up to this length are staged on the stack
+#define DC_SERIAL_STACK_LIMBS 64
 
-    dc_complex_double result = DC_MALLOC(sizeof(struct dc_complex_double_internal));
-    DC_ASSERT(result && "dc_double_mul: allocation failed");
+// An encoded integer, still pointing into the caller's buffer
+typedef struct {
+    const uint8_t* limbs;
+    size_t count;
+    bool negative;
+} dc_serial_integer;
 
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->value = a->value * b->value;
+static size_t dc_varint_size(uint64_t value) {
+    size_t size = 1;
+    for (; value >= 0x80; value >>= 7) size++;
+    return size;
+}
 
-    return result;
+static uint8_t* dc_varint_put(uint8_t* p, uint64_t value) {
+    for (; value >= 0x80; value >>= 7) *p++ = (uint8_t)(value | 0x80);
+    *p++ = (uint8_t)value;
+    return p;
 }
 
-DC_DEF dc_complex_double dc_double_div(dc_complex_double a, dc_complex_double b) {
-    DC_ASSERT(a && "dc_double_div: first operand cannot be NULL");
-    DC_ASSERT(b && "dc_double_div: second operand cannot be NULL");
-    DC_ASSERT(!dc_double_is_zero(b) && "dc_double_div: division by zero");
+static bool dc_varint_get(const uint8_t** p, const uint8_t* end, uint64_t* value) {
+    uint64_t result = 0;
+    for (unsigned shift = 0; shift < 64 && *p < end; shift += 7) {
+        uint8_t byte = *(*p)++;
+        result |= (uint64_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            *value = result;
+            return true;
+        }
+    }
+    return false;
+}
 
-    dc_complex_double result = DC_MALLOC(sizeof(struct dc_complex_double_internal));
-    DC_ASSERT(result && "dc_double_div: allocation failed");
+static uint8_t* dc_serial_put_u32(uint8_t* p, uint32_t value) {
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+    return p + 4;
+}
 
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->value = a->value / b->value;
+static uint32_t dc_serial_get_u32(const uint8_t* p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
 
-    return result;
+static uint64_t dc_serial_magnitude(int64_t value) {
+    return value < 0 ? 0 - (uint64_t)value : (uint64_t)value;
 }
 
-DC_DEF dc_complex_double dc_double_negate(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_negate: operand cannot be NULL");
+static size_t dc_serial_int64_limbs(int64_t value) {
+    uint64_t magnitude = dc_serial_magnitude(value);
+    return magnitude == 0 ? 0 : magnitude <= UINT32_MAX ? 1 : 2;
+}
 
-    dc_complex_double result = DC_MALLOC(sizeof(struct dc_complex_double_internal));
-    DC_ASSERT(result && "dc_double_negate: allocation failed");
+static size_t dc_serial_int64_size(int64_t value) {
+    size_t limbs = dc_serial_int64_limbs(value);
+    return dc_varint_size(limbs << 1) + 4 * limbs;
+}
 
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->value = -c->value;
+static uint8_t* dc_serial_put_int64(uint8_t* p, int64_t value) {
+    size_t limbs = dc_serial_int64_limbs(value);
+    uint64_t magnitude = dc_serial_magnitude(value);
+    p = dc_varint_put(p, (uint64_t)limbs << 1 | (value < 0));
+    for (size_t k = 0; k < limbs; k++, magnitude >>= 32) p = dc_serial_put_u32(p, (uint32_t)magnitude);
+    return p;
+}
 
-    return result;
+// Values that fit int64_t take the fixed-width path; only larger ones are split into limbs
+static size_t dc_serial_di_size(di_int x) {
+    int64_t small;
+    if (di_to_int64(x, &small)) return dc_serial_int64_size(small);
+    size_t limbs = dc_di_limb_len(x);
+    return dc_varint_size((uint64_t)limbs << 1) + 4 * limbs;
 }
 
-DC_DEF dc_complex_double dc_double_conj(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_conj: operand cannot be NULL");
+static uint8_t* dc_serial_put_di(uint8_t* p, di_int x) {
+    int64_t small;
+    if (di_to_int64(x, &small)) return dc_serial_put_int64(p, small);
 
-    dc_complex_double result = DC_MALLOC(sizeof(struct dc_complex_double_internal));
-    DC_ASSERT(result && "dc_double_conj: allocation failed");
+    size_t limbs = dc_di_limb_len(x);
+    uint32_t stack[DC_SERIAL_STACK_LIMBS];
+    uint32_t* buffer = limbs <= DC_SERIAL_STACK_LIMBS ? stack : DC_MALLOC(limbs * sizeof(uint32_t));
+    DC_ASSERT(buffer && "dc_serial_put_di: allocation failed");
 
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->value = conj(c->value);
+    dc_di_to_limbs(x, buffer, limbs);
+    p = dc_varint_put(p, (uint64_t)limbs << 1 | di_is_negative(x));
+    for (size_t k = 0; k < limbs; k++) p = dc_serial_put_u32(p, buffer[k]);
 
-    return result;
+    if (buffer != stack) DC_FREE(buffer);
+    return p;
 }
 
-DC_DEF dc_complex_double dc_double_exp(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_exp: operand cannot be NULL");
-
-    dc_complex_double result = DC_MALLOC(sizeof(struct dc_complex_double_internal));
-    DC_ASSERT(result && "dc_double_exp: allocation failed");
-
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->value = cexp(c->value);
+static bool dc_serial_get_integer(const uint8_t** p, const uint8_t* end, dc_serial_integer* out) {
+    uint64_t header;
+    if (!dc_varint_get(p, end, &header)) return false;
+    uint64_t count = header >> 1;
+    if (count > (uint64_t)(end - *p) / 4) return false;
+
+    out->limbs = *p;
+    out->count = (size_t)count;
+    out->negative = header & 1;
+    *p += 4 * out->count;
+    return true;
+}
 
-    return result;
+// Significant limbs of an encoded integer (high zero limbs are tolerated on input)
+static size_t dc_serial_integer_len(const dc_serial_integer* in) {
+    size_t count = in->count;
+    while (count > 0 && dc_serial_get_u32(in->limbs + 4 * (count - 1)) == 0) count--;
+    return count;
 }
 
-DC_DEF dc_complex_double dc_double_log(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_log: operand cannot be NULL");
-    DC_ASSERT(!dc_double_is_zero(c) && "dc_double_log: log of zero");
+static bool dc_serial_integer_to_int64(const dc_serial_integer* in, int64_t* out) {
+    size_t count = dc_serial_integer_len(in);
+    if (count > 2) return false;
 
-    dc_complex_double result = DC_MALLOC(sizeof(struct dc_complex_double_internal));
-    DC_ASSERT(result && "dc_double_log: allocation failed");
+    uint64_t magnitude = 0;
+    for (size_t k = count; k-- > 0;) magnitude = magnitude << 32 | dc_serial_get_u32(in->limbs + 4 * k);
 
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->value = clog(c->value);
+    if (in->negative) {
+        if (magnitude > (uint64_t)INT64_MAX + 1) return false;
+        *out = magnitude == (uint64_t)INT64_MAX + 1 ? INT64_MIN : -(int64_t)magnitude;
+    } else {
+        if (magnitude > INT64_MAX) return false;
+        *out = (int64_t)magnitude;
+    }
+    return true;
+}
 
+// dc_limbs_to_di() over encoded limbs, read in place from the input buffer
+static di_int dc_serial_limbs_to_di(const uint8_t* limbs, size_t len) {
+    if (len <= 2) {
+        uint64_t value = len == 0 ? 0 : dc_serial_get_u32(limbs);
+        if (len == 2) value |= (uint64_t)dc_serial_get_u32(limbs + 4) << 32;
+        return di_from_uint64(value);
+    }
+    size_t half = len / 2;
+    di_int high = dc_serial_limbs_to_di(limbs + 4 * half, len - half);
+    di_int low = dc_serial_limbs_to_di(limbs, half);
+    di_int top = di_shift_left(high, 32 * half);
+    di_int result = di_add(top, low);
+    di_release(&top);
+    di_release(&low);
+    di_release(&high);
     return result;
 }
 
-DC_DEF dc_complex_double dc_double_pow(dc_complex_double a, dc_complex_double b) {
-    DC_ASSERT(a && "dc_double_pow: base cannot be NULL");
-    DC_ASSERT(b && "dc_double_pow: exponent cannot be NULL");
+static di_int dc_serial_integer_to_di(const dc_serial_integer* in) {
+    int64_t small;
+    if (dc_serial_integer_to_int64(in, &small)) return di_from_int64(small);
 
-    dc_complex_double result = DC_MALLOC(sizeof(struct dc_complex_double_internal));
-    DC_ASSERT(result && "dc_double_pow: allocation failed");
+    di_int result = dc_serial_limbs_to_di(in->limbs, dc_serial_integer_len(in));
+    if (in->negative) {
+        di_int negated = di_negate(result);
+        di_release(&result);
+        result = negated;
+    }
+    return result;
+}
 
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->value = cpow(a->value, b->value);
+// Denominators must be positive; a sign bit on zero is accepted as plain zero elsewhere
+static bool dc_serial_integer_is_positive(const dc_serial_integer* in) {
+    return !in->negative && dc_serial_integer_len(in) > 0;
+}
 
-    return result;
+// A reduced part has gcd(num, den) == 1, so a decoded value matches what the constructors build
+static bool dc_serial_coprime(di_int num, di_int den) {
+    if (di_is_one(den)) return true;
+    di_int g = di_gcd(num, den);
+    bool coprime = di_is_one(g);
+    di_release(&g);
+    return coprime;
 }
 
-DC_DEF dc_complex_double dc_double_sqrt(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_sqrt: operand cannot be NULL");
+// Reads the tag and `count` integers; false on any truncation or a different tag
+static bool dc_serial_get_integers(const uint8_t* buffer, size_t length, uint8_t tag, dc_serial_integer* out,
+                                   size_t count, size_t* consumed) {
+    if (!buffer || length == 0 || buffer[0] != tag) return false;
 
-    dc_complex_double result = DC_MALLOC(sizeof(struct dc_complex_double_internal));
-    DC_ASSERT(result && "dc_double_sqrt: allocation failed");
+    const uint8_t* p = buffer + 1;
+    const uint8_t* end = buffer + length;
+    for (size_t k = 0; k < count; k++) {
+        if (!dc_serial_get_integer(&p, end, &out[k])) return false;
+    }
+    *consumed = (size_t)(p - buffer);
+    return true;
+}
 
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->value = csqrt(c->value);
+DC_DEF size_t dc_int_serialized_size(dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_serialized_size: operand cannot be NULL");
 
-    return result;
+    if (c->is_small) return 1 + dc_serial_int64_size(c->small.real) + dc_serial_int64_size(c->small.imag);
+    return 1 + dc_serial_di_size(c->big.real) + dc_serial_di_size(c->big.imag);
 }
 
-DC_DEF dc_complex_double dc_double_sin(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_sin: operand cannot be NULL");
+DC_DEF size_t dc_int_serialize(dc_complex_int c, uint8_t* buffer, size_t capacity) {
+    size_t size = dc_int_serialized_size(c);
+    if (size > capacity) return 0;
+    DC_ASSERT(buffer && "dc_int_serialize: buffer cannot be NULL");
+
+    uint8_t* p = buffer;
+    *p++ = DC_SERIAL_TAG(DC_SERIAL_INT);
+    if (c->is_small) {
+        p = dc_serial_put_int64(p, c->small.real);
+        dc_serial_put_int64(p, c->small.imag);
+    } else {
+        p = dc_serial_put_di(p, c->big.real);
+        dc_serial_put_di(p, c->big.imag);
+    }
+    return size;
+}
 
-    dc_complex_double result = DC_MALLOC(sizeof(struct dc_complex_double_internal));
-    DC_ASSERT(result && "dc_double_sin: allocation failed");
+DC_DEF dc_complex_int dc_int_deserialize(const uint8_t* buffer, size_t length, size_t* consumed) {
+    dc_serial_integer parts[2];
+    size_t size;
+    if (!dc_serial_get_integers(buffer, length, DC_SERIAL_TAG(DC_SERIAL_INT), parts, 2, &size)) return NULL;
 
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->value = csin(c->value);
+    dc_complex_int result;
+    int64_t real, imag;
+    if (dc_serial_integer_to_int64(&parts[0], &real) && dc_serial_integer_to_int64(&parts[1], &imag)) {
+        result = dc_int_from_ints(real, imag);
+    } else {
+        di_int big_real = dc_serial_integer_to_di(&parts[0]);
+        di_int big_imag = dc_serial_integer_to_di(&parts[1]);
+        result = dc_int_from_di(big_real, big_imag);
+        di_release(&big_real);
+        di_release(&big_imag);
+    }
 
+    if (consumed) *consumed = size;
     return result;
 }
 
-DC_DEF dc_complex_double dc_double_cos(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_cos: operand cannot be NULL");
+DC_DEF size_t dc_frac_serialized_size(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_serialized_size: operand cannot be NULL");
 
-    dc_complex_double result = DC_MALLOC(sizeof(struct dc_complex_double_internal));
-    DC_ASSERT(result && "dc_double_cos: allocation failed");
-
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->value = ccos(c->value);
+    return 1 + dc_serial_di_size(c->real->numerator) + dc_serial_di_size(c->real->denominator) +
+           dc_serial_di_size(c->imag->numerator) + dc_serial_di_size(c->imag->denominator);
+}
 
-    return result;
+DC_DEF size_t dc_frac_serialize(dc_complex_frac c, uint8_t* buffer, size_t capacity) {
+    size_t size = dc_frac_serialized_size(c);
+    if (size > capacity) return 0;
+    DC_ASSERT(buffer && "dc_frac_serialize: buffer cannot be NULL");
+
+    uint8_t* p = buffer;
+    *p++ = DC_SERIAL_TAG(c->lazy ? DC_SERIAL_FRAC_LAZY : DC_SERIAL_FRAC);
+    p = dc_serial_put_di(p, c->real->numerator);
+    p = dc_serial_put_di(p, c->real->denominator);
+    p = dc_serial_put_di(p, c->imag->numerator);
+    dc_serial_put_di(p, c->imag->denominator);
+    return size;
 }
 
-DC_DEF dc_complex_double dc_double_tan(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_tan: operand cannot be NULL");
+DC_DEF dc_complex_frac dc_frac_deserialize(const uint8_t* buffer, size_t length, size_t* consumed) {
+    if (!buffer || length == 0) return NULL;
+    bool lazy = buffer[0] == DC_SERIAL_TAG(DC_SERIAL_FRAC_LAZY);
 
-    dc_complex_double result = DC_MALLOC(sizeof(struct dc_complex_double_internal));
-    DC_ASSERT(result && "dc_double_tan: allocation failed");
+    dc_serial_integer parts[4];
+    size_t size;
+    uint8_t tag = DC_SERIAL_TAG(lazy ? DC_SERIAL_FRAC_LAZY : DC_SERIAL_FRAC);
+    if (!dc_serial_get_integers(buffer, length, tag, parts, 4, &size)) return NULL;
+    if (!dc_serial_integer_is_positive(&parts[1]) || !dc_serial_integer_is_positive(&parts[3])) return NULL;
 
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->value = ctan(c->value);
+    di_int values[4];
+    for (size_t k = 0; k < 4; k++) values[k] = dc_serial_integer_to_di(&parts[k]);
+
+    // Only lazily reduced values may carry common factors
+    if (!lazy && (!dc_serial_coprime(values[0], values[1]) || !dc_serial_coprime(values[2], values[3]))) {
+        for (size_t k = 0; k < 4; k++) di_release(&values[k]);
+        return NULL;
+    }
+
+    dc_complex_frac result = dc_frac_alloc();
+    result->lazy = lazy;
+    result->real = dc_df_node(values[0], values[1]);
+    result->imag = dc_df_node(values[2], values[3]);
 
+    for (size_t k = 0; k < 4; k++) di_release(&values[k]);
+    if (consumed) *consumed = size;
     return result;
 }
 
-DC_DEF dc_complex_double dc_double_sinh(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_sinh: operand cannot be NULL");
+DC_DEF size_t dc_cfrac_serialized_size(dc_complex_cfrac c) {
+    DC_ASSERT(c && "dc_cfrac_serialized_size: operand cannot be NULL");
 
-    dc_complex_double result = DC_MALLOC(sizeof(struct dc_complex_double_internal));
-    DC_ASSERT(result && "dc_double_sinh: allocation failed");
+    return 1 + dc_serial_di_size(c->real) + dc_serial_di_size(c->imag) + dc_serial_di_size(c->den);
+}
 
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->value = csinh(c->value);
+DC_DEF size_t dc_cfrac_serialize(dc_complex_cfrac c, uint8_t* buffer, size_t capacity) {
+    size_t size = dc_cfrac_serialized_size(c);
+    if (size > capacity) return 0;
+    DC_ASSERT(buffer && "dc_cfrac_serialize: buffer cannot be NULL");
+
+    uint8_t* p = buffer;
+    *p++ = DC_SERIAL_TAG(DC_SERIAL_CFRAC);
+    p = dc_serial_put_di(p, c->real);
+    p = dc_serial_put_di(p, c->imag);
+    dc_serial_put_di(p, c->den);
+    return size;
+}
+
+DC_DEF dc_complex_cfrac dc_cfrac_deserialize(const uint8_t* buffer, size_t length, size_t* consumed) {
+    dc_serial_integer parts[3];
+    size_t size;
+    if (!dc_serial_get_integers(buffer, length, DC_SERIAL_TAG(DC_SERIAL_CFRAC), parts, 3, &size)) return NULL;
+    if (!dc_serial_integer_is_positive(&parts[2])) return NULL;
+
+    di_int real = dc_serial_integer_to_di(&parts[0]);
+    di_int imag = dc_serial_integer_to_di(&parts[1]);
+    di_int den = dc_serial_integer_to_di(&parts[2]);
+
+    // Canonical form has gcd(real, imag, den) == 1, as dc_cfrac_make() leaves it
+    bool reduced = true;
+    if (!di_is_one(den)) {
+        di_int g = di_gcd(den, real);
+        if (!di_is_one(g)) {
+            di_int h = di_gcd(g, imag);
+            di_release(&g);
+            g = h;
+        }
+        reduced = di_is_one(g);
+        di_release(&g);
+    }
+    if (!reduced) {
+        di_release(&real);
+        di_release(&imag);
+        di_release(&den);
+        return NULL;
+    }
 
+    dc_complex_cfrac result = dc_cfrac_alloc(real, imag, den);
+    if (consumed) *consumed = size;
     return result;
 }
 
-DC_DEF dc_complex_double dc_double_cosh(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_cosh: operand cannot be NULL");
+DC_DEF size_t dc_double_serialized_size(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_serialized_size: operand cannot be NULL");
+    (void)c;
+    return 1 + 2 * sizeof(uint64_t);
+}
 
-    dc_complex_double result = DC_MALLOC(sizeof(struct dc_complex_double_internal));
-    DC_ASSERT(result && "dc_double_cosh: allocation failed");
+DC_DEF size_t dc_double_serialize(dc_complex_double c, uint8_t* buffer, size_t capacity) {
+    size_t size = dc_double_serialized_size(c);
+    if (size > capacity) return 0;
+    DC_ASSERT(buffer && "dc_double_serialize: buffer cannot be NULL");
+
+    double parts[2] = {creal(c->value), cimag(c->value)};
+    uint8_t* p = buffer;
+    *p++ = DC_SERIAL_TAG(DC_SERIAL_DOUBLE);
+    for (size_t k = 0; k < 2; k++) {
+        uint64_t bits;
+        memcpy(&bits, &parts[k], sizeof(bits));
+        p = dc_serial_put_u32(p, (uint32_t)bits);
+        p = dc_serial_put_u32(p, (uint32_t)(bits >> 32));
+    }
+    return size;
+}
 
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->value = ccosh(c->value);
+DC_DEF dc_complex_double dc_double_deserialize(const uint8_t* buffer, size_t length, size_t* consumed) {
+    size_t size = 1 + 2 * sizeof(uint64_t);
+    if (!buffer || length < size || buffer[0] != DC_SERIAL_TAG(DC_SERIAL_DOUBLE)) return NULL;
 
-    return result;
+    double parts[2];
+    for (size_t k = 0; k < 2; k++) {
+        const uint8_t* p = buffer + 1 + 8 * k;
+        uint64_t bits = (uint64_t)dc_serial_get_u32(p + 4) << 32 | dc_serial_get_u32(p);
+        memcpy(&parts[k], &bits, sizeof(bits));
+    }
+
+    if (consumed) *consumed = size;
+    return dc_double_from_value(dc_double_make(parts[0], parts[1]));
 }
 
-DC_DEF dc_complex_double dc_double_tanh(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_tanh: operand cannot be NULL");
+// ============================================================================
+// COLUMNAR FILE IMPLEMENTATION
+// ============================================================================
 
-    dc_complex_double result = DC_MALLOC(sizeof(struct dc_complex_double_internal));
-    DC_ASSERT(result && "dc_double_tanh: allocation failed");
+#define DC_ARRAY_FILE_HEADER_SIZE 64
+#define DC_ARRAY_FILE_CHECKSUMS 1u
+#define DC_ARRAY_FILE_COPY_CHUNK 65536
 
-    DC_ATOMIC_STORE(&result->ref_count, 1);
-    result->value = ctanh(c->value);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#define DC_ARRAY_FILE_NATIVE 0
+#else
+#define DC_ARRAY_FILE_NATIVE 1
+#endif
 
-    return result;
+static const char dc_array_file_magic[8] = {'D', 'C', 'A', 'R', 'R', 'A', 'Y', '\0'};
+
+typedef struct {
+    uint32_t flags;
+    uint64_t length;
+    uint64_t real_offset;
+    uint64_t imag_offset;
+    uint32_t real_crc;
+    uint32_t imag_crc;
+} dc_array_file_header;
+
+struct dc_double_array_writer_internal {
+    FILE* file;
+    FILE* spill;  // imaginary column until close
+    size_t length;
+    bool checksums;
+    bool failed;
+    uint32_t real_crc;
+    uint32_t imag_crc;
+    uint32_t crc_table[256];
+};
+
+// CRC-32 (IEEE 802.3, reflected); the table is rebuilt per use, which is noise next to a column
+static void dc_crc32_table(uint32_t table[256]) {
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t crc = n;
+        for (int k = 0; k < 8; k++) crc = crc & 1 ? 0xedb88320u ^ (crc >> 1) : crc >> 1;
+        table[n] = crc;
+    }
 }
 
-DC_DEF double dc_double_real(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_real: operand cannot be NULL");
-    return creal(c->value);
+static uint32_t dc_crc32_update(const uint32_t table[256], uint32_t crc, const void* data, size_t size) {
+    const uint8_t* p = data;
+    crc = ~crc;
+    for (size_t k = 0; k < size; k++) crc = table[(crc ^ p[k]) & 0xff] ^ (crc >> 8);
+    return ~crc;
 }
 
-DC_DEF double dc_double_imag(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_imag: operand cannot be NULL");
-    return cimag(c->value);
+static uint8_t* dc_array_file_put_u64(uint8_t* p, uint64_t value) {
+    p = dc_serial_put_u32(p, (uint32_t)value);
+    return dc_serial_put_u32(p, (uint32_t)(value >> 32));
 }
 
-DC_DEF double dc_double_abs(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_abs: operand cannot be NULL");
-    return cabs(c->value);
+static uint64_t dc_array_file_get_u64(const uint8_t* p) {
+    return (uint64_t)dc_serial_get_u32(p + 4) << 32 | dc_serial_get_u32(p);
 }
 
-DC_DEF double dc_double_arg(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_arg: operand cannot be NULL");
-    return carg(c->value);
+// Bytes of a column of `length` doubles, padded to the array alignment
+static uint64_t dc_array_file_column_size(size_t length) {
+    return (uint64_t)dc_double_array_stride(length) * sizeof(double);
 }
 
-DC_DEF bool dc_double_eq(dc_complex_double a, dc_complex_double b) {
-    DC_ASSERT(a && "dc_double_eq: first operand cannot be NULL");
-    DC_ASSERT(b && "dc_double_eq: second operand cannot be NULL");
+static dc_array_file_header dc_array_file_layout(size_t length, bool checksums) {
+    dc_array_file_header header = {0};
+    header.flags = checksums ? DC_ARRAY_FILE_CHECKSUMS : 0;
+    header.length = length;
+    header.real_offset = DC_ARRAY_FILE_HEADER_SIZE;
+    header.imag_offset = DC_ARRAY_FILE_HEADER_SIZE + dc_array_file_column_size(length);
+    return header;
+}
 
-    return creal(a->value) == creal(b->value) && cimag(a->value) == cimag(b->value);
+static void dc_array_file_encode(const dc_array_file_header* header, uint8_t out[DC_ARRAY_FILE_HEADER_SIZE]) {
+    uint32_t table[256];
+    dc_crc32_table(table);
+
+    memset(out, 0, DC_ARRAY_FILE_HEADER_SIZE);
+    memcpy(out, dc_array_file_magic, sizeof(dc_array_file_magic));
+    uint8_t* p = dc_serial_put_u32(out + 8, DC_ARRAY_FILE_VERSION);
+    p = dc_serial_put_u32(p, header->flags);
+    p = dc_array_file_put_u64(p, header->length);
+    p = dc_array_file_put_u64(p, header->real_offset);
+    p = dc_array_file_put_u64(p, header->imag_offset);
+    p = dc_serial_put_u32(p, header->real_crc);
+    p = dc_serial_put_u32(p, header->imag_crc);
+    dc_serial_put_u32(p, dc_crc32_update(table, 0, out, (size_t)(p - out)));
 }
 
-DC_DEF bool dc_double_is_zero(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_is_zero: operand cannot be NULL");
-    return creal(c->value) == 0.0 && cimag(c->value) == 0.0;
+// A column lies inside the file and is aligned for doubles
+static bool dc_array_file_column_fits(uint64_t offset, uint64_t length, uint64_t file_size) {
+    return offset >= DC_ARRAY_FILE_HEADER_SIZE && offset % sizeof(double) == 0 && offset <= file_size &&
+           length <= (file_size - offset) / sizeof(double);
 }
 
-DC_DEF bool dc_double_is_real(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_is_real: operand cannot be NULL");
-    return cimag(c->value) == 0.0;
+static bool dc_array_file_decode(const uint8_t in[DC_ARRAY_FILE_HEADER_SIZE], uint64_t file_size,
+                                 dc_array_file_header* header) {
+    uint32_t table[256];
+    dc_crc32_table(table);
+
+    if (memcmp(in, dc_array_file_magic, sizeof(dc_array_file_magic)) != 0) return false;
+    if (dc_serial_get_u32(in + 8) != DC_ARRAY_FILE_VERSION) return false;
+    if (dc_serial_get_u32(in + 48) != dc_crc32_update(table, 0, in, 48)) return false;
+
+    header->flags = dc_serial_get_u32(in + 12);
+    header->length = dc_array_file_get_u64(in + 16);
+    header->real_offset = dc_array_file_get_u64(in + 24);
+    header->imag_offset = dc_array_file_get_u64(in + 32);
+    header->real_crc = dc_serial_get_u32(in + 40);
+    header->imag_crc = dc_serial_get_u32(in + 44);
+
+    return header->length <= SIZE_MAX / sizeof(double) &&
+           dc_array_file_column_fits(header->real_offset, header->length, file_size) &&
+           dc_array_file_column_fits(header->imag_offset, header->length, file_size);
 }
 
-DC_DEF bool dc_double_is_imag(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_is_imag: operand cannot be NULL");
-    return creal(c->value) == 0.0;
+// Files without checksums pass
+static bool dc_array_file_verify(const dc_array_file_header* header, const double* real, const double* imag) {
+    if (!(header->flags & DC_ARRAY_FILE_CHECKSUMS)) return true;
+
+    uint32_t table[256];
+    dc_crc32_table(table);
+    size_t size = (size_t)header->length * sizeof(double);
+    return dc_crc32_update(table, 0, real, size) == header->real_crc &&
+           dc_crc32_update(table, 0, imag, size) == header->imag_crc;
 }
 
-DC_DEF bool dc_double_is_nan(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_is_nan: operand cannot be NULL");
-    return isnan(creal(c->value)) || isnan(cimag(c->value));
+// Zeros from the end of `length` doubles to the next column boundary
+static bool dc_array_file_pad(FILE* file, size_t length) {
+    static const uint8_t zeros[DC_DOUBLE_ARRAY_ALIGN];
+    size_t padding = (size_t)(dc_array_file_column_size(length) - length * sizeof(double));
+    return fwrite(zeros, 1, padding, file) == padding;
 }
 
-DC_DEF bool dc_double_is_inf(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_is_inf: operand cannot be NULL");
-    return isinf(creal(c->value)) || isinf(cimag(c->value));
+DC_DEF bool dc_double_array_save(dc_double_array a, const char* path, bool checksums) {
+    DC_ASSERT(a && "dc_double_array_save: array cannot be NULL");
+    DC_ASSERT(path && "dc_double_array_save: path cannot be NULL");
+    if (!DC_ARRAY_FILE_NATIVE) return false;
+
+    dc_array_file_header header = dc_array_file_layout(a->length, checksums);
+    if (checksums) {
+        uint32_t table[256];
+        dc_crc32_table(table);
+        header.real_crc = dc_crc32_update(table, 0, a->real, a->length * sizeof(double));
+        header.imag_crc = dc_crc32_update(table, 0, a->imag, a->length * sizeof(double));
+    }
+    uint8_t bytes[DC_ARRAY_FILE_HEADER_SIZE];
+    dc_array_file_encode(&header, bytes);
+
+    FILE* file = fopen(path, "wb");
+    if (!file) return false;
+    bool ok = fwrite(bytes, 1, sizeof(bytes), file) == sizeof(bytes) &&
+              fwrite(a->real, sizeof(double), a->length, file) == a->length && dc_array_file_pad(file, a->length) &&
+              fwrite(a->imag, sizeof(double), a->length, file) == a->length && dc_array_file_pad(file, a->length);
+    return fclose(file) == 0 && ok;
 }
 
-DC_DEF char* dc_double_to_string(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_to_string: operand cannot be NULL");
+DC_DEF dc_double_array dc_double_array_map(const char* path, bool verify) {
+    DC_ASSERT(path && "dc_double_array_map: path cannot be NULL");
+    if (!DC_ARRAY_FILE_NATIVE) return NULL;
+
+    dc_array_file_header header;
+#if DC_MMAP
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+
+    struct stat info;
+    void* base = MAP_FAILED;
+    size_t size = 0;
+    if (fstat(fd, &info) == 0 && info.st_size >= DC_ARRAY_FILE_HEADER_SIZE && (uint64_t)info.st_size <= SIZE_MAX) {
+        size = (size_t)info.st_size;
+        // Private and writable: the array behaves like any other, and writes are copy-on-write
+        base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (base == MAP_FAILED) return NULL;
+
+    uint8_t* bytes = base;
+    if (!dc_array_file_decode(bytes, size, &header) ||
+        (verify && !dc_array_file_verify(&header, (const double*)(bytes + header.real_offset),
+                                         (const double*)(bytes + header.imag_offset)))) {
+        munmap(base, size);
+        return NULL;
+    }
 
-    char* result = DC_MALLOC(256);
-    DC_ASSERT(result && "dc_double_to_string: allocation failed");
+    dc_double_array result = DC_MALLOC(sizeof(struct dc_double_array_internal));
+    DC_ASSERT(result && "dc_double_array_map: allocation failed");
+    DC_ATOMIC_STORE(&result->ref_count, 1);
+    result->length = (size_t)header.length;
+    result->real = (double*)(bytes + header.real_offset);
+    result->imag = (double*)(bytes + header.imag_offset);
+    result->block = base;
+    result->mapped = size;
+    DC_STATS_LIVE(DC_STAT_LIVE_ARRAY, 1);
+    return result;
+#else
+    FILE* file = fopen(path, "rb");
+    if (!file) return NULL;
+
+    uint8_t bytes[DC_ARRAY_FILE_HEADER_SIZE];
+    long size = -1;
+    if (fseek(file, 0, SEEK_END) == 0) size = ftell(file);
+    if (size < DC_ARRAY_FILE_HEADER_SIZE || fseek(file, 0, SEEK_SET) != 0 ||
+        fread(bytes, 1, sizeof(bytes), file) != sizeof(bytes) || !dc_array_file_decode(bytes, (uint64_t)size, &header)) {
+        fclose(file);
+        return NULL;
+    }
 
-    double real = creal(c->value);
-    double imag = cimag(c->value);
+    size_t length = (size_t)header.length;
+    dc_double_array result = dc_double_array_alloc(length);
+    bool ok = fseek(file, (long)header.real_offset, SEEK_SET) == 0 &&
+              fread(result->real, sizeof(double), length, file) == length &&
+              fseek(file, (long)header.imag_offset, SEEK_SET) == 0 &&
+              fread(result->imag, sizeof(double), length, file) == length;
+    fclose(file);
+    if (!ok || (verify && !dc_array_file_verify(&header, result->real, result->imag))) {
+        dc_double_array_release(&result);
+        return NULL;
+    }
+    return result;
+#endif
+}
 
-    if (real == 0.0 && imag == 0.0) {
-        strcpy(result, "0");
-    } else if (imag == 0.0) {
-        sprintf(result, "%g", real);
-    } else if (real == 0.0) {
-        if (imag == 1.0) {
-            strcpy(result, "i");
-        } else if (imag == -1.0) {
-            strcpy(result, "-i");
-        } else {
-            sprintf(result, "%gi", imag);
-        }
-    } else {
-        if (imag == 1.0) {
-            sprintf(result, "%g+i", real);
-        } else if (imag == -1.0) {
-            sprintf(result, "%g-i", real);
-        } else if (imag < 0) {
-            sprintf(result, "%g%gi", real, imag);
-        } else {
-            sprintf(result, "%g+%gi", real, imag);
+DC_DEF dc_double_array_writer dc_double_array_writer_open(const char* path, bool checksums) {
+    DC_ASSERT(path && "dc_double_array_writer_open: path cannot be NULL");
+    if (!DC_ARRAY_FILE_NATIVE) return NULL;
+
+    dc_double_array_writer w = DC_MALLOC(sizeof(struct dc_double_array_writer_internal));
+    DC_ASSERT(w && "dc_double_array_writer_open: allocation failed");
+    w->length = 0;
+    w->checksums = checksums;
+    w->failed = false;
+    w->real_crc = 0;
+    w->imag_crc = 0;
+    if (checksums) dc_crc32_table(w->crc_table);
+
+    // The header stays zero until close
+    static const uint8_t blank[DC_ARRAY_FILE_HEADER_SIZE];
+    w->file = fopen(path, "wb");
+    w->spill = w->file ? tmpfile() : NULL;
+    if (!w->spill || fwrite(blank, 1, sizeof(blank), w->file) != sizeof(blank)) {
+        if (w->spill) fclose(w->spill);
+        if (w->file) fclose(w->file);
+        DC_FREE(w);
+        return NULL;
+    }
+    return w;
+}
+
+DC_DEF bool dc_double_array_writer_append(dc_double_array_writer w, const double* real, const double* imag,
+                                          size_t count) {
+    DC_ASSERT(w && "dc_double_array_writer_append: writer cannot be NULL");
+    DC_ASSERT(((real && imag) || count == 0) && "dc_double_array_writer_append: parts cannot be NULL");
+    if (w->failed) return false;
+    if (count == 0) return true;
+
+    if (fwrite(real, sizeof(double), count, w->file) != count || fwrite(imag, sizeof(double), count, w->spill) != count) {
+        w->failed = true;
+        return false;
+    }
+    if (w->checksums) {
+        w->real_crc = dc_crc32_update(w->crc_table, w->real_crc, real, count * sizeof(double));
+        w->imag_crc = dc_crc32_update(w->crc_table, w->imag_crc, imag, count * sizeof(double));
+    }
+    w->length += count;
+    return true;
+}
+
+DC_DEF bool dc_double_array_writer_close(dc_double_array_writer* w) {
+    if (!w || !*w) return false;
+    dc_double_array_writer writer = *w;
+    *w = NULL;
+
+    bool ok = !writer->failed && dc_array_file_pad(writer->file, writer->length) && fflush(writer->spill) == 0 &&
+              fseek(writer->spill, 0, SEEK_SET) == 0;
+
+    // Copy the spooled imaginary column behind the real one
+    if (ok) {
+        uint8_t* chunk = DC_MALLOC(DC_ARRAY_FILE_COPY_CHUNK);
+        DC_ASSERT(chunk && "dc_double_array_writer_close: allocation failed");
+        for (size_t left = writer->length * sizeof(double); ok && left > 0;) {
+            size_t size = left < DC_ARRAY_FILE_COPY_CHUNK ? left : DC_ARRAY_FILE_COPY_CHUNK;
+            ok = fread(chunk, 1, size, writer->spill) == size && fwrite(chunk, 1, size, writer->file) == size;
+            left -= size;
         }
+        DC_FREE(chunk);
     }
 
-    return result;
+    if (ok) {
+        dc_array_file_header header = dc_array_file_layout(writer->length, writer->checksums);
+        header.real_crc = writer->real_crc;
+        header.imag_crc = writer->imag_crc;
+        uint8_t bytes[DC_ARRAY_FILE_HEADER_SIZE];
+        dc_array_file_encode(&header, bytes);
+        ok = dc_array_file_pad(writer->file, writer->length) && fseek(writer->file, 0, SEEK_SET) == 0 &&
+             fwrite(bytes, 1, sizeof(bytes), writer->file) == sizeof(bytes);
+    }
+
+    fclose(writer->spill);
+    ok = fclose(writer->file) == 0 && ok;
+    DC_FREE(writer);
+    return ok;
 }
 
+#if DC_ARENA
+
 // ============================================================================
-// TYPE CONVERSION IMPLEMENTATION
+// ARENA ESCAPE IMPLEMENTATION
 // ============================================================================
 
-DC_DEF dc_complex_frac dc_int_to_frac(dc_complex_int c) {
-    DC_ASSERT(c && "dc_int_to_frac: operand cannot be NULL");
-
-    df_frac real = df_from_di(c->real, di_one());
-    df_frac imag = df_from_di(c->imag, di_one());
-    dc_complex_frac result = dc_frac_from_df(real, imag);
+DC_DEF dc_complex_int dc_int_escape(dc_complex_int c) {
+    DC_ASSERT(c && "dc_int_escape: operand cannot be NULL");
+    if (!dc_arena_contains(c)) return dc_int_retain(c);
 
-    df_release(&real);
-    df_release(&imag);
+    DC_ARENA_SUSPEND();
+    dc_complex_int result;
+    if (c->is_small) {
+        result = dc_int_from_ints(c->small.real, c->small.imag);
+    } else {
+        di_int real = di_copy(c->big.real);
+        di_int imag = di_copy(c->big.imag);
+        result = dc_int_from_di(real, imag);
+        di_release(&real);
+        di_release(&imag);
+    }
+    DC_ARENA_RESUME();
 
     return result;
 }
 
-DC_DEF dc_complex_double dc_int_to_double(dc_complex_int c) {
-    DC_ASSERT(c && "dc_int_to_double: operand cannot be NULL");
+// Deep-copy a fraction whose integers may live in the arena
+static df_frac dc_df_escape(df_frac f) {
+    di_int arena_num = df_numerator(f);
+    di_int arena_den = df_denominator(f);
+    di_int num = di_copy(arena_num);
+    di_int den = di_copy(arena_den);
+    df_frac result = df_from_di(num, den);
 
-    double real = di_to_double(c->real);
-    double imag = di_to_double(c->imag);
+    di_release(&arena_num);
+    di_release(&arena_den);
+    di_release(&num);
+    di_release(&den);
 
-    return dc_double_from_doubles(real, imag);
+    return result;
 }
 
-DC_DEF dc_complex_double dc_frac_to_double(dc_complex_frac c) {
-    DC_ASSERT(c && "dc_frac_to_double: operand cannot be NULL");
+DC_DEF dc_complex_frac dc_frac_escape(dc_complex_frac c) {
+    DC_ASSERT(c && "dc_frac_escape: operand cannot be NULL");
+    if (!dc_arena_contains(c)) return dc_frac_retain(c);
 
-    double real = df_to_double(c->real);
-    double imag = df_to_double(c->imag);
+    DC_ARENA_SUSPEND();
+    df_frac real = dc_df_escape(c->real);
+    df_frac imag = dc_df_escape(c->imag);
+    dc_complex_frac result = dc_frac_from_df(real, imag);
+    result->lazy = c->lazy;
+    df_release(&real);
+    df_release(&imag);
+    DC_ARENA_RESUME();
 
-    return dc_double_from_doubles(real, imag);
+    return result;
 }
 
-DC_DEF dc_complex_int dc_frac_to_int(dc_complex_frac c) {
-    DC_ASSERT(c && "dc_frac_to_int: operand cannot be NULL");
-
-    // Convert to double and round
-    double real = df_to_double(c->real);
-    double imag = df_to_double(c->imag);
+DC_DEF dc_complex_cfrac dc_cfrac_escape(dc_complex_cfrac c) {
+    DC_ASSERT(c && "dc_cfrac_escape: operand cannot be NULL");
+    if (!dc_arena_contains(c)) return dc_cfrac_retain(c);
 
-    int64_t real_rounded = (int64_t)round(real);
-    int64_t imag_rounded = (int64_t)round(imag);
+    DC_ARENA_SUSPEND();
+    dc_complex_cfrac result = dc_cfrac_alloc(di_copy(c->real), di_copy(c->imag), di_copy(c->den));
+    DC_ARENA_RESUME();
 
-    return dc_int_from_ints(real_rounded, imag_rounded);
+    return result;
 }
 
-DC_DEF dc_complex_int dc_double_to_int(dc_complex_double c) {
-    DC_ASSERT(c && "dc_double_to_int: operand cannot be NULL");
-
-    double real = creal(c->value);
-    double imag = cimag(c->value);
+DC_DEF dc_complex_double dc_double_escape(dc_complex_double c) {
+    DC_ASSERT(c && "dc_double_escape: operand cannot be NULL");
+    if (!dc_arena_contains(c)) return dc_double_retain(c);
 
-    int64_t real_rounded = (int64_t)round(real);
-    int64_t imag_rounded = (int64_t)round(imag);
+    DC_ARENA_SUSPEND();
+    dc_complex_double result = dc_double_from_value(c->value);
+    DC_ARENA_RESUME();
 
-    return dc_int_from_ints(real_rounded, imag_rounded);
+    return result;
 }
 
-DC_DEF dc_complex_frac dc_double_to_frac(dc_complex_double c, int64_t max_denominator) {
-    DC_ASSERT(c && "dc_double_to_frac: operand cannot be NULL");
-    DC_ASSERT(max_denominator > 0 && "dc_double_to_frac: max_denominator must be positive");
+#endif
 
-    double real = creal(c->value);
-    double imag = cimag(c->value);
+#if DC_STATS
+#undef di_mul
+#undef di_gcd
+#endif
 
-    df_frac real_frac = df_from_double(real, max_denominator);
-    df_frac imag_frac = df_from_double(imag, max_denominator);
+#endif // DC_IMPLEMENTATION
 
-    dc_complex_frac result = dc_frac_from_df(real_frac, imag_frac);
+// ============================================================================
+// ALLOCATION TRACKING WRAPPERS
+// ============================================================================
 
-    df_release(&real_frac);
-    df_release(&imag_frac);
+// Defined after the implementation so that only calls from user code record their site
+#if DC_TRACK_ALLOCS
+
+#define DC_TRACK_CALL(family, name, ...) dc_##family##_track(name(__VA_ARGS__), __FILE__, __LINE__, #name)
+
+// Calls returning a new dc_complex_int
+#define dc_int_from_ints(...) DC_TRACK_CALL(int, dc_int_from_ints, __VA_ARGS__)
+#define dc_int_from_di(...) DC_TRACK_CALL(int, dc_int_from_di, __VA_ARGS__)
+#define dc_int_copy(...) DC_TRACK_CALL(int, dc_int_copy, __VA_ARGS__)
+#define dc_int_add(...) DC_TRACK_CALL(int, dc_int_add, __VA_ARGS__)
+#define dc_int_sub(...) DC_TRACK_CALL(int, dc_int_sub, __VA_ARGS__)
+#define dc_int_mul(...) DC_TRACK_CALL(int, dc_int_mul, __VA_ARGS__)
+#define dc_int_negate(...) DC_TRACK_CALL(int, dc_int_negate, __VA_ARGS__)
+#define dc_int_conj(...) DC_TRACK_CALL(int, dc_int_conj, __VA_ARGS__)
+#define dc_int_pow(...) DC_TRACK_CALL(int, dc_int_pow, __VA_ARGS__)
+#define dc_int_gcd(...) DC_TRACK_CALL(int, dc_int_gcd, __VA_ARGS__)
+#define dc_int_xgcd(...) DC_TRACK_CALL(int, dc_int_xgcd, __VA_ARGS__)
+#define dc_int_powmod(...) DC_TRACK_CALL(int, dc_int_powmod, __VA_ARGS__)
+#define dc_int_add_steal(...) DC_TRACK_CALL(int, dc_int_add_steal, __VA_ARGS__)
+#define dc_int_sub_steal(...) DC_TRACK_CALL(int, dc_int_sub_steal, __VA_ARGS__)
+#define dc_int_mul_steal(...) DC_TRACK_CALL(int, dc_int_mul_steal, __VA_ARGS__)
+#define dc_int_negate_steal(...) DC_TRACK_CALL(int, dc_int_negate_steal, __VA_ARGS__)
+#define dc_int_conj_steal(...) DC_TRACK_CALL(int, dc_int_conj_steal, __VA_ARGS__)
+#define dc_cfrac_numerator(...) DC_TRACK_CALL(int, dc_cfrac_numerator, __VA_ARGS__)
+#define dc_frac_to_int(...) DC_TRACK_CALL(int, dc_frac_to_int, __VA_ARGS__)
+#define dc_double_to_int(...) DC_TRACK_CALL(int, dc_double_to_int, __VA_ARGS__)
+#define dc_int_deserialize(...) DC_TRACK_CALL(int, dc_int_deserialize, __VA_ARGS__)
+#if DC_ARENA
+#define dc_int_escape(...) DC_TRACK_CALL(int, dc_int_escape, __VA_ARGS__)
+#endif
 
-    return result;
-}
+// Calls returning a new dc_complex_frac
+#define dc_frac_from_ints(...) DC_TRACK_CALL(frac, dc_frac_from_ints, __VA_ARGS__)
+#define dc_frac_from_df(...) DC_TRACK_CALL(frac, dc_frac_from_df, __VA_ARGS__)
+#define dc_frac_copy(...) DC_TRACK_CALL(frac, dc_frac_copy, __VA_ARGS__)
+#define dc_frac_add(...) DC_TRACK_CALL(frac, dc_frac_add, __VA_ARGS__)
+#define dc_frac_sub(...) DC_TRACK_CALL(frac, dc_frac_sub, __VA_ARGS__)
+#define dc_frac_mul(...) DC_TRACK_CALL(frac, dc_frac_mul, __VA_ARGS__)
+#define dc_frac_div(...) DC_TRACK_CALL(frac, dc_frac_div, __VA_ARGS__)
+#define dc_frac_negate(...) DC_TRACK_CALL(frac, dc_frac_negate, __VA_ARGS__)
+#define dc_frac_conj(...) DC_TRACK_CALL(frac, dc_frac_conj, __VA_ARGS__)
+#define dc_frac_pow(...) DC_TRACK_CALL(frac, dc_frac_pow, __VA_ARGS__)
+#define dc_frac_reciprocal(...) DC_TRACK_CALL(frac, dc_frac_reciprocal, __VA_ARGS__)
+#define dc_frac_lazy(...) DC_TRACK_CALL(frac, dc_frac_lazy, __VA_ARGS__)
+#define dc_frac_normalize(...) DC_TRACK_CALL(frac, dc_frac_normalize, __VA_ARGS__)
+#define dc_frac_add_steal(...) DC_TRACK_CALL(frac, dc_frac_add_steal, __VA_ARGS__)
+#define dc_frac_sub_steal(...) DC_TRACK_CALL(frac, dc_frac_sub_steal, __VA_ARGS__)
+#define dc_frac_mul_steal(...) DC_TRACK_CALL(frac, dc_frac_mul_steal, __VA_ARGS__)
+#define dc_frac_div_steal(...) DC_TRACK_CALL(frac, dc_frac_div_steal, __VA_ARGS__)
+#define dc_frac_negate_steal(...) DC_TRACK_CALL(frac, dc_frac_negate_steal, __VA_ARGS__)
+#define dc_frac_conj_steal(...) DC_TRACK_CALL(frac, dc_frac_conj_steal, __VA_ARGS__)
+#define dc_frac_reciprocal_steal(...) DC_TRACK_CALL(frac, dc_frac_reciprocal_steal, __VA_ARGS__)
+#define dc_int_div(...) DC_TRACK_CALL(frac, dc_int_div, __VA_ARGS__)
+#define dc_int_to_frac(...) DC_TRACK_CALL(frac, dc_int_to_frac, __VA_ARGS__)
+#define dc_cfrac_to_frac(...) DC_TRACK_CALL(frac, dc_cfrac_to_frac, __VA_ARGS__)
+#define dc_double_to_frac(...) DC_TRACK_CALL(frac, dc_double_to_frac, __VA_ARGS__)
+#define dc_frac_deserialize(...) DC_TRACK_CALL(frac, dc_frac_deserialize, __VA_ARGS__)
+#if DC_ARENA
+#define dc_frac_escape(...) DC_TRACK_CALL(frac, dc_frac_escape, __VA_ARGS__)
+#endif
 
-#endif // DC_IMPLEMENTATION
+// Calls returning a new dc_complex_cfrac
+#define dc_cfrac_from_di(...) DC_TRACK_CALL(cfrac, dc_cfrac_from_di, __VA_ARGS__)
+#define dc_cfrac_from_ints(...) DC_TRACK_CALL(cfrac, dc_cfrac_from_ints, __VA_ARGS__)
+#define dc_cfrac_add(...) DC_TRACK_CALL(cfrac, dc_cfrac_add, __VA_ARGS__)
+#define dc_cfrac_sub(...) DC_TRACK_CALL(cfrac, dc_cfrac_sub, __VA_ARGS__)
+#define dc_cfrac_mul(...) DC_TRACK_CALL(cfrac, dc_cfrac_mul, __VA_ARGS__)
+#define dc_cfrac_div(...) DC_TRACK_CALL(cfrac, dc_cfrac_div, __VA_ARGS__)
+#define dc_cfrac_negate(...) DC_TRACK_CALL(cfrac, dc_cfrac_negate, __VA_ARGS__)
+#define dc_cfrac_conj(...) DC_TRACK_CALL(cfrac, dc_cfrac_conj, __VA_ARGS__)
+#define dc_frac_to_cfrac(...) DC_TRACK_CALL(cfrac, dc_frac_to_cfrac, __VA_ARGS__)
+#define dc_cfrac_deserialize(...) DC_TRACK_CALL(cfrac, dc_cfrac_deserialize, __VA_ARGS__)
+#if DC_ARENA
+#define dc_cfrac_escape(...) DC_TRACK_CALL(cfrac, dc_cfrac_escape, __VA_ARGS__)
+#endif
+
+// Calls returning a new dc_complex_double
+#define dc_double_from_doubles(...) DC_TRACK_CALL(double, dc_double_from_doubles, __VA_ARGS__)
+#define dc_double_from_polar(...) DC_TRACK_CALL(double, dc_double_from_polar, __VA_ARGS__)
+#define dc_double_from_value(...) DC_TRACK_CALL(double, dc_double_from_value, __VA_ARGS__)
+#define dc_double_copy(...) DC_TRACK_CALL(double, dc_double_copy, __VA_ARGS__)
+#define dc_double_add(...) DC_TRACK_CALL(double, dc_double_add, __VA_ARGS__)
+#define dc_double_sub(...) DC_TRACK_CALL(double, dc_double_sub, __VA_ARGS__)
+#define dc_double_mul(...) DC_TRACK_CALL(double, dc_double_mul, __VA_ARGS__)
+#define dc_double_div(...) DC_TRACK_CALL(double, dc_double_div, __VA_ARGS__)
+#define dc_double_negate(...) DC_TRACK_CALL(double, dc_double_negate, __VA_ARGS__)
+#define dc_double_conj(...) DC_TRACK_CALL(double, dc_double_conj, __VA_ARGS__)
+#define dc_double_exp(...) DC_TRACK_CALL(double, dc_double_exp, __VA_ARGS__)
+#define dc_double_log(...) DC_TRACK_CALL(double, dc_double_log, __VA_ARGS__)
+#define dc_double_pow(...) DC_TRACK_CALL(double, dc_double_pow, __VA_ARGS__)
+#define dc_double_sqrt(...) DC_TRACK_CALL(double, dc_double_sqrt, __VA_ARGS__)
+#define dc_double_sin(...) DC_TRACK_CALL(double, dc_double_sin, __VA_ARGS__)
+#define dc_double_cos(...) DC_TRACK_CALL(double, dc_double_cos, __VA_ARGS__)
+#define dc_double_tan(...) DC_TRACK_CALL(double, dc_double_tan, __VA_ARGS__)
+#define dc_double_sinh(...) DC_TRACK_CALL(double, dc_double_sinh, __VA_ARGS__)
+#define dc_double_cosh(...) DC_TRACK_CALL(double, dc_double_cosh, __VA_ARGS__)
+#define dc_double_tanh(...) DC_TRACK_CALL(double, dc_double_tanh, __VA_ARGS__)
+#define dc_double_add_steal(...) DC_TRACK_CALL(double, dc_double_add_steal, __VA_ARGS__)
+#define dc_double_sub_steal(...) DC_TRACK_CALL(double, dc_double_sub_steal, __VA_ARGS__)
+#define dc_double_mul_steal(...) DC_TRACK_CALL(double, dc_double_mul_steal, __VA_ARGS__)
+#define dc_double_div_steal(...) DC_TRACK_CALL(double, dc_double_div_steal, __VA_ARGS__)
+#define dc_double_negate_steal(...) DC_TRACK_CALL(double, dc_double_negate_steal, __VA_ARGS__)
+#define dc_double_conj_steal(...) DC_TRACK_CALL(double, dc_double_conj_steal, __VA_ARGS__)
+#define dc_int_to_double(...) DC_TRACK_CALL(double, dc_int_to_double, __VA_ARGS__)
+#define dc_frac_to_double(...) DC_TRACK_CALL(double, dc_frac_to_double, __VA_ARGS__)
+#define dc_double_deserialize(...) DC_TRACK_CALL(double, dc_double_deserialize, __VA_ARGS__)
+#if DC_ARENA
+#define dc_double_escape(...) DC_TRACK_CALL(double, dc_double_escape, __VA_ARGS__)
+#endif
+
+#endif
 
 #endif // DYNAMIC_COMPLEX_H
\ No newline at end of file
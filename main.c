@@ -2,14 +2,16 @@
 #include "devDeps/unity/unity.h"
 
 // Include dependencies with implementations
+// (dynamic_complex.h includes them itself so DC_ARENA can route their allocators)
 #define DI_IMPLEMENTATION
-#include "dynamic_int.h"
 #define DF_IMPLEMENTATION
-#include "dynamic_fraction.h"
-
 #define DC_IMPLEMENTATION
 #include "dynamic_complex.h"
 
+#if DC_BIASED_REFCOUNT
+#include <pthread.h>
+#endif
+
 void setUp(void) {
     // Set up before each test
 }
@@ -162,6 +164,9 @@ void test_dc_int_string_conversion(void) {
     free(str_d);
 }
 
+// Immortal values are never freed; a global keeps this one reachable for leak checkers
+static dc_complex_int immortal_value = NULL;
+
 void test_dc_int_memory_management(void) {
     dc_complex_int a = dc_int_from_ints(1, 2);
     dc_complex_int b = dc_int_retain(a);
@@ -174,6 +179,48 @@ void test_dc_int_memory_management(void) {
 
     dc_int_release(&b);
     TEST_ASSERT_NULL(b);
+
+    // Constants are immortal: extra releases never free them
+    dc_complex_int zero = dc_int_zero();
+    dc_complex_frac one = dc_frac_one();
+    dc_complex_double i = dc_double_i();
+    TEST_ASSERT_TRUE(dc_int_is_immortal(zero));
+    TEST_ASSERT_TRUE(dc_frac_is_immortal(one));
+    TEST_ASSERT_TRUE(dc_double_is_immortal(i));
+    for (int k = 0; k < 3; k++) {
+        dc_complex_int z = dc_int_retain(zero);
+        dc_complex_frac o = dc_frac_retain(one);
+        dc_complex_double d = dc_double_retain(i);
+        dc_int_release(&z);
+        dc_int_release(&z);
+        dc_frac_release(&o);
+        dc_frac_release(&o);
+        dc_double_release(&d);
+        dc_double_release(&d);
+    }
+    TEST_ASSERT_EQUAL_PTR(zero, dc_int_zero());
+    TEST_ASSERT_EQUAL_PTR(one, dc_frac_one());
+    dc_complex_frac expected_one = dc_frac_from_ints(1, 1, 0, 1);
+    TEST_ASSERT_TRUE(dc_frac_eq(one, expected_one));
+    dc_frac_release(&expected_one);
+    TEST_ASSERT_EQUAL_DOUBLE(1.0, dc_double_imag(i));
+
+    // Any value can be made immortal; it stays valid however often it is released
+    TEST_ASSERT_FALSE(dc_int_is_immortal(b = dc_int_from_ints(5, -7)));
+    immortal_value = dc_int_make_immortal(b);
+    TEST_ASSERT_TRUE(dc_int_is_immortal(immortal_value));
+    for (int k = 0; k < 4; k++) {
+        dc_complex_int copy = dc_int_retain(immortal_value);
+        dc_int_release(&copy);
+        dc_int_release(&copy);
+    }
+    dc_int_release(&b);
+    dc_complex_int expected = dc_int_from_ints(5, -7);
+    TEST_ASSERT_TRUE(dc_int_eq(immortal_value, expected));
+    dc_int_release(&expected);
+    dc_int_release(&zero);
+    dc_frac_release(&one);
+    dc_double_release(&i);
 }
 
 void test_dc_int_missing_functions(void) {
@@ -241,6 +288,496 @@ void test_dc_int_missing_functions(void) {
     di_release(&neg_a_imag);
 }
 
+void test_dc_int_small_representation(void) {
+    dc_complex_int a = dc_int_from_ints(3, 4);
+    dc_complex_int b = dc_int_from_ints(INT64_MAX, INT64_MIN);
+
+    // Small operands stay inline
+    dc_complex_int prod = dc_int_mul(a, a);  // -7 + 24i
+    TEST_ASSERT_TRUE(prod->is_small);
+    TEST_ASSERT_EQUAL_INT64(-7, prod->small.real);
+    TEST_ASSERT_EQUAL_INT64(24, prod->small.imag);
+
+    // Overflow switches to di_int components
+    dc_complex_int one = dc_int_one();
+    dc_complex_int big = dc_int_add(b, one);
+    TEST_ASSERT_FALSE(big->is_small);
+    char* big_str = dc_int_to_string(big);
+    TEST_ASSERT_EQUAL_STRING("9223372036854775808-9223372036854775808i", big_str);
+
+    dc_complex_int neg = dc_int_negate(b);
+    TEST_ASSERT_FALSE(neg->is_small);
+    char* neg_str = dc_int_to_string(neg);
+    TEST_ASSERT_EQUAL_STRING("-9223372036854775807+9223372036854775808i", neg_str);
+
+    dc_complex_int square = dc_int_mul(b, b);
+    TEST_ASSERT_FALSE(square->is_small);
+
+    // Results that fit again return to the inline form
+    dc_complex_int back = dc_int_sub(big, one);
+    TEST_ASSERT_TRUE(back->is_small);
+    TEST_ASSERT_TRUE(dc_int_eq(back, b));
+    TEST_ASSERT_FALSE(dc_int_eq(big, b));
+
+    di_int real = dc_int_real(big);
+    di_int imag = dc_int_imag(big);
+    dc_complex_int rebuilt = dc_int_from_di(real, imag);
+    TEST_ASSERT_TRUE(dc_int_eq(rebuilt, big));
+
+    // Both components overflowing at once
+    dc_complex_int max = dc_int_from_ints(INT64_MAX, INT64_MAX);
+    dc_complex_int min = dc_int_from_ints(INT64_MIN, INT64_MIN);
+    dc_complex_int one_one = dc_int_from_ints(1, 1);
+    dc_complex_int low_imag = dc_int_from_ints(7, INT64_MIN);
+    dc_complex_int overflows[4] = {dc_int_add(max, one_one), dc_int_sub(min, one_one), dc_int_negate(min),
+                                   dc_int_conj(low_imag)};
+    const char* expected[4] = {"9223372036854775808+9223372036854775808i",
+                               "-9223372036854775809-9223372036854775809i",
+                               "9223372036854775808+9223372036854775808i", "7+9223372036854775808i"};
+    for (int k = 0; k < 4; k++) {
+        TEST_ASSERT_FALSE(overflows[k]->is_small);
+        char* str = dc_int_to_string(overflows[k]);
+        TEST_ASSERT_EQUAL_STRING(expected[k], str);
+        free(str);
+        dc_int_release(&overflows[k]);
+    }
+
+#if DC_STATS
+    // Small results cost the result node alone: no di_int temporaries, no di_mul
+    dc_stats before, after;
+    dc_stats_snapshot(&before);
+    dc_complex_int small[5] = {dc_int_add(a, a), dc_int_sub(a, one), dc_int_mul(a, a), dc_int_negate(a),
+                               dc_int_conj(a)};
+    dc_stats_snapshot(&after);
+    TEST_ASSERT_EQUAL_size_t(5, after.allocations - before.allocations);
+    TEST_ASSERT_EQUAL_size_t(0, after.di_mul_calls - before.di_mul_calls);
+    for (int k = 0; k < 5; k++) {
+        TEST_ASSERT_TRUE(small[k]->is_small);
+        dc_int_release(&small[k]);
+    }
+#endif
+
+    dc_int_release(&max);
+    dc_int_release(&min);
+    dc_int_release(&one_one);
+    dc_int_release(&low_imag);
+
+    dc_int_release(&a);
+    dc_int_release(&b);
+    dc_int_release(&prod);
+    dc_int_release(&one);
+    dc_int_release(&big);
+    dc_int_release(&neg);
+    dc_int_release(&square);
+    dc_int_release(&back);
+    dc_int_release(&rebuilt);
+    di_release(&real);
+    di_release(&imag);
+    free(big_str);
+    free(neg_str);
+}
+
+void test_dc_int_gauss_mul(void) {
+    // Operands above DC_GAUSS_MUL_THRESHOLD take the three-multiplication path
+    const size_t bits = 32 * (DC_GAUSS_MUL_THRESHOLD + 8);
+    di_int ar = di_random(bits), ai0 = di_random(bits), ai = di_negate(ai0);
+    di_int br = di_random(bits), bi = di_random(bits / 2);
+    dc_complex_int a = dc_int_from_di(ar, ai);
+    dc_complex_int b = dc_int_from_di(br, bi);
+
+    di_int want_real, want_imag;
+    dc_int_mul_schoolbook(ar, ai, br, bi, &want_real, &want_imag);
+    dc_complex_int want = dc_int_from_di(want_real, want_imag);
+    dc_complex_int got = dc_int_mul(a, b);
+    TEST_ASSERT_TRUE(dc_int_eq(got, want));
+
+    di_int gauss_real, gauss_imag;
+    dc_int_mul_gauss(ar, ai, br, bi, &gauss_real, &gauss_imag);
+    TEST_ASSERT_TRUE(di_eq(gauss_real, want_real));
+    TEST_ASSERT_TRUE(di_eq(gauss_imag, want_imag));
+
+    // Both forms agree on fractions too
+    df_frac fa = df_from_ints(3, 4), fb = df_from_ints(-5, 6), fc = df_from_ints(7, 9), fd = df_from_ints(2, -3);
+    df_frac s_real, s_imag, g_real, g_imag;
+    dc_frac_mul_schoolbook(fa, fb, fc, fd, &s_real, &s_imag);
+    dc_frac_mul_gauss(fa, fb, fc, fd, &g_real, &g_imag);
+    TEST_ASSERT_TRUE(df_eq(s_real, g_real));
+    TEST_ASSERT_TRUE(df_eq(s_imag, g_imag));
+
+    di_release(&ar);
+    di_release(&ai0);
+    di_release(&ai);
+    di_release(&br);
+    di_release(&bi);
+    di_release(&want_real);
+    di_release(&want_imag);
+    di_release(&gauss_real);
+    di_release(&gauss_imag);
+    dc_int_release(&a);
+    dc_int_release(&b);
+    dc_int_release(&want);
+    dc_int_release(&got);
+    df_release(&fa);
+    df_release(&fb);
+    df_release(&fc);
+    df_release(&fd);
+    df_release(&s_real);
+    df_release(&s_imag);
+    df_release(&g_real);
+    df_release(&g_imag);
+}
+
+// Random Gaussian integer with components of the given number of bits
+static dc_complex_int random_gaussian(size_t bits) {
+    di_int real = di_random(bits), imag = di_random(bits);
+    di_int neg_imag = di_negate(imag);
+    dc_complex_int result = dc_int_from_di(real, neg_imag);
+    di_release(&real);
+    di_release(&imag);
+    di_release(&neg_imag);
+    return result;
+}
+
+void test_dc_int_gcd(void) {
+    // Small values: gcd((2+i)(3+2i), (2+i)(1-4i)) = 2+i up to a unit
+    dc_complex_int p = dc_int_from_ints(2, 1);
+    dc_complex_int q = dc_int_from_ints(3, 2);
+    dc_complex_int r = dc_int_from_ints(1, -4);
+    dc_complex_int pq = dc_int_mul(p, q);
+    dc_complex_int pr = dc_int_mul(p, r);
+    dc_complex_int g = dc_int_gcd(pq, pr);
+    TEST_ASSERT_TRUE(dc_int_eq(g, p));
+
+    // Normalization picks the first-quadrant associate; gcd(0, 0) = 0
+    dc_complex_int neg_i_p = dc_int_from_ints(1, -2);  // -i * (2+i)
+    dc_complex_int zero = dc_int_zero();
+    dc_complex_int g_assoc = dc_int_gcd(neg_i_p, zero);
+    TEST_ASSERT_TRUE(dc_int_eq(g_assoc, p));
+    dc_complex_int g_zero = dc_int_gcd(zero, zero);
+    TEST_ASSERT_TRUE(dc_int_is_zero(g_zero));
+    const int64_t associates[][2] = {{2, 1}, {-1, 2}, {-2, -1}, {1, -2}};
+    for (size_t k = 0; k < 4; k++) {
+        dc_complex_int unit_p = dc_int_from_ints(associates[k][0], associates[k][1]);
+        dc_complex_int unit_g = dc_int_gcd(zero, unit_p);
+        TEST_ASSERT_TRUE(dc_int_eq(unit_g, p));
+        dc_int_release(&unit_p);
+        dc_int_release(&unit_g);
+    }
+
+    // divmod: a = q b + r with norm(r) <= norm(b) / 2
+    dc_complex_int a = dc_int_from_ints(27, -23);
+    dc_complex_int b = dc_int_from_ints(8, 1);
+    dc_complex_int quot, rem;
+    dc_int_divmod(a, b, &quot, &rem);
+    dc_complex_int qb = dc_int_mul(quot, b);
+    dc_complex_int back = dc_int_add(qb, rem);
+    TEST_ASSERT_TRUE(dc_int_eq(back, a));
+    TEST_ASSERT_TRUE(2 * (rem->small.real * rem->small.real + rem->small.imag * rem->small.imag) <= 65);
+
+#if DC_STATS
+    // Components below 2^30 run on int64_t: only the result nodes are allocated
+    dc_stats before, after;
+    dc_stats_snapshot(&before);
+    dc_complex_int small_g = dc_int_gcd(pq, pr);
+    dc_complex_int small_q, small_r;
+    dc_int_divmod(a, b, &small_q, &small_r);
+    dc_stats_snapshot(&after);
+    TEST_ASSERT_EQUAL_size_t(3, after.allocations - before.allocations);
+    dc_int_release(&small_g);
+    dc_int_release(&small_q);
+    dc_int_release(&small_r);
+#endif
+
+    // Multi-limb operands with a known common factor, through the Lehmer and plain loops
+    dc_complex_int common = random_gaussian(150);
+    dc_complex_int u = random_gaussian(200);
+    dc_complex_int v = random_gaussian(180);
+    dc_complex_int big_a = dc_int_mul(common, u);
+    dc_complex_int big_b = dc_int_mul(common, v);
+    dc_complex_int big_g = dc_int_gcd(big_a, big_b);
+    dc_complex_int plain_g = dc_int_gcd_impl(big_a, big_b, false);
+    TEST_ASSERT_TRUE(dc_int_eq(big_g, plain_g));
+    dc_complex_int big_q, big_r;
+    dc_int_divmod(big_g, common, &big_q, &big_r);  // common divides the gcd
+    TEST_ASSERT_TRUE(dc_int_is_zero(big_r));
+
+    // Bezout identity a x + b y = g for small and multi-limb operands
+    dc_complex_int x, y;
+    dc_complex_int xg = dc_int_xgcd(pq, pr, &x, &y);
+    TEST_ASSERT_TRUE(dc_int_eq(xg, g));
+    dc_complex_int ax = dc_int_mul(pq, x), by = dc_int_mul(pr, y);
+    dc_complex_int bezout = dc_int_add(ax, by);
+    TEST_ASSERT_TRUE(dc_int_eq(bezout, g));
+
+    dc_complex_int bx, bby;
+    dc_complex_int big_xg = dc_int_xgcd(big_a, big_b, &bx, &bby);
+    TEST_ASSERT_TRUE(dc_int_eq(big_xg, big_g));
+    dc_complex_int big_ax = dc_int_mul(big_a, bx), big_by = dc_int_mul(big_b, bby);
+    dc_complex_int big_bezout = dc_int_add(big_ax, big_by);
+    TEST_ASSERT_TRUE(dc_int_eq(big_bezout, big_g));
+
+    dc_complex_int* values[] = {&p, &q, &r, &pq, &pr, &g, &neg_i_p, &zero, &g_assoc, &g_zero, &a, &b, &quot,
+                                &rem, &qb, &back, &common, &u, &v, &big_a, &big_b, &big_g, &plain_g, &big_q,
+                                &big_r, &x, &y, &xg, &ax, &by, &bezout, &bx, &bby, &big_xg, &big_ax, &big_by,
+                                &big_bezout};
+    for (size_t k = 0; k < sizeof(values) / sizeof(values[0]); k++) {
+        dc_int_release(values[k]);
+    }
+}
+
+// unit * product(primes[k]^exponents[k]), with every listed prime checked to be prime
+static dc_complex_int factorization_product(dc_int_factorization f) {
+    dc_complex_int product = dc_int_retain(f.unit);
+    for (size_t k = 0; k < f.count; k++) {
+        TEST_ASSERT_TRUE(dc_int_is_prime(f.primes[k]));
+        for (size_t j = 0; j < f.exponents[k]; j++) {
+            dc_complex_int next = dc_int_mul(product, f.primes[k]);
+            dc_int_release(&product);
+            product = next;
+        }
+    }
+    return product;
+}
+
+void test_dc_int_factor(void) {
+    // Primality: split, ramified and inert primes, and their non-prime neighbours
+    dc_complex_int two_i = dc_int_from_ints(2, 1);
+    dc_complex_int one_i = dc_int_from_ints(1, 1);
+    dc_complex_int seven_i = dc_int_from_ints(0, -7);
+    dc_complex_int three = dc_int_from_ints(3, 0);
+    dc_complex_int five = dc_int_from_ints(5, 0);
+    dc_complex_int three_four = dc_int_from_ints(3, 4);
+    dc_complex_int unit = dc_int_from_ints(0, 1);
+    TEST_ASSERT_TRUE(dc_int_is_prime(two_i));
+    TEST_ASSERT_TRUE(dc_int_is_prime(one_i));
+    TEST_ASSERT_TRUE(dc_int_is_prime(seven_i));
+    TEST_ASSERT_TRUE(dc_int_is_prime(three));
+    TEST_ASSERT_FALSE(dc_int_is_prime(five));
+    TEST_ASSERT_FALSE(dc_int_is_prime(three_four));
+    TEST_ASSERT_FALSE(dc_int_is_prime(unit));
+
+    // 2 = -i (1+i)^2
+    dc_complex_int two = dc_int_from_ints(2, 0);
+    dc_int_factorization f2 = dc_int_factor(two);
+    TEST_ASSERT_EQUAL_size_t(1, f2.count);
+    TEST_ASSERT_TRUE(dc_int_eq(f2.primes[0], one_i));
+    TEST_ASSERT_EQUAL_size_t(2, f2.exponents[0]);
+    dc_complex_int neg_i = dc_int_from_ints(0, -1);
+    TEST_ASSERT_TRUE(dc_int_eq(f2.unit, neg_i));
+
+    // (3+4i)^2 * 3 * 9i = (2+i)^4 * 3^3 * unit: the split pair is counted separately
+    dc_complex_int sq = dc_int_mul(three_four, three_four);
+    dc_complex_int sq3 = dc_int_mul(sq, three);
+    dc_complex_int nine_i = dc_int_from_ints(0, 9);
+    dc_complex_int mixed = dc_int_mul(sq3, nine_i);
+    dc_int_factorization fm = dc_int_factor(mixed);
+    TEST_ASSERT_EQUAL_size_t(2, fm.count);
+    TEST_ASSERT_TRUE(dc_int_eq(fm.primes[0], two_i));
+    TEST_ASSERT_EQUAL_size_t(4, fm.exponents[0]);
+    TEST_ASSERT_TRUE(dc_int_eq(fm.primes[1], three));
+    TEST_ASSERT_EQUAL_size_t(3, fm.exponents[1]);
+    dc_complex_int mixed_back = factorization_product(fm);
+    TEST_ASSERT_TRUE(dc_int_eq(mixed_back, mixed));
+
+    // 2034709 = 1255^2 + 678^2 squared as a norm: no table factors, so Pollard rho splits it
+    dc_complex_int rational = dc_int_from_ints(2034709, 0);
+    dc_int_factorization fr = dc_int_factor(rational);
+    TEST_ASSERT_EQUAL_size_t(2, fr.count);
+    dc_complex_int split_a = dc_int_from_ints(1255, 678);
+    dc_complex_int split_b = dc_int_from_ints(678, 1255);
+    TEST_ASSERT_TRUE(dc_int_eq(fr.primes[0], split_a));
+    TEST_ASSERT_TRUE(dc_int_eq(fr.primes[1], split_b));
+    dc_complex_int rational_back = factorization_product(fr);
+    TEST_ASSERT_TRUE(dc_int_eq(rational_back, rational));
+
+    // Norms above 64 bits: a prime square split by Hermite-Serret, and a composite split by big-integer rho
+    dc_complex_int big_pi = dc_int_from_ints(14417303107, 1486393352);
+    dc_complex_int mid_pi = dc_int_from_ints(5910661, 4247230);
+    TEST_ASSERT_TRUE(dc_int_is_prime(big_pi));
+    dc_complex_int big_sq = dc_int_mul(big_pi, big_pi);
+    dc_complex_int big = dc_int_mul(big_sq, two_i);
+    dc_int_factorization fb = dc_int_factor(big);
+    TEST_ASSERT_EQUAL_size_t(2, fb.count);
+    TEST_ASSERT_TRUE(dc_int_eq(fb.primes[1], big_pi));
+    TEST_ASSERT_EQUAL_size_t(2, fb.exponents[1]);
+    dc_complex_int big_back = factorization_product(fb);
+    TEST_ASSERT_TRUE(dc_int_eq(big_back, big));
+
+    dc_complex_int semi = dc_int_mul(split_a, mid_pi);
+    TEST_ASSERT_FALSE(dc_int_is_prime(semi));
+    dc_int_factorization fs = dc_int_factor(semi);
+    TEST_ASSERT_EQUAL_size_t(2, fs.count);
+    dc_complex_int semi_back = factorization_product(fs);
+    TEST_ASSERT_TRUE(dc_int_eq(semi_back, semi));
+
+    // 399165290221 * 798330580441 is a strong pseudoprime to bases 2..37; its split factors are not prime
+    di_int pseudo_norm = di_from_string("318665857834031151167461", 10);
+    di_int zero_di = di_from_int64(0);
+    dc_complex_int pseudo = dc_int_from_di(pseudo_norm, zero_di);
+    dc_complex_int pseudo_split = dc_int_from_ints(564498787969, 2641252650);
+    TEST_ASSERT_FALSE(dc_int_is_prime(pseudo));
+    TEST_ASSERT_FALSE(dc_int_is_prime(pseudo_split));
+    dc_int_factorization fp = dc_int_factor(pseudo);
+    TEST_ASSERT_EQUAL_size_t(4, fp.count);
+    dc_complex_int pseudo_back = factorization_product(fp);
+    TEST_ASSERT_TRUE(dc_int_eq(pseudo_back, pseudo));
+    di_release(&pseudo_norm);
+    di_release(&zero_di);
+
+    dc_int_factorization* factorizations[] = {&f2, &fm, &fr, &fb, &fs, &fp};
+    for (size_t k = 0; k < sizeof(factorizations) / sizeof(factorizations[0]); k++) {
+        dc_int_factorization_release(factorizations[k]);
+    }
+    dc_complex_int* values[] = {&two_i, &one_i, &seven_i, &three, &five, &three_four, &unit, &two, &neg_i, &sq,
+                                &sq3, &nine_i, &mixed, &mixed_back, &rational, &split_a, &split_b,
+                                &rational_back, &big_pi, &mid_pi, &big_sq, &big, &big_back, &semi, &semi_back,
+                                &pseudo, &pseudo_split, &pseudo_back};
+    for (size_t k = 0; k < sizeof(values) / sizeof(values[0]); k++) {
+        dc_int_release(values[k]);
+    }
+}
+
+void test_dc_int_norm(void) {
+    dc_complex_int a = dc_int_from_ints(3, 4);
+    dc_complex_int five = dc_int_from_ints(-5, 0);
+    dc_complex_int small = dc_int_from_ints(1, -1);
+    dc_complex_int six = dc_int_from_ints(0, 6);
+    dc_complex_int four_four = dc_int_from_ints(4, 4);
+    dc_complex_int huge = dc_int_from_ints(INT64_MAX, INT64_MIN);
+
+    di_int n = dc_int_norm(a);
+    int64_t value = 0;
+    TEST_ASSERT_TRUE(di_to_int64(n, &value));
+    TEST_ASSERT_EQUAL_INT64(25, value);
+
+    // (2^63 - 1)^2 + 2^126 overflows int64_t and takes the di_int path
+    di_int huge_norm = dc_int_norm(huge);
+    di_int expected = di_from_string("170141183460469231713240559642174554113", 10);
+    TEST_ASSERT_TRUE(di_eq(huge_norm, expected));
+
+    // Both squares fit int64_t but their sum does not
+    dc_complex_int edge = dc_int_from_ints(3037000499, -3037000499);
+    di_int edge_norm = dc_int_norm(edge);
+    di_int edge_expected = di_from_string("18446744061852498002", 10);
+    TEST_ASSERT_TRUE(di_eq(edge_norm, edge_expected));
+
+#if DC_STATS
+    // Small norms are computed on int64_t: they allocate no more than the result itself
+    dc_stats before, middle, after;
+    dc_stats_snapshot(&before);
+    di_int result_only = di_from_int64(36);
+    dc_stats_snapshot(&middle);
+    di_int small_norm = dc_int_norm(six);
+    dc_stats_snapshot(&after);
+    TEST_ASSERT_EQUAL_size_t(middle.allocations - before.allocations, after.allocations - middle.allocations);
+    TEST_ASSERT_EQUAL_size_t(0, after.di_mul_calls - middle.di_mul_calls);
+    di_release(&result_only);
+    di_release(&small_norm);
+#endif
+
+    // Equal, bit-length decided, and close magnitudes
+    TEST_ASSERT_EQUAL_INT(0, dc_int_compare_abs(a, five));
+    TEST_ASSERT_TRUE(dc_int_compare_abs(a, small) > 0);
+    TEST_ASSERT_TRUE(dc_int_compare_abs(small, huge) < 0);
+    TEST_ASSERT_TRUE(dc_int_compare_abs(six, four_four) > 0);
+    TEST_ASSERT_TRUE(dc_int_compare_abs(four_four, six) < 0);
+
+    di_release(&n);
+    di_release(&huge_norm);
+    di_release(&expected);
+    di_release(&edge_norm);
+    di_release(&edge_expected);
+    dc_complex_int* values[] = {&a, &five, &small, &six, &four_four, &huge, &edge};
+    for (size_t k = 0; k < sizeof(values) / sizeof(values[0]); k++) {
+        dc_int_release(values[k]);
+    }
+}
+
+void test_dc_int_pow(void) {
+    dc_complex_int z = dc_int_from_ints(-3, 2);
+    dc_complex_int zero = dc_int_zero();
+
+    // Against repeated multiplication, odd and even exponents
+    dc_complex_int expected = dc_int_one();
+    for (uint64_t e = 0; e <= 13; e++) {
+        dc_complex_int p = dc_int_pow(z, e);
+        TEST_ASSERT_TRUE(dc_int_eq(p, expected));
+        dc_int_release(&p);
+        dc_int_mul_into(&expected, expected, z);
+    }
+    dc_int_release(&expected);
+
+    dc_complex_int zero_zero = dc_int_pow(zero, 0);
+    dc_complex_int one = dc_int_one();
+    TEST_ASSERT_TRUE(dc_int_eq(zero_zero, one));
+
+    // Squares near the int64_t bounds, where one or both parts of the square overflow
+    const int64_t bases[][2] = {{3037000499, 3037000499}, {-3037000499, 1}, {INT64_MAX, 1},
+                                {INT64_MIN, INT64_MIN}, {1, INT64_MIN}, {-4294967296, 4294967295}};
+    for (size_t k = 0; k < sizeof(bases) / sizeof(bases[0]); k++) {
+        dc_complex_int base = dc_int_from_ints(bases[k][0], bases[k][1]);
+        dc_complex_int want = dc_int_mul(base, base);
+        dc_complex_int square = dc_int_pow(base, 2);
+        TEST_ASSERT_TRUE(dc_int_eq(square, want));
+        dc_int_mul_into(&want, want, base);
+        dc_complex_int cube = dc_int_pow(base, 3);
+        TEST_ASSERT_TRUE(dc_int_eq(cube, want));
+        dc_int_release(&base);
+        dc_int_release(&want);
+        dc_int_release(&square);
+        dc_int_release(&cube);
+    }
+
+#if DC_STATS
+    // Small powers square and multiply on int64_t without any di_mul
+    dc_stats before, after;
+    dc_stats_snapshot(&before);
+    dc_complex_int small_power = dc_int_pow(z, 13);
+    dc_stats_snapshot(&after);
+    TEST_ASSERT_TRUE(small_power->is_small);
+    TEST_ASSERT_EQUAL_size_t(0, after.di_mul_calls - before.di_mul_calls);
+    dc_int_release(&small_power);
+#endif
+
+    // (1+i)^128 = 2^64 overflows int64_t in the squaring kernel
+    dc_complex_int one_i = dc_int_from_ints(1, 1);
+    dc_complex_int big = dc_int_pow(one_i, 128);
+    di_int two_64_real = di_from_string("18446744073709551616", 10);
+    di_int two_64_imag = di_zero();
+    dc_complex_int two_64 = dc_int_from_di(two_64_real, two_64_imag);
+    TEST_ASSERT_TRUE(dc_int_eq(big, two_64));
+
+    // powmod matches pow followed by the nearest remainder
+    dc_complex_int m = dc_int_from_ints(7, -4);
+    dc_complex_int power = dc_int_pow(z, 45);
+    dc_complex_int q, r;
+    dc_int_divmod(power, m, &q, &r);
+    di_int e45 = di_from_int64(45);
+    dc_complex_int pm = dc_int_powmod(z, e45, m);
+    TEST_ASSERT_TRUE(dc_int_eq(pm, r));
+
+    // Fermat in Z[i]: z^(N(p) - 1) = 1 mod p for a Gaussian prime p = 2+5i not dividing z
+    dc_complex_int gp = dc_int_from_ints(2, 5);
+    di_int e28 = di_from_int64(28);
+    dc_complex_int fermat = dc_int_powmod(z, e28, gp);
+    TEST_ASSERT_TRUE(dc_int_eq(fermat, one));
+
+    di_int e0 = di_from_int64(0);
+    dc_complex_int pm0 = dc_int_powmod(z, e0, m);
+    TEST_ASSERT_TRUE(dc_int_eq(pm0, one));
+
+    di_release(&two_64_real);
+    di_release(&two_64_imag);
+    di_release(&e45);
+    di_release(&e28);
+    di_release(&e0);
+    dc_complex_int* values[] = {&z, &zero, &zero_zero, &one, &one_i, &big, &two_64, &m,
+                                &power, &q, &r, &pm, &gp, &fermat, &pm0};
+    for (size_t k = 0; k < sizeof(values) / sizeof(values[0]); k++) {
+        dc_int_release(values[k]);
+    }
+}
+
 // ============================================================================
 // FRACTION COMPLEX TESTS
 // ============================================================================
@@ -450,6 +987,298 @@ void test_dc_frac_comparisons_and_string(void) {
     free(str_i);
 }
 
+void test_dc_frac_div_fused(void) {
+    dc_complex_frac a = dc_frac_from_ints(3, 4, -5, 6);  // 3/4 - 5/6i
+    dc_complex_frac divisors[4] = {
+        dc_frac_from_ints(2, 3, 7, 5),    // general
+        dc_frac_from_ints(-2, 9, 0, 1),   // real
+        dc_frac_from_ints(0, 1, -4, 7),   // purely imaginary
+        dc_frac_from_ints(-1, 2, -1, 3),  // negative components
+    };
+
+    for (int k = 0; k < 4; k++) {
+        // (a / b) * b == a and b * (1 / b) == 1
+        dc_complex_frac quot = dc_frac_div(a, divisors[k]);
+        dc_complex_frac back = dc_frac_mul(quot, divisors[k]);
+        TEST_ASSERT_TRUE(dc_frac_eq(back, a));
+        dc_complex_frac recip = dc_frac_reciprocal(divisors[k]);
+        dc_complex_frac unit = dc_frac_mul(recip, divisors[k]);
+        dc_complex_frac one = dc_frac_one();
+        TEST_ASSERT_TRUE(dc_frac_eq(unit, one));
+
+        // Components come out in lowest terms with positive denominators
+        TEST_ASSERT_FALSE(di_is_negative(quot->real->denominator));
+        TEST_ASSERT_FALSE(di_is_negative(quot->imag->denominator));
+        di_int g = di_gcd(quot->real->numerator, quot->real->denominator);
+        TEST_ASSERT_TRUE(di_is_one(g));
+
+        dc_frac_release(&quot);
+        dc_frac_release(&back);
+        dc_frac_release(&recip);
+        dc_frac_release(&unit);
+        dc_frac_release(&one);
+        di_release(&g);
+    }
+
+    // Exact values: (3/4 - 5/6i) / (2/3 + 7/5i) and 1 / ((-4/7)i) = 7/4i
+    dc_complex_frac quot = dc_frac_div(a, divisors[0]);
+    char* quot_str = dc_frac_to_string(quot);
+    TEST_ASSERT_EQUAL_STRING("-150/541-1445/2164i", quot_str);
+    dc_complex_frac recip = dc_frac_reciprocal(divisors[2]);
+    char* recip_str = dc_frac_to_string(recip);
+    TEST_ASSERT_EQUAL_STRING("7/4i", recip_str);
+
+    dc_frac_release(&a);
+    for (int k = 0; k < 4; k++) {
+        dc_frac_release(&divisors[k]);
+    }
+    dc_frac_release(&quot);
+    dc_frac_release(&recip);
+    free(quot_str);
+    free(recip_str);
+}
+
+// Numerator and denominator of a reduced fraction
+static void assert_frac_parts(int64_t num, int64_t den, df_frac f) {
+    int64_t n = 0, d = 0;
+    TEST_ASSERT_TRUE(di_to_int64(f->numerator, &n));
+    TEST_ASSERT_TRUE(di_to_int64(f->denominator, &d));
+    TEST_ASSERT_EQUAL_INT64(num, n);
+    TEST_ASSERT_EQUAL_INT64(den, d);
+}
+
+void test_dc_frac_norm(void) {
+    dc_complex_frac coprime = dc_frac_from_ints(1, 2, 3, 4);  // 1/4 + 9/16
+    dc_complex_frac same = dc_frac_from_ints(1, 5, 2, 5);     // 5/25 reduces to 1/5
+    dc_complex_frac shared = dc_frac_from_ints(1, 2, 1, 6);   // 1/4 + 1/36 = 10/36 = 5/18
+    dc_complex_frac integral = dc_frac_from_ints(3, 1, -4, 1);
+    dc_complex_frac lazy = dc_frac_lazy(shared);
+
+    df_frac n1 = dc_frac_norm(coprime), n2 = dc_frac_norm(same), n3 = dc_frac_norm(shared);
+    df_frac n4 = dc_frac_norm(integral), n5 = dc_frac_norm(lazy);
+    assert_frac_parts(13, 16, n1);
+    assert_frac_parts(1, 5, n2);
+    assert_frac_parts(5, 18, n3);
+    assert_frac_parts(25, 1, n4);
+    assert_frac_parts(5, 18, n5);
+
+    dc_complex_frac swapped = dc_frac_from_ints(3, 4, -1, 2);
+    dc_complex_frac tiny = dc_frac_from_ints(1, 1000, 0, 1);
+    dc_complex_frac half = dc_frac_from_ints(1, 2, 0, 1);
+    TEST_ASSERT_EQUAL_INT(0, dc_frac_compare_abs(coprime, swapped));
+    TEST_ASSERT_TRUE(dc_frac_compare_abs(coprime, tiny) > 0);
+    TEST_ASSERT_TRUE(dc_frac_compare_abs(same, half) < 0);
+    TEST_ASSERT_TRUE(dc_frac_compare_abs(lazy, shared) == 0);
+
+    df_frac norms[] = {n1, n2, n3, n4, n5};
+    for (size_t k = 0; k < sizeof(norms) / sizeof(norms[0]); k++) {
+        df_release(&norms[k]);
+    }
+    dc_complex_frac* values[] = {&coprime, &same, &shared, &integral, &lazy, &swapped, &tiny, &half};
+    for (size_t k = 0; k < sizeof(values) / sizeof(values[0]); k++) {
+        dc_frac_release(values[k]);
+    }
+}
+
+void test_dc_frac_pow(void) {
+    dc_complex_frac z = dc_frac_from_ints(1, 2, -2, 3);
+    dc_complex_frac expected = dc_frac_one();
+    for (int64_t e = 0; e <= 9; e++) {
+        dc_complex_frac p = dc_frac_pow(z, e);
+        TEST_ASSERT_TRUE(dc_frac_eq(p, expected));
+        dc_frac_release(&p);
+        dc_frac_mul_into(&expected, expected, z);
+    }
+    dc_frac_release(&expected);
+
+    // Negative powers go through the reciprocal: (1+i)^-2 = -i/2
+    dc_complex_frac one_i = dc_frac_from_ints(1, 1, 1, 1);
+    dc_complex_frac inv_sq = dc_frac_pow(one_i, -2);
+    dc_complex_frac neg_half_i = dc_frac_from_ints(0, 1, -1, 2);
+    TEST_ASSERT_TRUE(dc_frac_eq(inv_sq, neg_half_i));
+
+    // Even denominators exercise the halving in 2xy; lazy bases take the generic path
+    dc_complex_frac even = dc_frac_from_ints(3, 4, 5, 6);
+    dc_complex_frac lazy = dc_frac_lazy(even);
+    dc_complex_frac eager_pow = dc_frac_pow(even, 7);
+    dc_complex_frac lazy_pow = dc_frac_pow(lazy, 7);
+    dc_complex_frac product = dc_frac_mul(even, even);
+    for (int k = 2; k < 7; k++) dc_frac_mul_into(&product, product, even);
+    TEST_ASSERT_TRUE(dc_frac_eq(eager_pow, product));
+    TEST_ASSERT_TRUE(dc_frac_eq(lazy_pow, product));
+
+    dc_complex_frac* values[] = {&z, &one_i, &inv_sq, &neg_half_i, &even, &lazy, &eager_pow, &lazy_pow, &product};
+    for (size_t k = 0; k < sizeof(values) / sizeof(values[0]); k++) {
+        dc_frac_release(values[k]);
+    }
+}
+
+void test_dc_frac_lazy(void) {
+    // Sum 1/k + i/k for k = 1..12 eagerly and lazily
+    dc_complex_frac eager = dc_frac_zero();
+    dc_complex_frac start = dc_frac_zero();
+    dc_complex_frac lazy = dc_frac_lazy(start);
+    TEST_ASSERT_TRUE(dc_frac_is_lazy(lazy));
+    TEST_ASSERT_FALSE(dc_frac_is_lazy(eager));
+    for (int64_t k = 1; k <= 12; k++) {
+        dc_complex_frac term = dc_frac_from_ints(1, k, 1, k);
+        dc_frac_add_into(&eager, eager, term);
+        dc_frac_add_into(&lazy, lazy, term);
+        dc_frac_release(&term);
+    }
+    TEST_ASSERT_TRUE(dc_frac_is_lazy(lazy));
+    TEST_ASSERT_TRUE(dc_frac_eq(eager, lazy));
+
+    // Printing, accessors and normalize see lowest terms: H(12) = 86021/27720
+    char* str = dc_frac_to_string(lazy);
+    TEST_ASSERT_EQUAL_STRING("86021/27720+86021/27720i", str);
+    df_frac real = dc_frac_real(lazy);
+    TEST_ASSERT_TRUE(df_eq(real, eager->real));
+    TEST_ASSERT_TRUE(di_eq(real->denominator, eager->real->denominator));
+    dc_complex_frac normal = dc_frac_normalize(lazy);
+    TEST_ASSERT_FALSE(dc_frac_is_lazy(normal));
+    TEST_ASSERT_TRUE(di_eq(normal->imag->numerator, eager->imag->numerator));
+
+    // Products and negation stay lazy; division reduces but keeps the mode
+    dc_complex_frac half = dc_frac_from_ints(1, 2, -1, 2);
+    dc_complex_frac prod = dc_frac_mul(lazy, half);
+    dc_complex_frac want_prod = dc_frac_mul(eager, half);
+    TEST_ASSERT_TRUE(dc_frac_is_lazy(prod));
+    TEST_ASSERT_TRUE(dc_frac_eq(prod, want_prod));
+    dc_complex_frac neg = dc_frac_negate(prod);
+    dc_complex_frac conj = dc_frac_conj(prod);
+    dc_complex_frac quot = dc_frac_div(neg, half);
+    TEST_ASSERT_TRUE(dc_frac_is_lazy(quot));
+    dc_complex_frac want_quot = dc_frac_negate(eager);
+    TEST_ASSERT_TRUE(dc_frac_eq(quot, want_quot));
+    dc_complex_frac want_conj = dc_frac_conj(want_prod);
+    TEST_ASSERT_TRUE(dc_frac_eq(conj, want_conj));
+
+    // Unreduced Gaussian integers are still recognized: 1/2 + 1/2 = 2/2
+    dc_complex_frac lazy_half = dc_frac_lazy(half);
+    dc_complex_frac one = dc_frac_add(lazy_half, lazy_half);
+    dc_complex_frac sum = dc_frac_add(one, one);
+    TEST_ASSERT_TRUE(dc_frac_is_gaussian_int(one));
+    TEST_ASSERT_FALSE(dc_frac_is_gaussian_int(prod));
+    dc_complex_int as_int = dc_frac_to_int(sum);
+    dc_complex_int want_int = dc_int_from_ints(2, -2);
+    TEST_ASSERT_TRUE(dc_int_eq(as_int, want_int));
+
+    // Growth past DC_FRAC_LAZY_MAX_BITS forces a reduction: (2/3)(3/2) = 1 repeatedly
+    dc_complex_frac two_thirds = dc_frac_from_ints(2, 3, 0, 1);
+    dc_complex_frac three_halves = dc_frac_from_ints(3, 2, 0, 1);
+    dc_complex_frac acc = dc_frac_lazy(two_thirds);
+    for (int k = 0; k < DC_FRAC_LAZY_MAX_BITS; k++) {
+        dc_frac_mul_into(&acc, acc, three_halves);
+        dc_frac_mul_into(&acc, acc, two_thirds);
+    }
+    TEST_ASSERT_TRUE(di_bit_length(acc->real->denominator) <= DC_FRAC_LAZY_MAX_BITS + 8);
+    TEST_ASSERT_TRUE(dc_frac_eq(acc, two_thirds));
+
+    dc_frac_release(&eager);
+    dc_frac_release(&start);
+    dc_frac_release(&lazy);
+    dc_frac_release(&normal);
+    dc_frac_release(&half);
+    dc_frac_release(&prod);
+    dc_frac_release(&want_prod);
+    dc_frac_release(&neg);
+    dc_frac_release(&conj);
+    dc_frac_release(&quot);
+    dc_frac_release(&want_quot);
+    dc_frac_release(&want_conj);
+    dc_frac_release(&lazy_half);
+    dc_frac_release(&one);
+    dc_frac_release(&sum);
+    dc_frac_release(&two_thirds);
+    dc_frac_release(&three_halves);
+    dc_frac_release(&acc);
+    dc_int_release(&as_int);
+    dc_int_release(&want_int);
+    df_release(&real);
+    free(str);
+}
+
+void test_dc_cfrac(void) {
+    // Canonical form: sign moves to the numerator and gcd(a, b, d) is divided out
+    dc_complex_cfrac a = dc_cfrac_from_ints(6, -4, -8);  // (-3+2i)/4
+    dc_complex_cfrac b = dc_cfrac_from_ints(1, 1, 2);    // (1+i)/2
+    di_int den = dc_cfrac_denominator(a);
+    int64_t den_value = 0;
+    TEST_ASSERT_TRUE(di_to_int64(den, &den_value));
+    TEST_ASSERT_EQUAL_INT64(4, den_value);
+    char* a_str = dc_cfrac_to_string(a);
+    TEST_ASSERT_EQUAL_STRING("(-3+2i)/4", a_str);
+
+    // Arithmetic agrees with the per-component representation
+    dc_complex_frac fa = dc_cfrac_to_frac(a);
+    dc_complex_frac fb = dc_cfrac_to_frac(b);
+    dc_complex_cfrac ops[4] = {dc_cfrac_add(a, b), dc_cfrac_sub(a, b), dc_cfrac_mul(a, b), dc_cfrac_div(a, b)};
+    dc_complex_frac want[4] = {dc_frac_add(fa, fb), dc_frac_sub(fa, fb), dc_frac_mul(fa, fb), dc_frac_div(fa, fb)};
+    for (int k = 0; k < 4; k++) {
+        dc_complex_frac got = dc_cfrac_to_frac(ops[k]);
+        TEST_ASSERT_TRUE(dc_frac_eq(got, want[k]));
+        dc_complex_cfrac back = dc_frac_to_cfrac(want[k]);
+        TEST_ASSERT_TRUE(dc_cfrac_eq(back, ops[k]));
+        dc_frac_release(&got);
+        dc_cfrac_release(&back);
+    }
+
+    // (1+i)/2 + (1-i)/2 = 1 over denominator 1
+    dc_complex_cfrac b_conj = dc_cfrac_conj(b);
+    dc_complex_cfrac one = dc_cfrac_add(b, b_conj);
+    char* one_str = dc_cfrac_to_string(one);
+    TEST_ASSERT_EQUAL_STRING("1", one_str);
+    dc_complex_int one_num = dc_cfrac_numerator(one);
+    dc_complex_int int_one = dc_int_one();
+    TEST_ASSERT_TRUE(dc_int_eq(one_num, int_one));
+
+    // |(-3+2i)/4|^2 = 13/16; a - a = 0
+    df_frac norm = dc_cfrac_norm(a);
+    df_frac want_norm = df_from_ints(13, 16);
+    TEST_ASSERT_TRUE(df_eq(norm, want_norm));
+    dc_complex_cfrac neg = dc_cfrac_negate(a);
+    dc_complex_cfrac zero = dc_cfrac_add(a, neg);
+    TEST_ASSERT_TRUE(dc_cfrac_is_zero(zero));
+    char* zero_str = dc_cfrac_to_string(zero);
+    TEST_ASSERT_EQUAL_STRING("0", zero_str);
+    dc_complex_cfrac half_i = dc_cfrac_from_ints(0, -1, 2);
+    char* half_i_str = dc_cfrac_to_string(half_i);
+    TEST_ASSERT_EQUAL_STRING("-i/2", half_i_str);
+
+    // Different component denominators meet at their lcm: 1/6 + 3/4i = (2+9i)/12
+    dc_complex_frac mixed = dc_frac_from_ints(1, 6, 3, 4);
+    dc_complex_cfrac common = dc_frac_to_cfrac(mixed);
+    dc_complex_cfrac want_common = dc_cfrac_from_ints(2, 9, 12);
+    TEST_ASSERT_TRUE(dc_cfrac_eq(common, want_common));
+
+    dc_cfrac_release(&a);
+    dc_cfrac_release(&b);
+    for (int k = 0; k < 4; k++) {
+        dc_cfrac_release(&ops[k]);
+        dc_frac_release(&want[k]);
+    }
+    dc_cfrac_release(&b_conj);
+    dc_cfrac_release(&one);
+    dc_cfrac_release(&neg);
+    dc_cfrac_release(&zero);
+    dc_cfrac_release(&half_i);
+    dc_cfrac_release(&common);
+    dc_cfrac_release(&want_common);
+    dc_frac_release(&fa);
+    dc_frac_release(&fb);
+    dc_frac_release(&mixed);
+    dc_int_release(&one_num);
+    dc_int_release(&int_one);
+    di_release(&den);
+    df_release(&norm);
+    df_release(&want_norm);
+    free(a_str);
+    free(one_str);
+    free(zero_str);
+    free(half_i_str);
+}
+
 // ============================================================================
 // DOUBLE COMPLEX TESTS
 // ============================================================================
@@ -515,7 +1344,8 @@ void test_dc_double_transcendental(void) {
     dc_complex_double b = dc_double_i();                     // 0 + 1i
 
     // e^(i*pi/2) = i
-    dc_complex_double exp_result = dc_double_exp(dc_double_from_doubles(0.0, M_PI/2));
+    dc_complex_double half_pi_i = dc_double_from_doubles(0.0, M_PI/2);
+    dc_complex_double exp_result = dc_double_exp(half_pi_i);
     TEST_ASSERT_DOUBLE_WITHIN(1e-10, 0.0, dc_double_real(exp_result));
     TEST_ASSERT_DOUBLE_WITHIN(1e-10, 1.0, dc_double_imag(exp_result));
 
@@ -527,6 +1357,7 @@ void test_dc_double_transcendental(void) {
 
     dc_double_release(&a);
     dc_double_release(&b);
+    dc_double_release(&half_pi_i);
     dc_double_release(&exp_result);
     dc_double_release(&neg_one);
     dc_double_release(&sqrt_result);
@@ -697,6 +1528,745 @@ void test_dc_double_comparisons_and_special(void) {
     free(str_i);
 }
 
+void test_dcv_double_value_api(void) {
+    dcv_double a = dcv_double_from_doubles(3.0, 4.0);
+    dcv_double b = dcv_double_from_doubles(1.0, -2.0);
+
+    TEST_ASSERT_EQUAL_DOUBLE(4.0, dcv_double_real(dcv_double_add(a, b)));
+    TEST_ASSERT_EQUAL_DOUBLE(2.0, dcv_double_imag(dcv_double_add(a, b)));
+    TEST_ASSERT_EQUAL_DOUBLE(11.0, dcv_double_real(dcv_double_mul(a, b)));
+    TEST_ASSERT_EQUAL_DOUBLE(-2.0, dcv_double_imag(dcv_double_mul(a, b)));
+    TEST_ASSERT_EQUAL_DOUBLE(5.0, dcv_double_abs(a));
+    TEST_ASSERT_TRUE(dcv_double_eq(dcv_double_conj(b), dcv_double_from_doubles(1.0, 2.0)));
+    TEST_ASSERT_TRUE(dcv_double_is_zero(dcv_double_sub(a, a)));
+
+    // Boxed and unboxed results are identical
+    dc_complex_double boxed_a = dc_double_from_value(a);
+    dc_complex_double boxed_b = dc_double_from_value(b);
+    dc_complex_double quot = dc_double_div(boxed_a, boxed_b);
+    dc_complex_double exp = dc_double_exp(boxed_b);
+    dc_complex_double log = dc_double_log(boxed_a);
+    dc_complex_double pow = dc_double_pow(boxed_a, boxed_b);
+
+    TEST_ASSERT_TRUE(dcv_double_eq(dcv_double_div(a, b), dc_double_value(quot)));
+    TEST_ASSERT_TRUE(dcv_double_eq(dcv_double_exp(b), dc_double_value(exp)));
+    TEST_ASSERT_TRUE(dcv_double_eq(dcv_double_log(a), dc_double_value(log)));
+    // cpow may be constant-folded with MPC at -O2, so allow an ulp or two
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, dcv_double_real(dcv_double_pow(a, b)), dc_double_real(pow));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, dcv_double_imag(dcv_double_pow(a, b)), dc_double_imag(pow));
+
+    // Accumulate in registers, box once
+    dcv_double acc = dcv_double_from_doubles(0.0, 0.0);
+    for (int k = 0; k < 4; k++) {
+        acc = dcv_double_add(acc, dcv_double_from_polar(1.0, k * M_PI / 2));
+    }
+    dc_complex_double sum = dc_double_from_value(acc);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 0.0, dc_double_abs(sum));
+
+    dc_double_release(&boxed_a);
+    dc_double_release(&boxed_b);
+    dc_double_release(&quot);
+    dc_double_release(&exp);
+    dc_double_release(&log);
+    dc_double_release(&pow);
+    dc_double_release(&sum);
+}
+
+#if DC_ARENA
+void test_dc_arena(void) {
+    dc_complex_int heap_int = dc_int_from_ints(2, 3);
+    dc_complex_int escaped_int;
+    dc_complex_frac escaped_frac;
+    dc_complex_cfrac escaped_cfrac;
+    dc_complex_double escaped_double;
+
+    dc_arena_begin();
+    {
+        // Temporaries of every family come from the arena
+        dc_complex_int a = dc_int_from_ints(INT64_MAX, 7);
+        dc_complex_int b = dc_int_mul(a, a);
+        TEST_ASSERT_TRUE(dc_arena_contains(a));
+        TEST_ASSERT_TRUE(dc_arena_contains(b));
+        TEST_ASSERT_FALSE(dc_arena_contains(heap_int));
+
+        dc_complex_frac f = dc_frac_from_ints(1, 3, 2, 5);
+        dc_complex_frac g = dc_frac_add(f, f);
+        TEST_ASSERT_TRUE(dc_arena_contains(g));
+        dc_complex_cfrac cf = dc_cfrac_from_ints(3, 4, 10);
+        TEST_ASSERT_TRUE(dc_arena_contains(cf));
+
+        dc_complex_double d = dc_double_from_doubles(1.5, -2.5);
+        TEST_ASSERT_TRUE(dc_arena_contains(d));
+
+        // Nested scopes rewind independently
+        dc_arena_begin();
+        dc_complex_int inner = dc_int_add(b, heap_int);
+        TEST_ASSERT_TRUE(dc_arena_contains(inner));
+        dc_int_release(&inner);
+        TEST_ASSERT_NULL(inner);
+        dc_arena_end();
+
+        // Strings stay on the heap and can be freed normally
+        char* str = dc_int_to_string(b);
+        TEST_ASSERT_EQUAL_STRING(
+            "85070591730234615847396907784232501200+129127208515966861298i", str);
+        free(str);
+
+        escaped_int = dc_int_escape(b);
+        escaped_frac = dc_frac_escape(g);
+        escaped_cfrac = dc_cfrac_escape(cf);
+        escaped_double = dc_double_escape(d);
+        TEST_ASSERT_FALSE(dc_arena_contains(escaped_int));
+        TEST_ASSERT_FALSE(dc_arena_contains(escaped_frac));
+        TEST_ASSERT_FALSE(dc_arena_contains(escaped_cfrac));
+        TEST_ASSERT_FALSE(dc_arena_contains(escaped_double));
+
+        // Escaping keeps lazy mode
+        dc_complex_frac lazy = dc_frac_lazy(g);
+        dc_complex_frac escaped_lazy = dc_frac_escape(lazy);
+        TEST_ASSERT_TRUE(dc_frac_is_lazy(escaped_lazy));
+        TEST_ASSERT_TRUE(dc_frac_eq(escaped_lazy, g));
+        dc_frac_release(&escaped_lazy);
+        dc_frac_release(&lazy);
+
+        // Releasing arena values is harmless
+        dc_int_release(&a);
+        dc_int_release(&b);
+        dc_frac_release(&f);
+        dc_frac_release(&g);
+        dc_cfrac_release(&cf);
+        dc_double_release(&d);
+    }
+    dc_arena_end();
+
+    // Escaped values survive the scope
+    char* str = dc_int_to_string(escaped_int);
+    TEST_ASSERT_EQUAL_STRING(
+        "85070591730234615847396907784232501200+129127208515966861298i", str);
+    free(str);
+
+    str = dc_frac_to_string(escaped_frac);
+    TEST_ASSERT_EQUAL_STRING("2/3+4/5i", str);
+    free(str);
+
+    str = dc_cfrac_to_string(escaped_cfrac);
+    TEST_ASSERT_EQUAL_STRING("(3+4i)/10", str);
+    free(str);
+
+    TEST_ASSERT_EQUAL_DOUBLE(1.5, dc_double_real(escaped_double));
+    TEST_ASSERT_EQUAL_DOUBLE(-2.5, dc_double_imag(escaped_double));
+
+    // Outside a scope, allocation goes to the heap again
+    dc_complex_int after = dc_int_from_ints(1, 1);
+    TEST_ASSERT_FALSE(dc_arena_contains(after));
+
+    dc_int_release(&after);
+    dc_int_release(&escaped_int);
+    dc_frac_release(&escaped_frac);
+    dc_cfrac_release(&escaped_cfrac);
+    dc_double_release(&escaped_double);
+    dc_int_release(&heap_int);
+}
+#endif
+
+// Bitwise equality, treating any two NaNs as equal
+static bool same_double(double x, double y) {
+    if (isnan(x) && isnan(y)) return true;
+    return memcmp(&x, &y, sizeof(double)) == 0;
+}
+
+void test_dc_double_array(void) {
+    // Odd length exercises full vectors plus a scalar tail at every width
+    enum { N = 37 };
+    double complex av[N], bv[N];
+    const double special[] = {0.0, -0.0, 1.0, -2.5, INFINITY, -INFINITY, NAN, 1e308, 5e-324, 3.0};
+    for (int k = 0; k < N; k++) {
+        double* ap = (double*)&av[k];
+        double* bp = (double*)&bv[k];
+        ap[0] = k < 10 ? special[k] : (k * 0.37 - 3.0);
+        ap[1] = k < 10 ? special[(k + 3) % 10] : (1.0 / (k + 1));
+        bp[0] = k < 10 ? special[(k + 7) % 10] : (2.0 - k * 0.11);
+        bp[1] = k < 10 ? special[(k + 4) % 10] : (k * 1e-3);
+    }
+    // Keep divisors nonzero
+    for (int k = 0; k < N; k++) {
+        if (creal(bv[k]) == 0.0 && cimag(bv[k]) == 0.0) ((double*)&bv[k])[0] = 0.5;
+    }
+
+    dc_double_array a = dc_double_array_from_values(av, N);
+    dc_double_array b = dc_double_array_from_values(bv, N);
+    TEST_ASSERT_EQUAL_size_t(N, dc_double_array_length(a));
+    TEST_ASSERT_EQUAL(0, (uintptr_t)dc_double_array_real(a) % DC_DOUBLE_ARRAY_ALIGN);
+    TEST_ASSERT_EQUAL(0, (uintptr_t)dc_double_array_imag(a) % DC_DOUBLE_ARRAY_ALIGN);
+    TEST_ASSERT_NOT_NULL(dc_double_array_simd_level());
+
+    dc_double_array sum = dc_double_array_add(a, b);
+    dc_double_array diff = dc_double_array_sub(a, b);
+    dc_double_array prod = dc_double_array_mul(a, b);
+    dc_double_array quot = dc_double_array_div(a, b);
+    dc_double_array conj = dc_double_array_conj(a);
+    double mags[N], args[N];
+    dc_double_array_abs(a, mags);
+    dc_double_array_arg(a, args);
+
+    // Every element matches the boxed operation bit for bit
+    for (int k = 0; k < N; k++) {
+        dc_complex_double x = dc_double_from_value(av[k]);
+        dc_complex_double y = dc_double_from_value(bv[k]);
+        dc_complex_double r[5] = {dc_double_add(x, y), dc_double_sub(x, y), dc_double_mul(x, y),
+                                  dc_double_div(x, y), dc_double_conj(x)};
+        dc_double_array arrays[5] = {sum, diff, prod, quot, conj};
+        for (int op = 0; op < 5; op++) {
+            double complex got = dc_double_array_get(arrays[op], k);
+            TEST_ASSERT_TRUE(same_double(dc_double_real(r[op]), creal(got)));
+            TEST_ASSERT_TRUE(same_double(dc_double_imag(r[op]), cimag(got)));
+            dc_double_release(&r[op]);
+        }
+        TEST_ASSERT_TRUE(same_double(dc_double_abs(x), mags[k]));
+        TEST_ASSERT_TRUE(same_double(dc_double_arg(x), args[k]));
+        dc_double_release(&x);
+        dc_double_release(&y);
+    }
+
+    // In-place kernels may alias their operands
+    dc_double_array acc = dc_double_array_copy(a);
+    dc_double_array_mul_into(acc, acc, b);
+    dc_double_array_add_into(acc, acc, acc);
+    dc_double_array_sub_into(acc, acc, prod);
+    for (int k = 0; k < N; k++) {
+        double complex got = dc_double_array_get(acc, k);
+        double complex want = dc_double_array_get(prod, k);
+        want = want + want - want;
+        TEST_ASSERT_TRUE(same_double(creal(want), creal(got)));
+        TEST_ASSERT_TRUE(same_double(cimag(want), cimag(got)));
+    }
+
+    // Element access and zero-length arrays
+    dc_double_array z = dc_double_array_new(3);
+    TEST_ASSERT_EQUAL_DOUBLE(0.0, creal(dc_double_array_get(z, 2)));
+    dc_double_array_set(z, 1, 4.0 - 2.0 * I);
+    double complex out[3];
+    dc_double_array_to_values(z, out);
+    TEST_ASSERT_EQUAL_DOUBLE(4.0, creal(out[1]));
+    TEST_ASSERT_EQUAL_DOUBLE(-2.0, cimag(out[1]));
+
+    dc_double_array empty = dc_double_array_new(0);
+    dc_double_array empty_sum = dc_double_array_add(empty, empty);
+    TEST_ASSERT_EQUAL_size_t(0, dc_double_array_length(empty_sum));
+
+    dc_double_array shared = dc_double_array_retain(z);
+    dc_double_array_release(&shared);
+    TEST_ASSERT_NULL(shared);
+
+    dc_double_array_release(&a);
+    dc_double_array_release(&b);
+    dc_double_array_release(&sum);
+    dc_double_array_release(&diff);
+    dc_double_array_release(&prod);
+    dc_double_array_release(&quot);
+    dc_double_array_release(&conj);
+    dc_double_array_release(&acc);
+    dc_double_array_release(&z);
+    dc_double_array_release(&empty);
+    dc_double_array_release(&empty_sum);
+}
+
+// Distance in units in the last place, with matching specials counting as zero
+static double ulp_diff(double got, double want) {
+    if (same_double(got, want)) return 0.0;
+    if (!isfinite(got) || !isfinite(want)) return INFINITY;
+    double scale = fmax(fabs(want), 0x1p-1022);
+    return fabs(got - want) / (nextafter(scale, INFINITY) - scale);
+}
+
+void test_dc_double_array_transcendental(void) {
+    // Random points inside the vector domains plus special values that take the fallback path
+    enum { N = 203 };
+    double complex xs[N];
+    const double special[] = {0.0, -0.0, INFINITY, -INFINITY, NAN, 1e300, -1e300, 5e-324, 710.0, -745.0};
+    uint64_t state = 0x9E3779B97F4A7C15u;
+    for (int k = 0; k < N; k++) {
+        double* p = (double*)&xs[k];
+        for (int c = 0; c < 2; c++) {
+            state = state * 6364136223846793005u + 1442695040888963407u;
+            double u = (double)(state >> 11) * 0x1p-53;
+            p[c] = k < 100 ? (u - 0.5) * 60.0 : (u - 0.5) * 4.0;
+        }
+        if (k % 17 == 0) p[k % 2] = special[(k / 17) % 10];
+    }
+
+    dc_double_array a = dc_double_array_from_values(xs, N);
+    dc_double_array results[5] = {dc_double_array_exp(a), dc_double_array_log(a), dc_double_array_sin(a),
+                                  dc_double_array_cos(a), dc_double_array_sqrt(a)};
+    dcv_double (*reference[5])(dcv_double) = {dcv_double_exp, dcv_double_log, dcv_double_sin, dcv_double_cos,
+                                              dcv_double_sqrt};
+    const double bound[5] = {3.0, 3.0, 4.0, 4.0, 3.0};
+
+    // Each component is within its documented ulp bound of the C99 function; specials match exactly
+    for (int fn = 0; fn < 5; fn++) {
+        for (int k = 0; k < N; k++) {
+            double complex got = dc_double_array_get(results[fn], k);
+            dcv_double want = reference[fn](xs[k]);
+            TEST_ASSERT_TRUE(ulp_diff(creal(got), creal(want)) <= bound[fn]);
+            TEST_ASSERT_TRUE(ulp_diff(cimag(got), cimag(want)) <= bound[fn]);
+        }
+    }
+
+    // In-place form may alias its operand
+    dc_double_array acc = dc_double_array_copy(a);
+    dc_double_array_exp_into(acc, acc);
+    for (int k = 0; k < N; k++) {
+        double complex got = dc_double_array_get(acc, k);
+        double complex want = dc_double_array_get(results[0], k);
+        TEST_ASSERT_TRUE(same_double(creal(want), creal(got)));
+        TEST_ASSERT_TRUE(same_double(cimag(want), cimag(got)));
+    }
+
+    dc_double_array_release(&a);
+    dc_double_array_release(&acc);
+    for (int fn = 0; fn < 5; fn++) dc_double_array_release(&results[fn]);
+}
+
+void test_dc_double_array_file(void) {
+    const char* path = "test_dc_double_array_file.dca";
+    const char* streamed_path = "test_dc_double_array_file_streamed.dca";
+    size_t n = 1000;
+    double* real = malloc(n * sizeof(double));
+    double* imag = malloc(n * sizeof(double));
+    for (size_t k = 0; k < n; k++) {
+        real[k] = (double)k * 0.5;
+        imag[k] = -(double)k;
+    }
+    dc_double_array a = dc_double_array_from_parts(real, imag, n);
+    TEST_ASSERT_TRUE(dc_double_array_save(a, path, true));
+
+    // The view points at aligned columns holding the saved values
+    dc_double_array view = dc_double_array_map(path, true);
+    TEST_ASSERT_NOT_NULL(view);
+    TEST_ASSERT_EQUAL_size_t(n, dc_double_array_length(view));
+    TEST_ASSERT_EQUAL_MEMORY(real, dc_double_array_real(view), n * sizeof(double));
+    TEST_ASSERT_EQUAL_MEMORY(imag, dc_double_array_imag(view), n * sizeof(double));
+    TEST_ASSERT_EQUAL_size_t(0, (uintptr_t)dc_double_array_real(view) % DC_DOUBLE_ARRAY_ALIGN);
+    TEST_ASSERT_EQUAL_size_t(0, (uintptr_t)dc_double_array_imag(view) % DC_DOUBLE_ARRAY_ALIGN);
+
+    // Views work like any array, and writes to them never reach the file
+    dc_double_array_set(view, 0, 7.0 + 7.0 * I);
+    dc_double_array sum = dc_double_array_add(view, a);
+    TEST_ASSERT_EQUAL_DOUBLE(7.0, creal(dc_double_array_get(sum, 0)));
+    TEST_ASSERT_EQUAL_DOUBLE(-2.0, cimag(dc_double_array_get(sum, 1)));
+    dc_double_array again = dc_double_array_map(path, false);
+    TEST_ASSERT_EQUAL_DOUBLE(0.0, creal(dc_double_array_get(again, 0)));
+
+    // A streaming writer fed uneven chunks produces the same array
+    dc_double_array_writer writer = dc_double_array_writer_open(streamed_path, true);
+    TEST_ASSERT_NOT_NULL(writer);
+    for (size_t pos = 0; pos < n; pos += 333) {
+        size_t count = n - pos < 333 ? n - pos : 333;
+        TEST_ASSERT_TRUE(dc_double_array_writer_append(writer, real + pos, imag + pos, count));
+    }
+    TEST_ASSERT_TRUE(dc_double_array_writer_close(&writer));
+    TEST_ASSERT_NULL(writer);
+    dc_double_array streamed = dc_double_array_map(streamed_path, true);
+    TEST_ASSERT_NOT_NULL(streamed);
+    TEST_ASSERT_EQUAL_size_t(n, dc_double_array_length(streamed));
+    TEST_ASSERT_EQUAL_MEMORY(real, dc_double_array_real(streamed), n * sizeof(double));
+    TEST_ASSERT_EQUAL_MEMORY(imag, dc_double_array_imag(streamed), n * sizeof(double));
+
+    writer = dc_double_array_writer_open(streamed_path, false);
+    TEST_ASSERT_TRUE(dc_double_array_writer_close(&writer));
+    dc_double_array empty = dc_double_array_map(streamed_path, true);
+    TEST_ASSERT_NOT_NULL(empty);
+    TEST_ASSERT_EQUAL_size_t(0, dc_double_array_length(empty));
+
+    dc_double_array_release(&view);
+    dc_double_array_release(&again);
+    dc_double_array_release(&streamed);
+    dc_double_array_release(&empty);
+
+    // A corrupted column fails verification only; a truncated file never maps
+    FILE* file = fopen(path, "r+b");
+    TEST_ASSERT_NOT_NULL(file);
+    fseek(file, 64 + 8, SEEK_SET);
+    fputc(0x55, file);
+    fclose(file);
+    TEST_ASSERT_NULL(dc_double_array_map(path, true));
+    dc_double_array unchecked = dc_double_array_map(path, false);
+    TEST_ASSERT_NOT_NULL(unchecked);
+    dc_double_array_release(&unchecked);
+
+    uint8_t header[64];
+    file = fopen(path, "rb");
+    TEST_ASSERT_EQUAL_size_t(sizeof(header), fread(header, 1, sizeof(header), file));
+    fclose(file);
+    file = fopen(path, "wb");
+    fwrite(header, 1, sizeof(header), file);
+    fclose(file);
+    TEST_ASSERT_NULL(dc_double_array_map(path, false));
+    TEST_ASSERT_NULL(dc_double_array_map("test_dc_double_array_file_missing.dca", false));
+
+    remove(path);
+    remove(streamed_path);
+    dc_double_array_release(&a);
+    dc_double_array_release(&sum);
+    free(real);
+    free(imag);
+}
+
+// Direct O(n^2) transform used as the reference
+static void naive_dft(size_t n, const double complex* x, double complex* y, double sign) {
+    for (size_t k = 0; k < n; k++) {
+        double complex sum = 0.0;
+        for (size_t j = 0; j < n; j++) {
+            double angle = sign * 6.283185307179586 * (double)((j * k) % n) / (double)n;
+            sum += x[j] * (cos(angle) + I * sin(angle));
+        }
+        y[k] = sum;
+    }
+}
+
+void test_dc_fft(void) {
+    TEST_ASSERT_TRUE(dc_fft_size_supported(1));
+    TEST_ASSERT_TRUE(dc_fft_size_supported(360));
+    TEST_ASSERT_FALSE(dc_fft_size_supported(0));
+    TEST_ASSERT_FALSE(dc_fft_size_supported(14));
+
+    const size_t sizes[] = {1, 2, 3, 4, 5, 6, 8, 9, 12, 15, 16, 25, 30, 32, 60, 64, 100, 128, 360};
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t n = sizes[s];
+        double complex x[360], want[360], got[360];
+        double re[360], im[360], spec_re[181], spec_im[181], back[360];
+        for (size_t j = 0; j < n; j++) {
+            x[j] = sin(1.3 * j + 0.2) + I * (cos(0.7 * j) - 0.1 * (j % 3));
+            re[j] = creal(x[j]);
+            im[j] = cimag(x[j]);
+            got[j] = x[j];
+        }
+        naive_dft(n, x, want, -1.0);
+        double tol = 1e-13 * n;
+
+        // Interleaved and SoA entry points agree with the direct transform
+        dc_fft_plan plan = dc_fft_plan_new(n);
+        TEST_ASSERT_EQUAL_size_t(n, dc_fft_plan_size(plan));
+        dc_fft_forward_values(plan, got);
+        dc_fft_forward(plan, re, im);
+        for (size_t k = 0; k < n; k++) {
+            TEST_ASSERT_DOUBLE_WITHIN(tol, creal(want[k]), creal(got[k]));
+            TEST_ASSERT_DOUBLE_WITHIN(tol, cimag(want[k]), cimag(got[k]));
+            TEST_ASSERT_DOUBLE_WITHIN(tol, creal(want[k]), re[k]);
+            TEST_ASSERT_DOUBLE_WITHIN(tol, cimag(want[k]), im[k]);
+        }
+
+        // Inverse round-trips
+        dc_fft_inverse_values(plan, got);
+        dc_fft_inverse(plan, re, im);
+        for (size_t k = 0; k < n; k++) {
+            TEST_ASSERT_DOUBLE_WITHIN(1e-13, creal(x[k]), creal(got[k]));
+            TEST_ASSERT_DOUBLE_WITHIN(1e-13, cimag(x[k]), im[k]);
+        }
+
+        // Real input: the half spectrum matches the complex transform of the real parts
+        double complex real_x[360];
+        for (size_t j = 0; j < n; j++) real_x[j] = creal(x[j]);
+        naive_dft(n, real_x, want, -1.0);
+        dc_fft_real_forward(plan, re, spec_re, spec_im);
+        for (size_t k = 0; k <= n / 2; k++) {
+            TEST_ASSERT_DOUBLE_WITHIN(tol, creal(want[k]), spec_re[k]);
+            TEST_ASSERT_DOUBLE_WITHIN(tol, cimag(want[k]), spec_im[k]);
+        }
+        dc_fft_real_inverse(plan, spec_re, spec_im, back);
+        for (size_t j = 0; j < n; j++) TEST_ASSERT_DOUBLE_WITHIN(1e-13, creal(x[j]), back[j]);
+
+        dc_fft_plan_release(&plan);
+        TEST_ASSERT_NULL(plan);
+    }
+
+    // Plans are cached per size
+    dc_fft_plan first = dc_fft_plan_new(48);
+    dc_fft_plan second = dc_fft_plan_new(48);
+    TEST_ASSERT_EQUAL_PTR(first, second);
+    dc_fft_plan_release(&second);
+
+    // Array transforms, in place and out of place
+    double complex values[48];
+    for (size_t j = 0; j < 48; j++) values[j] = (double)j - I * (double)(j % 5);
+    dc_double_array a = dc_double_array_from_values(values, 48);
+    dc_double_array spectrum = dc_double_array_fft(a);
+    dc_fft_forward_values(first, values);
+    for (size_t k = 0; k < 48; k++) {
+        TEST_ASSERT_EQUAL_DOUBLE(creal(values[k]), dc_double_array_real(spectrum)[k]);
+        TEST_ASSERT_EQUAL_DOUBLE(cimag(values[k]), dc_double_array_imag(spectrum)[k]);
+    }
+    dc_double_array restored = dc_double_array_ifft(spectrum);
+    dc_double_array_ifft_into(spectrum, spectrum);
+    for (size_t k = 0; k < 48; k++) {
+        TEST_ASSERT_DOUBLE_WITHIN(1e-12, dc_double_array_real(a)[k], dc_double_array_real(restored)[k]);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-12, dc_double_array_imag(a)[k], dc_double_array_imag(spectrum)[k]);
+    }
+
+    // The cached plan outlives the cache while still referenced
+    dc_fft_plan_cache_clear();
+    TEST_ASSERT_EQUAL_size_t(48, dc_fft_plan_size(first));
+    dc_fft_plan_release(&first);
+
+    dc_double_array empty = dc_double_array_new(0);
+    dc_double_array empty_fft = dc_double_array_fft(empty);
+    TEST_ASSERT_EQUAL_size_t(0, dc_double_array_length(empty_fft));
+
+    dc_double_array_release(&a);
+    dc_double_array_release(&spectrum);
+    dc_double_array_release(&restored);
+    dc_double_array_release(&empty);
+    dc_double_array_release(&empty_fft);
+    dc_fft_plan_cache_clear();
+}
+
+// Schoolbook reference for polynomial products
+static void naive_poly_mul(dc_complex_int* result, const dc_complex_int* a, size_t a_len, const dc_complex_int* b,
+                           size_t b_len) {
+    for (size_t k = 0; k < a_len + b_len - 1; k++) result[k] = dc_int_zero();
+    for (size_t i = 0; i < a_len; i++) {
+        for (size_t j = 0; j < b_len; j++) {
+            dc_complex_int term = dc_int_mul(a[i], b[j]);
+            dc_int_add_into(&result[i + j], result[i + j], term);
+            dc_int_release(&term);
+        }
+    }
+}
+
+void test_dc_int_poly_mul(void) {
+    enum { A = 70, B = 45 };
+    dc_complex_int a[A], b[B], got[2 * A - 1], want[2 * A - 1];
+
+    // Small coefficients, wide coefficients that overflow int64, and a squaring
+    for (int round = 0; round < 3; round++) {
+        for (int k = 0; k < A; k++) {
+            int64_t re = (k * 7919) % 201 - 100, im = (k * 104729) % 157 - 78;
+            if (round == 1 && k % 3 == 0) {
+                di_int base = di_from_int64(re * 1000003 + 17);
+                di_int square = di_mul(base, base);
+                di_int wide = di_mul(square, square);
+                di_release(&square);
+                di_int imag = di_from_int64(im);
+                a[k] = dc_int_from_di(wide, imag);
+                di_release(&base);
+                di_release(&wide);
+                di_release(&imag);
+            } else {
+                a[k] = dc_int_from_ints(round == 1 ? re * INT64_C(1000000007) : re, im);
+            }
+        }
+        for (int k = 0; k < B; k++) b[k] = dc_int_from_ints((k * 31) % 19 - 9, (k * 17) % 23 - 11);
+
+        const dc_complex_int* rhs = round == 2 ? a : b;
+        size_t rhs_len = round == 2 ? A : B;
+        dc_int_poly_mul(got, a, A, rhs, rhs_len);
+        naive_poly_mul(want, a, A, rhs, rhs_len);
+        for (size_t k = 0; k < A + rhs_len - 1; k++) {
+            TEST_ASSERT_TRUE(dc_int_eq(want[k], got[k]));
+            dc_int_release(&got[k]);
+            dc_int_release(&want[k]);
+        }
+        for (int k = 0; k < A; k++) dc_int_release(&a[k]);
+        for (int k = 0; k < B; k++) dc_int_release(&b[k]);
+    }
+
+    // Short operands use the schoolbook path: (1 + i)(1 - i + 2x) = 2 + (2 + 2i)x
+    dc_complex_int p[1] = {dc_int_from_ints(1, 1)};
+    dc_complex_int q[2] = {dc_int_from_ints(1, -1), dc_int_from_ints(2, 0)};
+    dc_complex_int r[2];
+    dc_int_poly_mul(r, p, 1, q, 2);
+    TEST_ASSERT_TRUE(dc_int_eq(r[0], q[1]));
+    dc_complex_int expected = dc_int_from_ints(2, 2);
+    TEST_ASSERT_TRUE(dc_int_eq(r[1], expected));
+
+    // Empty operands produce nothing
+    dc_int_poly_mul(NULL, p, 1, NULL, 0);
+
+    dc_int_release(&expected);
+    dc_int_release(&r[0]);
+    dc_int_release(&r[1]);
+    dc_int_release(&p[0]);
+    dc_int_release(&q[0]);
+    dc_int_release(&q[1]);
+}
+
+#if DC_BIASED_REFCOUNT
+static void* biased_producer(void* arg) {
+    dc_complex_int* ints = arg;
+    ints[0] = dc_int_from_ints(INT64_MAX, 3);
+    ints[1] = dc_int_retain(ints[0]);
+    ints[2] = dc_int_from_ints(5, -7);
+    return NULL;
+}
+
+void test_dc_refcount_biased(void) {
+#if DC_STATS
+    dc_stats before, after;
+    dc_stats_snapshot(&before);
+#endif
+
+    // Values created by a thread that has exited are freed by whichever thread drops them last
+    dc_complex_int ints[3];
+    pthread_t producer;
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&producer, NULL, biased_producer, ints));
+    TEST_ASSERT_EQUAL_INT(0, pthread_join(producer, NULL));
+    TEST_ASSERT_TRUE(dc_int_eq(ints[0], ints[1]));
+    for (int k = 0; k < 3; k++) dc_int_release(&ints[k]);
+
+    // Detaching explicitly hands the calling thread's values over the same way
+    dc_complex_int own = dc_int_from_ints(1, 2);
+    dc_complex_int shared = dc_int_retain(own);
+    dc_refcount_detach();
+    dc_int_release(&own);
+    TEST_ASSERT_TRUE(shared->is_small && shared->small.real == 1);
+    dc_int_release(&shared);
+
+#if DC_STATS
+    dc_stats_snapshot(&after);
+    TEST_ASSERT_EQUAL_size_t(before.live_ints, after.live_ints);
+#endif
+}
+#endif
+
+#if DC_POOL_DOUBLE
+void test_dc_double_pool(void) {
+    dc_pool_stats before, after;
+    dc_double_pool_stats(&before);
+
+    dc_complex_double a = dc_double_from_doubles(1.0, 2.0);
+    dc_complex_double b = dc_double_from_doubles(3.0, 4.0);
+    struct dc_complex_double_internal* a_node = a;
+
+    // Released nodes are handed out again by the next allocation
+    dc_double_release(&a);
+    dc_complex_double sum = dc_double_add(b, b);
+    TEST_ASSERT_EQUAL_PTR(a_node, sum);
+    TEST_ASSERT_EQUAL_DOUBLE(6.0, dc_double_real(sum));
+    TEST_ASSERT_EQUAL_DOUBLE(8.0, dc_double_imag(sum));
+
+    // Churn through more than one slab
+    for (int i = 0; i < DC_POOL_SLAB_NODES * 2; i++) {
+        dc_complex_double t = dc_double_mul(b, b);
+        dc_double_release(&t);
+    }
+
+    dc_double_release(&b);
+    dc_double_release(&sum);
+
+    dc_double_pool_stats(&after);
+    TEST_ASSERT_TRUE(after.slabs >= 1);
+    TEST_ASSERT_TRUE(after.hits - before.hits >= DC_POOL_SLAB_NODES * 2);
+    TEST_ASSERT_EQUAL_INT32(DC_POOL_SLAB_NODES * 2 + 3, after.releases - before.releases);
+    TEST_ASSERT_TRUE(after.hit_rate > 0.9);
+
+    // Detached nodes are adopted by the next refill instead of a new slab; live values survive
+    dc_complex_double kept = dc_double_from_doubles(5.0, 6.0);
+    dc_complex_double freed = dc_double_from_doubles(7.0, 8.0);
+    struct dc_complex_double_internal* freed_node = freed;
+    dc_double_release(&freed);
+    dc_double_pool_detach();
+    dc_complex_double adopted = dc_double_add(kept, kept);
+    TEST_ASSERT_EQUAL_PTR(freed_node, adopted);
+    TEST_ASSERT_EQUAL_DOUBLE(10.0, dc_double_real(adopted));
+    TEST_ASSERT_EQUAL_DOUBLE(6.0, dc_double_imag(kept));
+    dc_double_pool_stats(&before);
+    TEST_ASSERT_EQUAL_size_t(after.slabs, before.slabs);
+    dc_double_release(&kept);
+    dc_double_release(&adopted);
+}
+#endif
+
+#if DC_STATS
+void test_dc_stats(void) {
+    dc_stats before, during, after;
+    dc_stats_snapshot(&before);
+
+    dc_complex_int a = dc_int_from_ints(3, 4);
+    dc_complex_frac f = dc_frac_from_ints(2, 3, 5, 7);
+    dc_complex_frac g = dc_frac_from_ints(1, 6, -1, 14);
+    dc_complex_frac sum = dc_frac_add(f, g);
+    dc_double_array x = dc_double_array_new(8);
+
+    dc_stats_snapshot(&during);
+    TEST_ASSERT_EQUAL_INT(1, (int)(during.live_ints - before.live_ints));
+    TEST_ASSERT_EQUAL_INT(3, (int)(during.live_fracs - before.live_fracs));
+    TEST_ASSERT_EQUAL_INT(1, (int)(during.live_double_arrays - before.live_double_arrays));
+    TEST_ASSERT_TRUE(during.allocations > before.allocations);
+    TEST_ASSERT_TRUE(during.bytes_allocated - before.bytes_allocated >= sizeof(struct dc_complex_int_internal));
+    TEST_ASSERT_TRUE(during.di_mul_calls > before.di_mul_calls);
+    TEST_ASSERT_TRUE(during.di_gcd_calls > before.di_gcd_calls);
+
+    dc_int_release(&a);
+    dc_frac_release(&f);
+    dc_frac_release(&g);
+    dc_frac_release(&sum);
+    dc_double_array_release(&x);
+
+    dc_stats_snapshot(&after);
+    TEST_ASSERT_EQUAL_INT(0, (int)(after.live_ints - before.live_ints));
+    TEST_ASSERT_EQUAL_INT(0, (int)(after.live_fracs - before.live_fracs));
+    TEST_ASSERT_EQUAL_INT(0, (int)(after.live_double_arrays - before.live_double_arrays));
+    TEST_ASSERT_TRUE(after.frees > during.frees);
+
+    // Reset restarts the cumulative counters but not the live ones
+    dc_stats_reset();
+    dc_stats_snapshot(&after);
+    TEST_ASSERT_EQUAL_INT(0, (int)after.allocations);
+    TEST_ASSERT_EQUAL_INT(0, (int)after.di_gcd_calls);
+    TEST_ASSERT_EQUAL_INT(0, (int)(after.live_ints - before.live_ints));
+}
+#endif
+
+#if DC_TRACK_ALLOCS
+// Live values the dump attributes to the given line of this file
+static size_t tracked_at_line(int line) {
+    char expected[64], text[256];
+    snprintf(expected, sizeof(expected), "main.c:%d ", line);
+
+    FILE* out = tmpfile();
+    TEST_ASSERT_NOT_NULL(out);
+    dc_track_dump(out);
+    rewind(out);
+
+    size_t live = 0;
+    while (fgets(text, sizeof(text), out)) {
+        if (strstr(text, expected)) live = (size_t)strtoull(text, NULL, 10);
+    }
+    fclose(out);
+    return live;
+}
+
+void test_dc_track_allocs(void) {
+    FILE* out = tmpfile();
+    TEST_ASSERT_NOT_NULL(out);
+    size_t before = dc_track_dump(out);
+
+    dc_complex_frac a = dc_frac_from_ints(1, 2, 3, 4);
+    dc_complex_frac b = dc_frac_add(a, dc_frac_one()); int add_line = __LINE__;
+    dc_complex_frac shared = dc_frac_retain(b);
+    dc_complex_double d[3];
+    for (int k = 0; k < 3; k++) {
+        d[k] = dc_double_from_doubles(k, 1.0); // same site three times
+    }
+    int loop_line = __LINE__ - 2;
+
+    // Retaining does not create a value; constants are never tracked
+    TEST_ASSERT_EQUAL_INT(5, (int)(dc_track_dump(out) - before));
+    TEST_ASSERT_EQUAL_INT(1, (int)tracked_at_line(add_line));
+    TEST_ASSERT_EQUAL_INT(3, (int)tracked_at_line(loop_line));
+
+    dc_frac_release(&b);
+    TEST_ASSERT_EQUAL_INT(1, (int)tracked_at_line(add_line));
+    dc_frac_release(&shared);
+    TEST_ASSERT_EQUAL_INT(0, (int)tracked_at_line(add_line));
+
+    dc_frac_release(&a);
+    for (int k = 0; k < 3; k++) dc_double_release(&d[k]);
+    TEST_ASSERT_EQUAL_INT(0, (int)(dc_track_dump(out) - before));
+    fclose(out);
+}
+#endif
+
 // ============================================================================
 // TYPE CONVERSION TESTS
 // ============================================================================
@@ -784,6 +2354,130 @@ void test_remaining_type_conversions(void) {
     df_release(&e_frac_imag);
 }
 
+void test_dc_serialization(void) {
+    uint8_t buffer[1024];
+
+    // Small parts take a tag byte plus a varint header and one limb each; the size query is exact
+    dc_complex_int small = dc_int_from_ints(5, -7);
+    TEST_ASSERT_EQUAL_size_t(11, dc_int_serialized_size(small));
+    TEST_ASSERT_EQUAL_size_t(0, dc_int_serialize(small, buffer, 10));
+
+    // Pack one value of each kind back to back
+    dc_complex_int base = dc_int_from_ints(3, -5);
+    dc_complex_int big = dc_int_pow(base, 200);
+    dc_complex_int edge = dc_int_from_ints(INT64_MIN, INT64_MAX);
+    dc_complex_frac frac = dc_frac_from_ints(3, 4, -5, 6);
+    dc_complex_frac start = dc_frac_lazy(frac);
+    dc_complex_frac lazy = dc_frac_add(start, frac);  // 6/8 - 10/12 i, not reduced
+    dc_complex_cfrac cfrac = dc_cfrac_from_ints(-9, 4, 7);
+    dc_complex_double dbl = dc_double_from_doubles(-0.0, INFINITY);
+
+    size_t used = 0;
+    used += dc_int_serialize(small, buffer + used, sizeof(buffer) - used);
+    used += dc_int_serialize(big, buffer + used, sizeof(buffer) - used);
+    used += dc_int_serialize(edge, buffer + used, sizeof(buffer) - used);
+    used += dc_frac_serialize(lazy, buffer + used, sizeof(buffer) - used);
+    used += dc_cfrac_serialize(cfrac, buffer + used, sizeof(buffer) - used);
+    used += dc_double_serialize(dbl, buffer + used, sizeof(buffer) - used);
+    size_t expected = dc_int_serialized_size(small) + dc_int_serialized_size(big) + dc_int_serialized_size(edge) +
+                      dc_frac_serialized_size(lazy) + dc_cfrac_serialized_size(cfrac) + dc_double_serialized_size(dbl);
+    TEST_ASSERT_EQUAL_size_t(expected, used);
+
+    // Read them back in order
+    size_t pos = 0, consumed = 0;
+    dc_complex_int small_back = dc_int_deserialize(buffer + pos, used - pos, &consumed);
+    pos += consumed;
+    dc_complex_int big_back = dc_int_deserialize(buffer + pos, used - pos, &consumed);
+    pos += consumed;
+    dc_complex_int edge_back = dc_int_deserialize(buffer + pos, used - pos, &consumed);
+    pos += consumed;
+    dc_complex_frac lazy_back = dc_frac_deserialize(buffer + pos, used - pos, &consumed);
+    pos += consumed;
+    dc_complex_cfrac cfrac_back = dc_cfrac_deserialize(buffer + pos, used - pos, &consumed);
+    pos += consumed;
+    dc_complex_double dbl_back = dc_double_deserialize(buffer + pos, used - pos, &consumed);
+    pos += consumed;
+    TEST_ASSERT_EQUAL_size_t(used, pos);
+
+    TEST_ASSERT_TRUE(dc_int_eq(small, small_back));
+    TEST_ASSERT_TRUE(dc_int_eq(big, big_back));
+    TEST_ASSERT_TRUE(dc_int_eq(edge, edge_back));
+    TEST_ASSERT_TRUE(dc_frac_is_lazy(lazy_back));
+    TEST_ASSERT_TRUE(dc_frac_eq(lazy, lazy_back));
+    TEST_ASSERT_TRUE(di_eq(lazy->real->denominator, lazy_back->real->denominator));
+    TEST_ASSERT_TRUE(dc_cfrac_eq(cfrac, cfrac_back));
+    TEST_ASSERT_TRUE(signbit(creal(dbl_back->value)));
+    TEST_ASSERT_TRUE(isinf(cimag(dbl_back->value)));
+
+    // Truncated input, another kind's tag and a zero denominator are rejected
+    size_t big_size = dc_int_serialized_size(big);
+    size_t small_size = dc_int_serialized_size(small);
+    for (size_t k = 0; k < big_size; k += 7) {
+        TEST_ASSERT_NULL(dc_int_deserialize(buffer + small_size, k, NULL));
+    }
+    TEST_ASSERT_NULL(dc_frac_deserialize(buffer, used, NULL));
+    TEST_ASSERT_NULL(dc_double_deserialize(buffer, used, NULL));
+    uint8_t encoded[] = {DC_SERIAL_VERSION << 4 | 4, 0x02, 1, 0, 0, 0, 0x00, 0x03, 1, 0, 0, 0};
+    dc_complex_cfrac negative_den = dc_cfrac_deserialize(encoded, sizeof(encoded), NULL);
+    TEST_ASSERT_NULL(negative_den);
+    encoded[7] = 0x02;
+    dc_complex_cfrac valid = dc_cfrac_deserialize(encoded, sizeof(encoded), &consumed);
+    TEST_ASSERT_NOT_NULL(valid);
+    TEST_ASSERT_EQUAL_size_t(sizeof(encoded), consumed);
+    encoded[7] = 0x00;
+    TEST_ASSERT_NULL(dc_cfrac_deserialize(encoded, sizeof(encoded), NULL));
+    dc_cfrac_release(&valid);
+
+    // Non-canonical encodings are rejected: (2 + 0i)/4, and 2/4 unless written lazily
+    encoded[2] = 2;
+    encoded[7] = 0x02;
+    encoded[8] = 4;
+    TEST_ASSERT_NULL(dc_cfrac_deserialize(encoded, sizeof(encoded), NULL));
+    encoded[8] = 3;
+    dc_complex_cfrac coprime = dc_cfrac_deserialize(encoded, sizeof(encoded), NULL);
+    TEST_ASSERT_NOT_NULL(coprime);
+    dc_cfrac_release(&coprime);
+    uint8_t halves[] = {DC_SERIAL_VERSION << 4 | 2, 0x02, 2, 0, 0, 0, 0x02, 4, 0, 0, 0, 0x00, 0x02, 1, 0, 0, 0};
+    TEST_ASSERT_NULL(dc_frac_deserialize(halves, sizeof(halves), NULL));
+    halves[0] = DC_SERIAL_VERSION << 4 | 3;
+    dc_complex_frac lazy_halves = dc_frac_deserialize(halves, sizeof(halves), NULL);
+    TEST_ASSERT_NOT_NULL(lazy_halves);
+    dc_frac_release(&lazy_halves);
+
+    // Doubles keep their bit patterns: infinite imaginary parts, signed zeros and NaN payloads
+    uint64_t payload_bits = 0x7ff8000000001234ULL;
+    double payload;
+    memcpy(&payload, &payload_bits, sizeof(payload));
+    double patterns[][2] = {{1.0, INFINITY}, {-0.0, 0.0}, {payload, -0.0}};
+    for (size_t k = 0; k < 3; k++) {
+        dc_complex_double v = dc_double_from_doubles(0.0, 0.0);
+        ((double*)&v->value)[0] = patterns[k][0];
+        ((double*)&v->value)[1] = patterns[k][1];
+        uint8_t bytes[17];
+        TEST_ASSERT_EQUAL_size_t(sizeof(bytes), dc_double_serialize(v, bytes, sizeof(bytes)));
+        dc_complex_double w = dc_double_deserialize(bytes, sizeof(bytes), NULL);
+        TEST_ASSERT_EQUAL_MEMORY(&v->value, &w->value, sizeof(v->value));
+        dc_double_release(&v);
+        dc_double_release(&w);
+    }
+
+    dc_int_release(&small);
+    dc_int_release(&base);
+    dc_int_release(&big);
+    dc_int_release(&edge);
+    dc_frac_release(&frac);
+    dc_frac_release(&start);
+    dc_frac_release(&lazy);
+    dc_cfrac_release(&cfrac);
+    dc_double_release(&dbl);
+    dc_int_release(&small_back);
+    dc_int_release(&big_back);
+    dc_int_release(&edge_back);
+    dc_frac_release(&lazy_back);
+    dc_cfrac_release(&cfrac_back);
+    dc_double_release(&dbl_back);
+}
+
 // ============================================================================
 // EDGE CASES AND ERROR CONDITIONS
 // ============================================================================
@@ -858,6 +2552,131 @@ void test_string_formatting(void) {
     free(str_g);
 }
 
+// ============================================================================
+// IN-PLACE ARITHMETIC TESTS
+// ============================================================================
+
+void test_inplace_arithmetic(void) {
+    // Accumulating into a uniquely owned node keeps the node
+    dc_complex_int acc = dc_int_from_ints(1, 1);
+    dc_complex_int x = dc_int_from_ints(2, -3);
+    dc_complex_int node = acc;
+    for (int k = 0; k < 10; k++) {
+        dc_int_add_into(&acc, acc, x);
+    }
+    TEST_ASSERT_EQUAL_PTR(node, acc);
+    char* str = dc_int_to_string(acc);
+    TEST_ASSERT_EQUAL_STRING("21-29i", str);
+    free(str);
+
+    // Promotion to big digits and back happens in place
+    dc_complex_int big = dc_int_from_ints(INT64_MAX, 0);
+    dc_int_mul_into(&acc, big, big);
+    TEST_ASSERT_EQUAL_PTR(node, acc);
+    TEST_ASSERT_FALSE(acc->is_small);
+    dc_int_sub_into(&acc, acc, acc);
+    TEST_ASSERT_TRUE(dc_int_is_zero(acc));
+    TEST_ASSERT_TRUE(acc->is_small);
+
+    // Shared destinations are replaced, not mutated
+    dc_complex_int shared = dc_int_retain(x);
+    dc_int_negate_into(&shared, x);
+    TEST_ASSERT_TRUE(shared != x);
+    str = dc_int_to_string(x);
+    TEST_ASSERT_EQUAL_STRING("2-3i", str);
+    free(str);
+    str = dc_int_to_string(shared);
+    TEST_ASSERT_EQUAL_STRING("-2+3i", str);
+    free(str);
+
+    // Singletons are never overwritten
+    dc_complex_int one = dc_int_one();
+    dc_int_conj_into(&one, x);
+    dc_complex_int fresh_one = dc_int_one();
+    str = dc_int_to_string(fresh_one);
+    TEST_ASSERT_EQUAL_STRING("1", str);
+    free(str);
+
+    // Steal variants consume their operand
+    dc_complex_int stolen = dc_int_from_ints(3, 4);
+    node = stolen;
+    stolen = dc_int_conj_steal(stolen);
+    TEST_ASSERT_EQUAL_PTR(node, stolen);
+    stolen = dc_int_add_steal(stolen, x);
+    str = dc_int_to_string(stolen);
+    TEST_ASSERT_EQUAL_STRING("5-7i", str);
+    free(str);
+
+    // Rational results, including from Gaussian integer division
+    dc_complex_frac q = NULL;
+    dc_int_div_into(&q, x, stolen);
+    dc_complex_frac expected = dc_int_div(x, stolen);
+    TEST_ASSERT_TRUE(dc_frac_eq(q, expected));
+    dc_complex_frac fnode = q;
+    dc_frac_reciprocal_into(&q, q);
+    dc_frac_mul_into(&q, q, expected);
+    TEST_ASSERT_EQUAL_PTR(fnode, q);
+    dc_complex_frac frac_one = dc_frac_one();
+    TEST_ASSERT_TRUE(dc_frac_eq(q, frac_one));
+    dc_frac_release(&frac_one);
+    q = dc_frac_sub_steal(q, expected);
+    q = dc_frac_negate_steal(q);
+    dc_frac_div_into(&q, q, expected);
+    dc_frac_add_into(&q, q, q);
+    dc_frac_conj_into(&q, q);
+    str = dc_frac_to_string(q);
+    char* estr = NULL;
+    {
+        dc_complex_frac one_f = dc_frac_one();
+        dc_complex_frac r = dc_frac_sub(expected, one_f);
+        dc_complex_frac r2 = dc_frac_div(r, expected);
+        dc_complex_frac r3 = dc_frac_add(r2, r2);
+        dc_complex_frac r4 = dc_frac_conj(r3);
+        estr = dc_frac_to_string(r4);
+        dc_frac_release(&one_f);
+        dc_frac_release(&r);
+        dc_frac_release(&r2);
+        dc_frac_release(&r3);
+        dc_frac_release(&r4);
+    }
+    TEST_ASSERT_EQUAL_STRING(estr, str);
+    free(str);
+    free(estr);
+
+    // Doubles reuse the node for every operation
+    dc_complex_double d = dc_double_from_doubles(1.0, 2.0);
+    dc_complex_double y = dc_double_from_doubles(0.5, -1.0);
+    dc_complex_double dnode = d;
+    dc_double_mul_into(&d, d, y);
+    dc_double_add_into(&d, d, y);
+    dc_double_sub_into(&d, d, d);
+    dc_double_add_into(&d, d, y);
+    dc_double_div_into(&d, d, y);
+    dc_double_negate_into(&d, d);
+    d = dc_double_conj_steal(d);
+    d = dc_double_mul_steal(d, y);
+    TEST_ASSERT_EQUAL_PTR(dnode, d);
+    TEST_ASSERT_EQUAL_DOUBLE(-0.5, dc_double_real(d));
+    TEST_ASSERT_EQUAL_DOUBLE(1.0, dc_double_imag(d));
+
+    dc_complex_double dnull = NULL;
+    dc_double_conj_into(&dnull, y);
+    TEST_ASSERT_EQUAL_DOUBLE(1.0, dc_double_imag(dnull));
+
+    dc_int_release(&acc);
+    dc_int_release(&x);
+    dc_int_release(&big);
+    dc_int_release(&shared);
+    dc_int_release(&one);
+    dc_int_release(&fresh_one);
+    dc_int_release(&stolen);
+    dc_frac_release(&q);
+    dc_frac_release(&expected);
+    dc_double_release(&d);
+    dc_double_release(&y);
+    dc_double_release(&dnull);
+}
+
 // ============================================================================
 // MAIN TEST RUNNER
 // ============================================================================
@@ -872,6 +2691,12 @@ int main(void) {
     RUN_TEST(test_dc_int_string_conversion);
     RUN_TEST(test_dc_int_memory_management);
     RUN_TEST(test_dc_int_missing_functions);
+    RUN_TEST(test_dc_int_small_representation);
+    RUN_TEST(test_dc_int_gauss_mul);
+    RUN_TEST(test_dc_int_gcd);
+    RUN_TEST(test_dc_int_factor);
+    RUN_TEST(test_dc_int_norm);
+    RUN_TEST(test_dc_int_pow);
 
     // Fraction complex tests
     RUN_TEST(test_dc_frac_creation);
@@ -881,6 +2706,11 @@ int main(void) {
     RUN_TEST(test_dc_frac_memory_management);
     RUN_TEST(test_dc_frac_complete_arithmetic);
     RUN_TEST(test_dc_frac_comparisons_and_string);
+    RUN_TEST(test_dc_frac_div_fused);
+    RUN_TEST(test_dc_frac_norm);
+    RUN_TEST(test_dc_frac_pow);
+    RUN_TEST(test_dc_frac_lazy);
+    RUN_TEST(test_dc_cfrac);
 
     // Double complex tests
     RUN_TEST(test_dc_double_creation);
@@ -891,14 +2721,39 @@ int main(void) {
     RUN_TEST(test_dc_double_complete_arithmetic);
     RUN_TEST(test_dc_double_all_transcendental);
     RUN_TEST(test_dc_double_comparisons_and_special);
+    RUN_TEST(test_dcv_double_value_api);
+    RUN_TEST(test_dc_double_array);
+    RUN_TEST(test_dc_double_array_transcendental);
+    RUN_TEST(test_dc_double_array_file);
+    RUN_TEST(test_dc_fft);
+    RUN_TEST(test_dc_int_poly_mul);
+#if DC_BIASED_REFCOUNT
+    RUN_TEST(test_dc_refcount_biased);
+#endif
+#if DC_POOL_DOUBLE
+    RUN_TEST(test_dc_double_pool);
+#endif
+#if DC_ARENA
+    RUN_TEST(test_dc_arena);
+#endif
+#if DC_STATS
+    RUN_TEST(test_dc_stats);
+#endif
+#if DC_TRACK_ALLOCS
+    RUN_TEST(test_dc_track_allocs);
+#endif
 
     // Type conversion tests
     RUN_TEST(test_type_conversions);
     RUN_TEST(test_remaining_type_conversions);
+    RUN_TEST(test_dc_serialization);
 
     // Edge cases
     RUN_TEST(test_edge_cases);
     RUN_TEST(test_string_formatting);
 
+    // In-place arithmetic
+    RUN_TEST(test_inplace_arithmetic);
+
     return UNITY_END();
 }